@@ -0,0 +1,68 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include "channel_batch_queue.h"
+
+ChannelBatchQueue::ChannelBatchQueue(size_t max_in_flight_bytes) :
+  _in_flight_bytes(0),
+  _max_in_flight_bytes(max_in_flight_bytes),
+  _is_closed(false)
+{
+}
+
+bool ChannelBatchQueue::push(std::unique_ptr<ChannelBatch> batch)
+{
+  const size_t batch_size = batch->payload_buffer.size();
+
+  std::unique_lock<std::mutex> lock(_mutex);
+
+  // A batch that is larger than the limit on its own is accepted once the queue is empty
+  _push_cv.wait(lock, [&]() -> bool { return _is_closed || _batches.empty() || (_in_flight_bytes + batch_size <= _max_in_flight_bytes); });
+  if (_is_closed)
+    return false;
+
+  _in_flight_bytes += batch_size;
+  _batches.emplace_back(std::move(batch));
+  _pop_cv.notify_one();
+  return true;
+}
+
+std::unique_ptr<ChannelBatch> ChannelBatchQueue::pop()
+{
+  std::unique_lock<std::mutex> lock(_mutex);
+  _pop_cv.wait(lock, [&]() -> bool { return _is_closed || !_batches.empty(); });
+  if (_batches.empty())
+    return nullptr;
+
+  auto batch = std::move(_batches.front());
+  _batches.pop_front();
+  _in_flight_bytes -= batch->payload_buffer.size();
+  _push_cv.notify_all();
+  return batch;
+}
+
+void ChannelBatchQueue::close()
+{
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _is_closed = true;
+  }
+  _push_cv.notify_all();
+  _pop_cv.notify_all();
+}
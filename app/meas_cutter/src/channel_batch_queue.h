@@ -0,0 +1,75 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#pragma once
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "utils.h"
+
+// A batch of consecutive entries of one channel. The payloads of all entries
+// are stored back to back in a single buffer.
+struct ChannelBatch
+{
+  struct Entry
+  {
+    eCALMeasCutterUtils::Timestamp timestamp;
+    eCALMeasCutterUtils::MetaData  meta_data;
+    size_t                         offset;
+    size_t                         size;
+  };
+
+  std::string                      channel_name;
+  eCALMeasCutterUtils::ChannelInfo channel_info;
+  size_t                           channel_entry_count;  // total number of entries that are exported for this channel
+  bool                             is_first_batch;
+  bool                             is_last_batch;
+
+  std::vector<Entry>               entries;
+  std::string                      payload_buffer;
+};
+
+// Queue between the channel reader threads and the writer thread. Pushing
+// blocks as long as the payload of all queued batches exceeds the maximum
+// amount of in-flight memory, so readers cannot run away from the writer.
+class ChannelBatchQueue
+{
+public:
+  explicit ChannelBatchQueue(size_t max_in_flight_bytes);
+
+  bool push(std::unique_ptr<ChannelBatch> batch);
+  std::unique_ptr<ChannelBatch> pop();
+
+  // Wakes up all readers and the writer. Afterwards, push() fails and pop()
+  // returns nullptr once the queue is empty.
+  void close();
+
+private:
+  std::mutex                                _mutex;
+  std::condition_variable                   _push_cv;
+  std::condition_variable                   _pop_cv;
+  std::deque<std::unique_ptr<ChannelBatch>> _batches;
+  size_t                                    _in_flight_bytes;
+  const size_t                              _max_in_flight_bytes;
+  bool                                      _is_closed;
+};
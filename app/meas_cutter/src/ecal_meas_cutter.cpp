@@ -22,6 +22,8 @@
 bool eCALMeasCutterUtils::quiet                     = false;
 bool eCALMeasCutterUtils::save_log                  = false;
 bool eCALMeasCutterUtils::enable_one_file_per_topic = false;
+unsigned int eCALMeasCutterUtils::channel_threads   = 1;
+size_t eCALMeasCutterUtils::max_in_flight_mib       = eCALMeasCutterUtils::kDefaultMaxInFlightMiB;
 
 eCALMeasCutter::eCALMeasCutter(std::vector<std::string>& arguments):
   _max_size_per_file(0),
@@ -41,6 +43,8 @@ void eCALMeasCutter::parseCmdLine(std::vector<std::string>& arguments)
   TCLAP::SwitchArg quiet_arg("q", "quiet", "Disables logging to console output.", cmd, false);
   TCLAP::SwitchArg save_log_arg("s", "save_log", "Enables log file creation in a folder called \"log\" next to the executable.", cmd, false);
   TCLAP::SwitchArg one_file_per_topic_arg("", "enable-one-file-per-topic", "Whether to separate each topic in single HDF5 file.", cmd, false);
+  TCLAP::ValueArg<unsigned int> channel_threads_arg("", "channel-threads", "Number of threads reading channels of a measurement in parallel. 0 uses one thread per CPU core. Default: 1", false, 1, "uint", cmd);
+  TCLAP::ValueArg<unsigned int> max_in_flight_arg("", "max-memory", "Maximum amount of payload data in MiB that is read but not yet written when reading channels in parallel. Default: " + std::to_string(eCALMeasCutterUtils::kDefaultMaxInFlightMiB), false, eCALMeasCutterUtils::kDefaultMaxInFlightMiB, "uint", cmd);
 
   try
   {
@@ -61,6 +65,8 @@ void eCALMeasCutter::parseCmdLine(std::vector<std::string>& arguments)
   eCALMeasCutterUtils::quiet                     = quiet_arg.getValue();
   eCALMeasCutterUtils::save_log                  = save_log_arg.getValue();
   eCALMeasCutterUtils::enable_one_file_per_topic = one_file_per_topic_arg.getValue();
+  eCALMeasCutterUtils::channel_threads           = (channel_threads_arg.getValue() > 0) ? channel_threads_arg.getValue() : std::max(1u, std::thread::hardware_concurrency());
+  eCALMeasCutterUtils::max_in_flight_mib         = std::max(1u, max_in_flight_arg.getValue());
 
   if (eCALMeasCutterUtils::save_log)
   {
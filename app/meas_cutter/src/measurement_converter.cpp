@@ -19,6 +19,9 @@
 
 #include "measurement_converter.h"
 
+#include <thread>
+#include <unordered_map>
+
 MeasurementConverter::MeasurementConverter() :
   _abort_conversion(false),
   _is_channel_manipulation_valid(true),
@@ -207,13 +210,9 @@ bool MeasurementConverter::convert()
   eCALMeasCutterUtils::printOutput("Processing " + _importer.getLoadedPath() + " as " + _current_job.id + "\n" 
                                    + std::string(13, ' ') + "Exporting to " + _exporter.getOutputPath());
 
+  std::vector<std::string> channels_to_export;
   for (const auto& channel_name : channel_names)
   {
-    if (_abort_conversion)
-    {
-      conversion_result = false;
-      break;
-    }
     if (_is_channel_manipulation_valid)
     {
       if (_current_job.operation_type == eCALMeasCutterUtils::ChannelOperationType::exclude &&
@@ -222,6 +221,20 @@ bool MeasurementConverter::convert()
       if (_current_job.operation_type == eCALMeasCutterUtils::ChannelOperationType::include &&
         !isChannelMentionedInFile(channel_name))  continue;
     }
+    channels_to_export.push_back(channel_name);
+  }
+
+  if ((eCALMeasCutterUtils::channel_threads > 1) && (channels_to_export.size() > 1))
+  {
+    conversion_result = convertChannelsParallel(channels_to_export);
+  }
+  else for (const auto& channel_name : channels_to_export)
+  {
+    if (_abort_conversion)
+    {
+      conversion_result = false;
+      break;
+    }
 
     try
     {
@@ -319,6 +332,183 @@ bool MeasurementConverter::convert()
   return conversion_result;
 }
 
+bool MeasurementConverter::convertChannelsParallel(const std::vector<std::string>& channel_names)
+{
+  // Each reader thread opens its own importer and reads whole channels into
+  // batches. The batches are written by this thread, as the exporter can only
+  // be used by one thread. The queue blocks the readers as soon as too much
+  // data is waiting to be written.
+  const size_t reader_count        = std::min<size_t>(eCALMeasCutterUtils::channel_threads, channel_names.size());
+  const size_t max_in_flight_bytes = eCALMeasCutterUtils::max_in_flight_mib * 1024 * 1024;
+  const size_t batch_size          = std::min<size_t>(max_in_flight_bytes / (2 * reader_count) + 1, 16 * 1024 * 1024);
+
+  ChannelBatchQueue   batch_queue(max_in_flight_bytes);
+  std::atomic<size_t> next_channel_index(0);
+  std::atomic<size_t> active_readers(reader_count);
+  std::atomic<bool>   read_result(true);
+
+  eCALMeasCutterUtils::printOutput("Exporting " + std::to_string(channel_names.size()) + " channels with " + std::to_string(reader_count) + " threads", _current_job.id);
+
+  std::vector<std::thread> reader_threads;
+  for (size_t i = 0; i < reader_count; i++)
+  {
+    reader_threads.emplace_back([&]()
+    {
+      MeasurementImporter importer;
+      bool importer_ok = true;
+      try
+      {
+        importer.setPath(_current_job.input_measurement_path);
+      }
+      catch (const ImporterException& e)
+      {
+        eCALMeasCutterUtils::printError(e.what(), _current_job.id);
+        importer_ok = false;
+        read_result = false;
+      }
+
+      if (importer_ok)
+      {
+        for (size_t channel_index = next_channel_index++; channel_index < channel_names.size(); channel_index = next_channel_index++)
+        {
+          if (_abort_conversion || !readChannel(importer, channel_names[channel_index], batch_size, batch_queue))
+          {
+            read_result = false;
+          }
+        }
+      }
+
+      // The last reader wakes up the writer, once everything has been queued
+      if (--active_readers == 0)
+        batch_queue.close();
+    });
+  }
+
+  bool write_result = true;
+  size_t finished_channels = 0;
+  std::unordered_map<std::string, std::pair<size_t, int>> channel_progress; // written entries, last reported percentage
+
+  while (auto batch = batch_queue.pop())
+  {
+    if (_abort_conversion)
+    {
+      write_result = false;
+      batch_queue.close();
+      break;
+    }
+
+    try
+    {
+      if (batch->is_first_batch)
+        _exporter.createChannel(batch->channel_name, batch->channel_info);
+      else
+        _exporter.setCurrentChannel(batch->channel_name);
+
+      for (const auto& entry : batch->entries)
+      {
+        _exporter.setData(entry.timestamp, entry.meta_data, batch->payload_buffer.data() + entry.offset, entry.size);
+      }
+    }
+    catch (const ExporterException& e)
+    {
+      eCALMeasCutterUtils::printError("Exporting error in channel: " + batch->channel_name + ": " + e.what(), _current_job.id);
+      write_result = false;
+      batch_queue.close();
+      break;
+    }
+
+    auto& progress = channel_progress[batch->channel_name];
+    progress.first += batch->entries.size();
+
+    if (batch->is_last_batch)
+    {
+      finished_channels++;
+      eCALMeasCutterUtils::printOutput("Finished exporting channel " + batch->channel_name + " (" + std::to_string(progress.first) + " entries) ["
+                                       + std::to_string(finished_channels) + "/" + std::to_string(channel_names.size()) + "]", _current_job.id);
+      channel_progress.erase(batch->channel_name);
+    }
+    else if (batch->channel_entry_count > 0)
+    {
+      // Report the progress of large channels in steps of 10%
+      const int percentage = static_cast<int>((progress.first * 100) / batch->channel_entry_count);
+      if ((percentage < 100) && (percentage / 10 > progress.second / 10))
+      {
+        progress.second = percentage;
+        eCALMeasCutterUtils::printOutput("Exporting channel " + batch->channel_name + ": " + std::to_string(percentage) + "%", _current_job.id);
+      }
+    }
+  }
+
+  for (auto& reader_thread : reader_threads)
+  {
+    reader_thread.join();
+  }
+
+  return read_result && write_result;
+}
+
+bool MeasurementConverter::readChannel(MeasurementImporter& importer, const std::string& channel_name, size_t batch_size, ChannelBatchQueue& batch_queue)
+{
+  try
+  {
+    importer.openChannel(channel_name);
+    auto channel_info = importer.getChannelInfoforCurrentChannel();
+    auto timestamps = importer.getTimestamps();
+    auto timestamp_begin_iter = timestamps.lower_bound(_calculated_start_timestamp);
+    auto timestamp_end_iter = timestamps.upper_bound(_calculated_end_timestamp);
+    const auto channel_entry_count = static_cast<size_t>(std::distance(timestamp_begin_iter, timestamp_end_iter));
+
+    eCALMeasCutterUtils::printOutput("Exporting channel " + channel_name + "...", _current_job.id);
+
+    auto create_batch = [&](bool is_first_batch)
+    {
+      auto batch = std::make_unique<ChannelBatch>();
+      batch->channel_name        = channel_name;
+      batch->channel_info        = channel_info;
+      batch->channel_entry_count = channel_entry_count;
+      batch->is_first_batch      = is_first_batch;
+      batch->is_last_batch       = false;
+      return batch;
+    };
+
+    auto batch = create_batch(true);
+    for (auto timestamp_iter = timestamp_begin_iter; timestamp_iter != timestamp_end_iter; ++timestamp_iter)
+    {
+      if (_abort_conversion)
+        return false;
+
+      ChannelBatch::Entry entry;
+      entry.timestamp = *timestamp_iter;
+      entry.offset    = batch->payload_buffer.size();
+      entry.size      = importer.appendData(*timestamp_iter, entry.meta_data, batch->payload_buffer);
+      batch->entries.push_back(std::move(entry));
+
+      if (batch->payload_buffer.size() >= batch_size)
+      {
+        if (!batch_queue.push(std::move(batch)))
+          return false;
+        batch = create_batch(false);
+      }
+    }
+
+    batch->is_last_batch = true;
+    return batch_queue.push(std::move(batch));
+  }
+  catch (const ImporterException& e)
+  {
+    eCALMeasCutterUtils::printError("Importing error in channel " + channel_name + ": " + e.what(), _current_job.id);
+  }
+  catch (const std::bad_alloc& e)
+  {
+    eCALMeasCutterUtils::printError("Memory limit has been exceeded: " + std::string(e.what()), _current_job.id);
+  }
+  catch (...)
+  {
+    eCALMeasCutterUtils::printError("An unknown error has occured in channel " + channel_name + ". Please report this to an AT9 team member.", _current_job.id);
+  }
+  return false;
+}
+
 std::pair<eCALMeasCutterUtils::Timestamp, eCALMeasCutterUtils::Timestamp> MeasurementConverter::getCalculatedStartEndTimestamps()
 {
   std::pair<eCALMeasCutterUtils::Timestamp, eCALMeasCutterUtils::Timestamp> start_stop_pair(_original_start_timestamp, _original_end_timestamp);
@@ -18,11 +18,15 @@
 */
 
 #pragma once
+#include <atomic>
 #include <iostream>
+#include <string>
+#include <vector>
 
 #include "utils.h"
 #include "measurement_importer.h"
 #include "measurement_exporter.h"
+#include "channel_batch_queue.h"
 
 class MeasurementConverter
 {
@@ -38,8 +42,10 @@ private:
   std::pair<eCALMeasCutterUtils::Timestamp, eCALMeasCutterUtils::Timestamp> getCalculatedStartEndTimestamps();
   double                                                                    getConversionFactor(const eCALMeasCutterUtils::ScaleType scale_type);
   bool isChannelMentionedInFile(const std::string& channel_name);
+  bool convertChannelsParallel(const std::vector<std::string>& channel_names);
+  bool readChannel(MeasurementImporter& importer, const std::string& channel_name, size_t batch_size, ChannelBatchQueue& batch_queue);
   eCALMeasCutterUtils::MeasurementJob                                       _current_job;
-  bool                                                                      _abort_conversion;
+  std::atomic<bool>                                                         _abort_conversion;
   bool                                                                      _is_channel_manipulation_valid;
 
   MeasurementImporter                                                       _importer;
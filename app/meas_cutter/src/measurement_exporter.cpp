@@ -67,7 +67,17 @@ void MeasurementExporter::createChannel(const std::string& channel_name, const e
   _writer->SetChannelDataTypeInformation(channel_name, data_type_info);
 }
 
+void MeasurementExporter::setCurrentChannel(const std::string& channel_name)
+{
+  _current_channel_name = channel_name;
+}
+
 void MeasurementExporter::setData(eCALMeasCutterUtils::Timestamp timestamp, const eCALMeasCutterUtils::MetaData& meta_data, const std::string& payload)
+{
+  setData(timestamp, meta_data, payload.data(), payload.size());
+}
+
+void MeasurementExporter::setData(eCALMeasCutterUtils::Timestamp timestamp, const eCALMeasCutterUtils::MetaData& meta_data, const char* payload, size_t payload_size)
 {
   eCALMeasCutterUtils::MetaData::const_iterator iter;
 
@@ -80,7 +90,7 @@ void MeasurementExporter::setData(eCALMeasCutterUtils::Timestamp timestamp, cons
   iter = meta_data.find(eCALMeasCutterUtils::MetaDatumKey::SENDER_CLOCK);
   const auto sender_clock = (iter != meta_data.end()) ? iter->second.sender_clock : 0;
 
-  if (!_writer->AddEntryToFile(payload.data(), payload.size(), sender_timestamp, timestamp, _current_channel_name, sender_id, sender_clock))
+  if (!_writer->AddEntryToFile(payload, payload_size, sender_timestamp, timestamp, _current_channel_name, sender_id, sender_clock))
   {
     throw ExporterException("Unable to export protobuf message.");
   }
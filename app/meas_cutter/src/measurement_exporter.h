@@ -41,7 +41,9 @@ public:
 
   void        setPath(const std::string& path, const std::string& base_name, const size_t& max_size_per_file);
   void        createChannel(const std::string& channel_name, const eCALMeasCutterUtils::ChannelInfo& channel_info);
+  void        setCurrentChannel(const std::string& channel_name);
   void        setData(eCALMeasCutterUtils::Timestamp timestamp, const eCALMeasCutterUtils::MetaData& meta_data, const std::string& payload);
+  void        setData(eCALMeasCutterUtils::Timestamp timestamp, const eCALMeasCutterUtils::MetaData& meta_data, const char* payload, size_t payload_size);
   std::string getOutputPath() const;
   std::string getRootOutputPath() const;
 
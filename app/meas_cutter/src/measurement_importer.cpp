@@ -80,10 +80,10 @@ void MeasurementImporter::openChannel(const std::string& channel_name)
   _current_opened_channel_data._channel_info.description = channel_information.descriptor;
   _current_opened_channel_data._channel_info.name = channel_name;
 
-  eCAL::experimental::measurement::base::EntryInfoSet entry_info_set;
-  _reader->GetEntriesInfo(channel_name, entry_info_set);
+  eCAL::experimental::measurement::base::EntryInfoVect entry_infos;
+  _reader->GetEntriesInfo(channel_name, entry_infos);
 
-  for (const auto& entry_info : entry_info_set)
+  for (const auto& entry_info : entry_infos)
   {
     _current_opened_channel_data._timestamps.insert(entry_info.RcvTimestamp);
     _current_opened_channel_data._timestamp_entry_info_map.insert(std::make_pair(entry_info.RcvTimestamp, entry_info));
@@ -109,11 +109,39 @@ void MeasurementImporter::getData(eCALMeasCutterUtils::Timestamp timestamp, eCAL
   size_t size = 0;
   _reader->GetEntryDataSize(data_id, size);
 
-   std::vector<char> buffer(size);
-   _reader->GetEntryData(data_id, buffer.data());
+  // read directly into the output string, so the payload is only copied once
+  data.resize(size);
+  if (size > 0)
+    _reader->GetEntryData(data_id, &data[0]);
 
-  data.assign(buffer.data(), size);
+  fillMetaData(entry_info, meta_data);
+}
+
+size_t MeasurementImporter::appendData(eCALMeasCutterUtils::Timestamp timestamp, eCALMeasCutterUtils::MetaData& meta_data, std::string& buffer)
+{
+  const auto& entry_info = _current_opened_channel_data._timestamp_entry_info_map.at(timestamp);
+
+  auto data_id = entry_info.ID;
+
+  size_t size = 0;
+  if (!_reader->GetEntryDataSize(data_id, size))
+  {
+    throw ImporterException("Unable to read size of entry " + std::to_string(data_id) + ".");
+  }
+
+  const size_t offset = buffer.size();
+  buffer.resize(offset + size);
+  if ((size > 0) && !_reader->GetEntryData(data_id, &buffer[offset]))
+  {
+    throw ImporterException("Unable to read entry " + std::to_string(data_id) + ".");
+  }
+
+  fillMetaData(entry_info, meta_data);
+  return size;
+}
 
+void MeasurementImporter::fillMetaData(const eCAL::experimental::measurement::base::EntryInfo& entry_info, eCALMeasCutterUtils::MetaData& meta_data)
+{
   meta_data.clear();
   meta_data[eCALMeasCutterUtils::MetaDatumKey::RECEIVER_TIMESTAMP].receiver_timestamp = entry_info.RcvTimestamp;
   meta_data[eCALMeasCutterUtils::MetaDatumKey::SENDER_TIMESTAMP].sender_timestamp = entry_info.SndTimestamp;
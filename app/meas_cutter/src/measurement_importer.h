@@ -47,6 +47,7 @@ public:
   eCALMeasCutterUtils::ChannelInfo                                                        getChannelInfoforCurrentChannel() const;
   eCALMeasCutterUtils::TimestampSet                                                       getTimestamps() const;
   void                                                                                    getData(eCALMeasCutterUtils::Timestamp timestamp, eCALMeasCutterUtils::MetaData& meta_data, std::string& data);
+  size_t                                                                                  appendData(eCALMeasCutterUtils::Timestamp timestamp, eCALMeasCutterUtils::MetaData& meta_data, std::string& buffer);
   std::pair<eCALMeasCutterUtils::Timestamp, eCALMeasCutterUtils::Timestamp>               getOriginalStartFinishTimestamps();
   std::list<std::string>                                                                  getChannelNamesForRegex(const std::regex& regex);
   std::string                                                                             getLoadedPath();
@@ -55,6 +56,7 @@ public:
 private:
   bool                                 isEcalMeasFile(const std::string& path);
   bool                                 isProtoChannel(const eCAL::experimental::measurement::base::DataTypeInformation& channel_info);
+  void                                 fillMetaData(const eCAL::experimental::measurement::base::EntryInfo& entry_info, eCALMeasCutterUtils::MetaData& meta_data);
   std::unique_ptr<eCAL::eh5::v2::HDF5Meas>              _reader;
   eCALMeasCutterUtils::ChannelData                      _current_opened_channel_data;
   std::string                                           _loaded_path;
@@ -45,10 +45,13 @@ namespace eCALMeasCutterUtils
   constexpr const int  kDefaultHdf5FileSize      = 512;
   constexpr const char* kDefaultFolderOutput     = "MEASUREMENT_CONVERTER";
   constexpr const char* kDefaultLogOutputFolder  = "log";
+  constexpr const int  kDefaultMaxInFlightMiB    = 512;
   
   extern bool quiet;
   extern bool save_log;
   extern bool enable_one_file_per_topic;
+  extern unsigned int channel_threads;
+  extern size_t max_in_flight_mib;
 
   static std::fstream log_file_output_stream;
   static std::string getLogTime()
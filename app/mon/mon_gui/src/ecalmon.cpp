@@ -168,15 +168,20 @@ Ecalmon::Ecalmon(QWidget *parent)
   ui_.raw_monitoring_data_dockwidget_content_frame_layout->addWidget(raw_monitoring_data_widget_);
   ui_.system_information_dockwidget_content_frame_layout ->addWidget(syste_information_widget_);
 
+  // The monitoring is fetched and parsed in a worker thread, the GUI thread only updates the models
+  monitor_update_thread_ = new MonitorUpdateThread(this);
+  connect(monitor_update_thread_, &MonitorUpdateThread::monitorUpdated,      this, &Ecalmon::monitorUpdateReceived);
+  connect(monitor_update_thread_, &MonitorUpdateThread::monitorUpdateFailed, this, &Ecalmon::monitorUpdateFailed);
+
   monitor_update_timer_ = new QTimer(this);
   connect(monitor_update_timer_, &QTimer::timeout, [this](){updateMonitor();});
   monitor_update_timer_->start(1000);
 
 
-  connect(this, &Ecalmon::monitorUpdatedSignal, [this](eCAL::pb::Monitoring monitoring_pb) {topic_widget_  ->monitorUpdated(monitoring_pb);});
-  connect(this, &Ecalmon::monitorUpdatedSignal, [this](eCAL::pb::Monitoring monitoring_pb) {process_widget_->monitorUpdated(monitoring_pb); });
-  connect(this, &Ecalmon::monitorUpdatedSignal, [this](eCAL::pb::Monitoring monitoring_pb) {host_widget_   ->monitorUpdated(monitoring_pb); });
-  connect(this, &Ecalmon::monitorUpdatedSignal, [this](eCAL::pb::Monitoring monitoring_pb) {service_widget_->monitorUpdated(monitoring_pb); });
+  connect(this, &Ecalmon::monitorUpdatedSignal, [this](const eCAL::pb::Monitoring& monitoring_pb) {topic_widget_  ->monitorUpdated(monitoring_pb);});
+  connect(this, &Ecalmon::monitorUpdatedSignal, [this](const eCAL::pb::Monitoring& monitoring_pb) {process_widget_->monitorUpdated(monitoring_pb); });
+  connect(this, &Ecalmon::monitorUpdatedSignal, [this](const eCAL::pb::Monitoring& monitoring_pb) {host_widget_   ->monitorUpdated(monitoring_pb); });
+  connect(this, &Ecalmon::monitorUpdatedSignal, [this](const eCAL::pb::Monitoring& monitoring_pb) {service_widget_->monitorUpdated(monitoring_pb); });
 
   // Monitor Update Speed selection
   monitor_update_speed_group_ = new QActionGroup(this);
@@ -328,6 +333,8 @@ void Ecalmon::createVisualizationDockWidget(const QString& topic_name, const QSt
 
 Ecalmon::~Ecalmon()
 {
+  // The worker thread must not access eCAL anymore when finalizing it
+  monitor_update_thread_->stop();
   eCAL::Finalize();
 }
 
@@ -347,33 +354,33 @@ void Ecalmon::updateMonitor()
 #ifndef NDEBUG
   qDebug().nospace() << "[" << metaObject()->className() << "] Updating monitor";
 #endif // NDEBUG
-  std::string monitoring_string;
-  eCAL::pb::Monitoring monitoring_pb;
+  monitor_update_thread_->requestUpdate();
+}
 
-  if (eCAL::Monitoring::GetMonitoring(monitoring_string) && !monitoring_string.empty() && monitoring_pb.ParseFromString(monitoring_string))
+void Ecalmon::monitorUpdateReceived(const std::shared_ptr<const eCAL::pb::Monitoring>& monitoring_pb)
+{
+  monitor_error_counter_ = 0;
+  if (error_label_->isVisible())
   {
-    monitor_error_counter_ = 0;
-    if (error_label_->isVisible())
-    {
-      error_label_->setHidden(true);
-    }
-
-    emit monitorUpdatedSignal(monitoring_pb);
+    error_label_->setHidden(true);
   }
-  else
+
+  emit monitorUpdatedSignal(*monitoring_pb);
+}
+
+void Ecalmon::monitorUpdateFailed()
+{
+  monitor_error_counter_++;
+  error_label_->setText("  Error getting Monitoring Information [" + QString::number(monitor_error_counter_) + "]  ");
+  if (!error_label_->isVisible())
   {
-    monitor_error_counter_++;
-    error_label_->setText("  Error getting Monitoring Information [" + QString::number(monitor_error_counter_) + "]  ");
-    if (!error_label_->isVisible())
-    {
-      error_label_->setHidden(false);
-    }
+    error_label_->setHidden(false);
+  }
 
 #ifndef NDEBUG
-    qDebug().nospace() << "[" << metaObject()->className() << "Error getting Monitoring Information";
+  qDebug().nospace() << "[" << metaObject()->className() << "Error getting Monitoring Information";
 #endif // NDEBUG
-    eCAL::Logging::Log(eCAL::Logging::eLogLevel::log_level_error, "Error getting eCAL Monitoring information");
-  }
+  eCAL::Logging::Log(eCAL::Logging::eLogLevel::log_level_error, "Error getting eCAL Monitoring information");
 }
 
 
@@ -33,6 +33,10 @@
 #include "widgets/raw_monitoring_data_widget/raw_monitoring_data_widget.h"
 #include "widgets/system_information_widget/system_information_widget.h"
 
+#include "monitor_update_thread.h"
+
+#include <memory>
+
 #ifdef _MSC_VER
 #pragma warning(push)
 #pragma warning(disable: 4100 4127 4146 4505 4800 4189 4592) // disable proto warnings
@@ -78,6 +82,9 @@ private slots:
   void createVisualizationDockWidget(const QString& topic_name, const QString& topic_type, const QString& iid, const QString& object_name = QString());
   void updateEcalTime();
 
+  void monitorUpdateReceived(const std::shared_ptr<const eCAL::pb::Monitoring>& monitoring_pb);
+  void monitorUpdateFailed();
+
 signals:
   void monitorUpdatedSignal(const eCAL::pb::Monitoring&);
 
@@ -105,6 +112,7 @@ private:
   QLabel* time_label_;
 
   QTimer* monitor_update_timer_;
+  MonitorUpdateThread* monitor_update_thread_;
   QTimer* ecal_time_update_timer_;
 
   QActionGroup*  monitor_update_speed_group_;
@@ -28,6 +28,7 @@ int main(int argc, char *argv[])
 
   qRegisterMetaType<QVector<int>>("QVector<int>");
   qRegisterMetaType<ByteSize>("ByteSize");
+  qRegisterMetaType<std::shared_ptr<const eCAL::pb::Monitoring>>("std::shared_ptr<const eCAL::pb::Monitoring>");
 
   a.setOrganizationName      ("Continental");
   a.setOrganizationDomain    ("continental-corporation.com");
@@ -0,0 +1,87 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include "monitor_update_thread.h"
+
+#include <ecal/monitoring.h>
+
+#include <string>
+
+MonitorUpdateThread::MonitorUpdateThread(QObject* parent)
+  : QObject(parent)
+  , update_requested_(false)
+  , stop_requested_  (false)
+{
+  thread_ = std::thread(&MonitorUpdateThread::run, this);
+}
+
+MonitorUpdateThread::~MonitorUpdateThread()
+{
+  stop();
+}
+
+void MonitorUpdateThread::stop()
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_requested_ = true;
+  }
+  cv_.notify_all();
+
+  if (thread_.joinable())
+    thread_.join();
+}
+
+void MonitorUpdateThread::requestUpdate()
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    update_requested_ = true;
+  }
+  cv_.notify_all();
+}
+
+void MonitorUpdateThread::run()
+{
+  std::string monitoring_string;
+
+  for (;;)
+  {
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      cv_.wait(lock, [this]() { return update_requested_ || stop_requested_; });
+      if (stop_requested_)
+        return;
+      update_requested_ = false;
+    }
+
+    // The string is reused, so its buffer only grows once for large systems
+    monitoring_string.clear();
+    auto monitoring_pb = std::make_shared<eCAL::pb::Monitoring>();
+
+    if (eCAL::Monitoring::GetMonitoring(monitoring_string) && !monitoring_string.empty() && monitoring_pb->ParseFromString(monitoring_string))
+    {
+      emit monitorUpdated(std::move(monitoring_pb));
+    }
+    else
+    {
+      emit monitorUpdateFailed();
+    }
+  }
+}
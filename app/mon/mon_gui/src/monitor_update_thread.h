@@ -0,0 +1,75 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#pragma once
+
+#include <QObject>
+#include <QMetaType>
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4100 4127 4146 4505 4800 4189 4592) // disable proto warnings
+#endif
+#include <ecal/core/pb/monitoring.pb.h>
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+Q_DECLARE_METATYPE(std::shared_ptr<const eCAL::pb::Monitoring>)
+
+/**
+ * @brief Worker thread that fetches and parses the eCAL monitoring.
+ *
+ * Getting the monitoring of a large system and parsing it takes long enough
+ * to freeze the GUI, so it is done here. The result is delivered to the GUI
+ * thread by the queued monitorUpdated() signal. Requests that arrive while an
+ * update is still in progress are merged into a single follow-up update.
+ */
+class MonitorUpdateThread : public QObject
+{
+  Q_OBJECT
+
+public:
+  MonitorUpdateThread(QObject* parent = nullptr);
+  ~MonitorUpdateThread();
+
+  // Stops the thread, no signals are emitted afterwards
+  void stop();
+
+public slots:
+  void requestUpdate();
+
+signals:
+  void monitorUpdated(std::shared_ptr<const eCAL::pb::Monitoring> monitoring_pb);
+  void monitorUpdateFailed();
+
+private:
+  void run();
+
+  std::mutex              mutex_;
+  std::condition_variable cv_;
+  bool                    update_requested_;
+  bool                    stop_requested_;
+  std::thread             thread_;
+};
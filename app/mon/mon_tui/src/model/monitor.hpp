@@ -23,33 +23,35 @@
 #include <ecal/ecal.h>
 #include <ecal/monitoring.h>
 
+#ifdef _MSC_VER
+#pragma warning(push, 0) // disable proto warnings
+#endif
+#include "ecal/core/pb/process.pb.h"
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
 #include <functional>
 #include <string>
 #include <utility>
 #include <vector>
 #include <thread>
 #include <map>
+#include <mutex>
+#include <unordered_map>
 
 #include "model/data/host.hpp"
 #include "model/data/process.hpp"
 #include "model/data/service.hpp"
 #include "model/data/topic.hpp"
 
-#ifdef _MSC_VER
-#pragma warning(push, 0) // disable proto warnings
-#endif
-#include "ecal/core/pb/monitoring.pb.h"
-#ifdef _MSC_VER
-#pragma warning(pop)
-#endif
-
 using ModelUpdateCallbackT = std::function<void()>;
 
 class MonitorModel
 {
   int update_time_ = 1000;
   bool is_polling;
-  eCAL::pb::Monitoring mon_;
+  eCAL::Monitoring::SMonitoring mon_;
 
   std::vector<Host> hosts;
   std::vector<Process> processes;
@@ -61,47 +63,47 @@ class MonitorModel
   mutable std::mutex mtx;
   mutable std::mutex callback_mtx;
 
-  Process::Severity Severity(eCAL::pb::eProcessSeverity severity)
+  Process::Severity Severity(int32_t severity)
   {
-    switch(severity)
+    switch(static_cast<eCAL::Process::eSeverity>(severity))
     {
-    case eCAL::pb::proc_sev_healthy:
+    case eCAL::Process::eSeverity::healthy:
       return Process::Severity::HEALTHY;
-    case eCAL::pb::proc_sev_warning:
+    case eCAL::Process::eSeverity::warning:
       return Process::Severity::WARNING;
-    case eCAL::pb::proc_sev_critical:
+    case eCAL::Process::eSeverity::critical:
       return Process::Severity::CRITICAL;
-    case eCAL::pb::proc_sev_failed:
+    case eCAL::Process::eSeverity::failed:
       return Process::Severity::FAILED;
-    case eCAL::pb::proc_sev_unknown:
+    case eCAL::Process::eSeverity::unknown:
     default:
       return Process::Severity::UNKNOWN;
     }
   }
 
-  Process::SeverityLevel SeverityLevel(eCAL::pb::eProcessSeverityLevel level)
+  Process::SeverityLevel SeverityLevel(int32_t level)
   {
-    switch(level)
+    switch(static_cast<eCAL::Process::eSeverityLevel>(level))
     {
-    case eCAL::pb::proc_sev_level1:
+    case eCAL::Process::eSeverityLevel::level1:
       return Process::SeverityLevel::LEVEL_1;
-    case eCAL::pb::proc_sev_level2:
+    case eCAL::Process::eSeverityLevel::level2:
       return Process::SeverityLevel::LEVEL_2;
-    case eCAL::pb::proc_sev_level3:
+    case eCAL::Process::eSeverityLevel::level3:
       return Process::SeverityLevel::LEVEL_3;
-    case eCAL::pb::proc_sev_level4:
+    case eCAL::Process::eSeverityLevel::level4:
       return Process::SeverityLevel::LEVEL_4;
-    case eCAL::pb::proc_sev_level5:
+    case eCAL::Process::eSeverityLevel::level5:
       return Process::SeverityLevel::LEVEL_5;
-    case eCAL::pb::proc_sev_level_unknown:
     default:
       return Process::SeverityLevel::UNKNOWN;
     }
   }
 
-  Process::TimeSyncState TimeSyncState(eCAL::pb::eTimeSyncState state)
+  Process::TimeSyncState TimeSyncState(int32_t state)
   {
-    switch(state)
+    // the monitoring struct carries the raw eCAL::pb::eTimeSyncState value
+    switch(static_cast<eCAL::pb::eTimeSyncState>(state))
     {
     case eCAL::pb::tsync_realtime:
       return Process::TimeSyncState::REALTIME;
@@ -113,128 +115,123 @@ class MonitorModel
     }
   }
 
-  Topic::Direction TopicDirection(const std::string &direction)
-  {
-    if(direction == "publisher") return Topic::Direction::PUBLISHER;
-
-    return Topic::Direction::SUBSCRIBER;
-  }
-
-  Topic::TransportLayer TopicTransportLayer(eCAL::pb::eTransportLayerType layer)
+  Topic::TransportLayer TopicTransportLayer(eCAL::Monitoring::eTransportLayerType layer)
   {
     switch(layer)
     {
-      case eCAL::pb::tl_all:
-        return Topic::TransportLayer::ALL;
-      case eCAL::pb::tl_ecal_shm:
+      case eCAL::Monitoring::eTransportLayerType::shm:
         return Topic::TransportLayer::SHM;
-      case eCAL::pb::tl_ecal_tcp:
+      case eCAL::Monitoring::eTransportLayerType::tcp:
         return Topic::TransportLayer::TCP;
-      case eCAL::pb::tl_ecal_udp_mc:
+      case eCAL::Monitoring::eTransportLayerType::udp_mc:
         return Topic::TransportLayer::UDP_MC;
-      case eCAL::pb::tl_none:
+      case eCAL::Monitoring::eTransportLayerType::none:
       default:
         return Topic::TransportLayer::NONE;
     }
   }
 
-  void ProcessData()
+  void AddTopics(std::vector<eCAL::Monitoring::STopic>& mon_topics, Topic::Direction direction, std::unordered_map<std::string, Host*>& hosts_map)
   {
-    std::lock_guard<std::mutex> lock{mtx};
-
-    hosts.clear();
-    processes.clear();
-    services.clear();
-    topics.clear();
-
-    std::unordered_map<std::string, Host*> hosts_map;
-    for(auto &p: *mon_.mutable_processes())
+    for (auto &t : mon_topics)
     {
-      if(hosts_map.find(p.host_name()) == hosts_map.end())
-      {
-        auto &host = hosts.emplace_back();
-        host.name = p.host_name();
-        hosts_map[host.name] = &host;
-      }
-      auto &process = processes.emplace_back();
-      process.process_id = p.process_id();
-      process.name = std::move(*p.mutable_process_name());
-      process.host_name = std::move(*p.mutable_host_name());
-      process.unit_name = std::move(*p.mutable_unit_name());
-      process.params = std::move(*p.mutable_process_parameter());
-      process.severity = Severity(p.state().severity());
-      process.severity_level = SeverityLevel(p.state().severity_level());
-      process.state_info = std::move(*p.mutable_state()->mutable_info());
-      process.time_sync_state = TimeSyncState(p.time_sync_state());
-      process.time_sync_mod_name = std::move(*p.mutable_time_sync_module_name());
-      process.component_init_info = std::move(*p.mutable_component_init_info());
-      process.ecal_runtime_version = std::move(*p.mutable_ecal_runtime_version());
-    }
-
-    for (auto &t : *mon_.mutable_topics())
-    {
-      auto &name = t.host_name();
-      auto &direction = t.direction();
-      auto found = hosts_map.find(name);
+      auto found = hosts_map.find(t.host_name);
       if(found != hosts_map.end())
       {
         auto host = found->second;
-        if(direction == "publisher")
+        if(direction == Topic::Direction::PUBLISHER)
         {
           host->publisher_count++;
-          host->data_sent_bytes += ((long long)t.topic_size() * (long long)t.data_frequency()) / 1000;
+          host->data_sent_bytes += ((long long)t.topic_size * (long long)t.data_frequency) / 1000;
         }
-        else if(direction == "subscriber")
+        else
         {
           host->subscriber_count++;
-          host->data_received_bytes += ((long long)t.topic_size() * (long long)t.data_frequency()) / 1000;
+          host->data_received_bytes += ((long long)t.topic_size * (long long)t.data_frequency) / 1000;
         }
       }
       auto &topic = topics.emplace_back();
-      topic.registration_clock = t.registration_clock();
-      topic.host_name = std::move(*t.mutable_host_name());
-      topic.process_id = t.process_id();
-      topic.process_name = std::move(*t.mutable_process_name());
-      topic.unit_name = std::move(*t.mutable_unit_name());
-      topic.id = std::move(*t.mutable_topic_id());
-      topic.name = std::move(*t.mutable_topic_name());
-      topic.direction = TopicDirection(t.direction());
-      topic.encoding = std::move(*t.mutable_datatype_information()->mutable_encoding());
-      topic.type = std::move(*t.mutable_datatype_information()->mutable_name());
-      topic.type_descriptor = std::move(*t.mutable_datatype_information()->mutable_descriptor_information());
-      for(auto &tl: t.transport_layer())
+      topic.registration_clock = t.registration_clock;
+      topic.host_name = std::move(t.host_name);
+      topic.process_id = t.process_id;
+      topic.process_name = std::move(t.process_name);
+      topic.unit_name = std::move(t.unit_name);
+      topic.id = std::to_string(t.topic_id);
+      topic.name = std::move(t.topic_name);
+      topic.direction = direction;
+      topic.encoding = std::move(t.datatype_information.encoding);
+      topic.type = std::move(t.datatype_information.name);
+      topic.type_descriptor = std::move(t.datatype_information.descriptor);
+      for(auto &tl: t.transport_layer)
       {
-        if (tl.active())
+        if (tl.active)
         {
-          topic.transport_layers.emplace_back(TopicTransportLayer(tl.type()));
+          topic.transport_layers.emplace_back(TopicTransportLayer(tl.type));
         }
       }
-      topic.size = t.topic_size();
-      topic.local_connections_count = t.connections_local();
-      topic.external_connections_count = t.connections_external();
-      topic.message_drops = t.message_drops();
-      topic.data_id = t.data_id();
-      topic.data_clock = t.data_clock();
-      topic.data_frequency = t.data_frequency();
+      topic.size = t.topic_size;
+      topic.local_connections_count = t.connections_local;
+      topic.external_connections_count = t.connections_external;
+      topic.message_drops = t.message_drops;
+      topic.data_id = t.data_id;
+      topic.data_clock = t.data_clock;
+      topic.data_frequency = t.data_frequency;
     }
+  }
+
+  void ProcessData()
+  {
+    std::lock_guard<std::mutex> lock{mtx};
+
+    hosts.clear();
+    processes.clear();
+    services.clear();
+    topics.clear();
+
+    std::unordered_map<std::string, Host*> hosts_map;
+    for(auto &p: mon_.processes)
+    {
+      if(hosts_map.find(p.host_name) == hosts_map.end())
+      {
+        auto &host = hosts.emplace_back();
+        host.name = p.host_name;
+        hosts_map[host.name] = &host;
+      }
+      auto &process = processes.emplace_back();
+      process.process_id = p.process_id;
+      process.name = std::move(p.process_name);
+      process.host_name = std::move(p.host_name);
+      process.unit_name = std::move(p.unit_name);
+      process.params = std::move(p.process_parameter);
+      process.severity = Severity(p.state_severity);
+      process.severity_level = SeverityLevel(p.state_severity_level);
+      process.state_info = std::move(p.state_info);
+      process.time_sync_state = TimeSyncState(p.time_sync_state);
+      process.time_sync_mod_name = std::move(p.time_sync_module_name);
+      process.component_init_info = std::move(p.component_init_info);
+      process.ecal_runtime_version = std::move(p.ecal_runtime_version);
+    }
+
+    AddTopics(mon_.publishers,  Topic::Direction::PUBLISHER,  hosts_map);
+    AddTopics(mon_.subscribers, Topic::Direction::SUBSCRIBER, hosts_map);
 
-    for(auto &s: *mon_.mutable_services())
+    for(auto &s: mon_.servers)
     {
       auto &service = services.emplace_back();
-      service.id = s.service_id();
-      service.name = std::move(*s.mutable_service_name());
-      service.host_name = std::move(*s.mutable_host_name());
-      service.process_name = std::move(*s.mutable_process_name());
-      service.unit_name = std::move(*s.mutable_unit_name());
-      service.registration_clock = s.registration_clock();
-      service.tcp_port = s.tcp_port_v1();
-      for(auto &m: *s.mutable_methods())
+      service.id = std::to_string(s.service_id);
+      service.name = std::move(s.service_name);
+      service.host_name = std::move(s.host_name);
+      service.process_name = std::move(s.process_name);
+      service.unit_name = std::move(s.unit_name);
+      service.registration_clock = s.registration_clock;
+      service.tcp_port = s.tcp_port_v1;
+      for(auto &m: s.methods)
       {
         auto &method = service.methods.emplace_back();
-        method.name = std::move(*m.mutable_method_name());
-        method.request_type = std::move(*m.mutable_req_type());
-        method.response_type = std::move(*m.mutable_resp_type());
-        method.call_count = m.call_count();
+        method.name = std::move(m.method_name);
+        method.request_type = std::move(m.request_datatype_information.name);
+        method.response_type = std::move(m.response_datatype_information.name);
+        method.call_count = m.call_count;
       }
     }
   }
@@ -250,9 +247,8 @@ class MonitorModel
 
   void Update()
   {
-    std::string raw_data;
-    eCAL::Monitoring::GetMonitoring(raw_data);
-    mon_.ParseFromString(raw_data);
+    // the struct interface hands out the monitoring directly, without serializing and parsing it
+    eCAL::Monitoring::GetMonitoring(mon_);
     ProcessData();
     NotifyUpdate();
   }
@@ -51,10 +51,10 @@ void MeasurementContainer::CreateFrameTable()
   auto channel_names = hdf5_meas_->GetChannelNames();
   for (auto& channel_name : channel_names)
   {
-    eCAL::experimental::measurement::base::EntryInfoSet entry_info_set;
-    if (hdf5_meas_->GetEntriesInfo(channel_name, entry_info_set))
+    eCAL::experimental::measurement::base::EntryInfoVect entry_infos;
+    if (hdf5_meas_->GetEntriesInfo(channel_name, entry_infos))
     {
-      for (auto& entry_info : entry_info_set)
+      for (auto& entry_info : entry_infos)
       {
         MeasurementFrame frame_entry;
 
@@ -86,10 +86,10 @@ void MeasurementContainer::CalculateEstimatedSizeForChannels()
   auto channel_names = hdf5_meas_->GetChannelNames();
   for (auto& channel_name : channel_names)
   {
-    eCAL::experimental::measurement::base::EntryInfoSet entry_info_set;
-    if (hdf5_meas_->GetEntriesInfo(channel_name, entry_info_set))
+    eCAL::experimental::measurement::base::EntryInfoVect entry_infos;
+    if (hdf5_meas_->GetEntriesInfo(channel_name, entry_infos))
     {
-      auto size = entry_info_set.size();
+      auto size = entry_infos.size();
       size_t calculatedStep = size / 5;
       size_t step = (calculatedStep > 0) ? calculatedStep : 1;
       size_t sum = 0;
@@ -98,7 +98,7 @@ void MeasurementContainer::CalculateEstimatedSizeForChannels()
       for (size_t i = 0; i < size; i += step)
       {
         size_t entry_size = 0;
-        auto id = (*std::next(entry_info_set.begin(), i)).ID;
+        auto id = entry_infos[i].ID;
         hdf5_meas_->GetEntryDataSize(id, entry_size);
         ++additions;
         sum += entry_size;
@@ -188,6 +188,25 @@ bool MeasurementContainer::PublishFrame(long long index)
 
   if (frame_table_[index].publisher_info_)
   {
+    long long timestamp_usecs = -1;
+    if (use_receive_timestamp_)
+    {
+      timestamp_usecs = std::chrono::duration_cast<std::chrono::microseconds>(frame_table_[index].receive_timestamp_.time_since_epoch()).count();
+    }
+    else
+    {
+      timestamp_usecs = std::chrono::duration_cast<std::chrono::microseconds>(frame_table_[index].send_timestamp_.time_since_epoch()).count();
+    }
+
+    // Uncompressed frames are published directly from the memory mapped file
+    eCAL::eh5::SEntryDataView data_view;
+    if (hdf5_meas_->GetEntryDataView(frame_table_[index].id_, data_view))
+    {
+      frame_table_[index].publisher_info_->publisher_.Send(data_view.data, data_view.size, timestamp_usecs);
+      frame_table_[index].publisher_info_->message_counter_++;
+      return true;
+    }
+
     size_t data_size;
     if (hdf5_meas_->GetEntryDataSize(frame_table_[index].id_, data_size))
     {
@@ -206,15 +225,6 @@ bool MeasurementContainer::PublishFrame(long long index)
       }
       if (hdf5_meas_->GetEntryData(frame_table_[index].id_, send_buffer_))
       {
-        long long timestamp_usecs = -1;
-        if (use_receive_timestamp_)
-        {
-          timestamp_usecs = std::chrono::duration_cast<std::chrono::microseconds>(frame_table_[index].receive_timestamp_.time_since_epoch()).count();
-        }
-        else
-        {
-          timestamp_usecs = std::chrono::duration_cast<std::chrono::microseconds>(frame_table_[index].send_timestamp_.time_since_epoch()).count();
-        }
         // this is not supported by the eCAL v6 API
         //frame_table_[index].publisher_info_->publisher_.SetID(frame_table_[index].send_id_);
         frame_table_[index].publisher_info_->publisher_.Send(send_buffer_, data_size, timestamp_usecs);
@@ -458,19 +468,19 @@ std::map<std::string, ContinuityReport> MeasurementContainer::CreateContinuityRe
   auto channel_names = hdf5_meas_->GetChannelNames();
   for (auto& channel_name : channel_names)
   {
-    eCAL::experimental::measurement::base::EntryInfoSet entry_info_set;
-    if (hdf5_meas_->GetEntriesInfo(channel_name, entry_info_set))
+    eCAL::experimental::measurement::base::EntryInfoVect entry_infos;
+    if (hdf5_meas_->GetEntriesInfo(channel_name, entry_infos))
     {
 
-      if (!entry_info_set.empty())
+      if (!entry_infos.empty())
       {
         bool single_source = true;
-        for (auto entry_it = entry_info_set.begin(); entry_it != entry_info_set.end(); entry_it++)
+        for (auto entry_it = entry_infos.begin(); entry_it != entry_infos.end(); entry_it++)
         {
           auto this_it = entry_it;
           auto next_it = std::next(entry_it, 1);
           
-          if (!(next_it == entry_info_set.end()))
+          if (!(next_it == entry_infos.end()))
           {
             if (next_it->SndClock <= this_it->SndClock)
             {
@@ -480,8 +490,8 @@ std::map<std::string, ContinuityReport> MeasurementContainer::CreateContinuityRe
           }
         }
 
-        long long expected_frame_count = entry_info_set.rbegin()->SndClock - entry_info_set.begin()->SndClock + 1;
-        long long existing_frame_count = entry_info_set.size();
+        long long expected_frame_count = entry_infos.rbegin()->SndClock - entry_infos.begin()->SndClock + 1;
+        long long existing_frame_count = entry_infos.size();
 
         if (single_source)
         {
@@ -20,6 +20,8 @@
 #include <rec_client_core/ecal_rec.h>
 #include <rec_client_core/ecal_rec_defs.h>
 
+#include <algorithm>
+#include <cctype>
 #include <memory>
 #include <thread>
 #include <chrono>
@@ -91,6 +93,9 @@ int main(int argc, char** argv)
   TCLAP::ValueArg<std::string>  whitelist_arg      ("",  "whitelist",       "Only record these topics (Comma separated list, e.g.: \"Topic1,Topic2\")",                                                                                               false, "", "list");
   TCLAP::ValueArg<std::string>  host_filter_arg    ("f", "hosts",           "Only record a topic when it is published by any of these hosts (Comma-separated list, e.g.: \"Computer1,Computer2\")",                                                   false, "", "list");
   TCLAP::ValueArg<std::string>  addons_arg         ("",  "addons",          "Enables the given recorder addons (Comma-separated list, e.g.: \"de.conti.addon1,de.conti.addon2\"",                                                                      false, "", "list");
+  TCLAP::ValueArg<unsigned int> shard_count_arg    ("",  "shard-count",     "Distribute the topics across this many recorder clients on this host. Each of them writes its own files into the same measurement.",                                    false, 1, "count");
+  TCLAP::ValueArg<unsigned int> shard_index_arg    ("",  "shard-index",     "Index of this recorder client (0 .. shard-count - 1), when --shard-count is set.",                                                                                      false, 0, "index");
+  TCLAP::ValueArg<std::string>  shard_mode_arg     ("",  "shard-mode",      "How to distribute the topics across the recorder clients, when --shard-count is set. Either \"hash\" (default) or \"bandwidth\".",                                    false, "hash", "hash|bandwidth");
 
   // Command args
   TCLAP::SwitchArg              record_arg         ("r", "record",          "Directly start a recording. Make sure to set all necessary parameters.",                                                                                                 false);
@@ -112,6 +117,9 @@ int main(int argc, char** argv)
     &whitelist_arg,
     &host_filter_arg,
     &addons_arg,
+    &shard_count_arg,
+    &shard_index_arg,
+    &shard_mode_arg,
     &record_arg,
     &connect_to_ecal_arg,
     &meas_root_dir_arg,
@@ -249,6 +257,32 @@ int main(int argc, char** argv)
     ecal_rec->SetEnabledAddons(addons_set);
   }
 
+  //////////////////////////////////
+  // Shards
+  //////////////////////////////////
+  if (shard_count_arg.isSet())
+  {
+    eCAL::rec::ShardConfig shard_config;
+    shard_config.shard_count_ = shard_count_arg.getValue();
+    shard_config.shard_index_ = shard_index_arg.getValue();
+
+    std::string shard_mode = EcalUtils::String::Trim(shard_mode_arg.getValue());
+    std::transform(shard_mode.begin(), shard_mode.end(), shard_mode.begin(), [](char c) { return static_cast<char>(::tolower(c)); });
+    if (shard_mode == "bandwidth")
+    {
+      shard_config.mode_ = eCAL::rec::ShardConfig::Mode::Bandwidth;
+    }
+    else if (shard_mode != "hash")
+    {
+      std::cerr << "Error: Unknown shard mode \"" << shard_mode_arg.getValue() << "\". Using \"hash\"." << std::endl;
+    }
+
+    if (!ecal_rec->SetShardConfig(shard_config))
+    {
+      std::cerr << "Error: Invalid shard config. Shard index must be lower than the shard count." << std::endl;
+    }
+  }
+
   //////////////////////////////////
   // Connect to eCAL Command
   //////////////////////////////////
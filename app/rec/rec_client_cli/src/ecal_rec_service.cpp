@@ -636,6 +636,79 @@ bool EcalRecService::strToBool(const std::string& str)
     }
   }
 
+  //////////////////////////////////////
+  // compression_level                //
+  //////////////////////////////////////
+  {
+    auto it = config.items().find("compression_level");
+    if (it != config.items().end())
+    {
+      std::string compression_level_string = it->second;
+      int compression_level = 0;
+      try
+      {
+        compression_level = std::stoi(compression_level_string);
+      }
+      catch (const std::exception& e)
+      {
+        response->set_result(eCAL::pb::rec_client::ServiceResult::failed);
+        response->set_error("Error parsing value \"" + compression_level_string + "\": " + e.what());
+        return  job_config;
+      }
+
+      if ((compression_level < 0) || (compression_level > 9))
+      {
+        response->set_result(eCAL::pb::rec_client::ServiceResult::failed);
+        response->set_error("Error setting compression level to " + compression_level_string + ": Value must be between 0 and 9");
+        return job_config;
+      }
+
+      job_config.SetCompressionLevel(compression_level);
+    }
+  }
+
+  //////////////////////////////////////
+  // topic_compression_levels         //
+  //////////////////////////////////////
+  {
+    auto it = config.items().find("topic_compression_levels");
+    if (it != config.items().end())
+    {
+      std::vector<std::string> topic_compression_level_list;
+      EcalUtils::String::Split(it->second, "\n", topic_compression_level_list);
+
+      std::map<std::string, int> topic_compression_levels;
+      for (const std::string& topic_compression_level : topic_compression_level_list)
+      {
+        if (topic_compression_level.empty())
+          continue;
+
+        // Format: <level>:<topic_name>. The level comes first, as topic names may contain colons.
+        const size_t separator_pos = topic_compression_level.find(':');
+        int compression_level = -1;
+        if (separator_pos != std::string::npos)
+        {
+          try
+          {
+            compression_level = std::stoi(topic_compression_level.substr(0, separator_pos));
+          }
+          catch (const std::exception&)
+          {}
+        }
+
+        if ((compression_level < 0) || (compression_level > 9))
+        {
+          response->set_result(eCAL::pb::rec_client::ServiceResult::failed);
+          response->set_error("Error parsing topic compression level \"" + topic_compression_level + "\": Expected <level>:<topic_name> with a level between 0 and 9");
+          return job_config;
+        }
+
+        topic_compression_levels[topic_compression_level.substr(separator_pos + 1)] = compression_level;
+      }
+      job_config.SetTopicCompressionLevels(topic_compression_levels);
+    }
+  }
+
   //////////////////////////////////////
   // description                      //
   //////////////////////////////////////
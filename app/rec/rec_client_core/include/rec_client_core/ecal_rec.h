@@ -30,6 +30,7 @@
 #include <rec_client_core/topic_info.h>
 
 #include <rec_client_core/record_mode.h>
+#include <rec_client_core/shard_config.h>
 #include <rec_client_core/job_config.h>
 #include <rec_client_core/upload_config.h>
 
@@ -98,6 +99,9 @@ namespace eCAL
 
       std::set<std::string> GetListedTopics() const;
 
+      bool SetShardConfig(const ShardConfig& shard_config);
+      ShardConfig GetShardConfig() const;
+
       //////////////////////////////////////
       /// eCAL                          ////
       //////////////////////////////////////
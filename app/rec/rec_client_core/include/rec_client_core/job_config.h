@@ -21,6 +21,7 @@
 
 #include <string>
 #include <chrono>
+#include <map>
 
 namespace eCAL
 {
@@ -58,6 +59,14 @@ namespace eCAL
       void SetDescription(const std::string& description);
       std::string GetDescription() const;
 
+      // Deflate compression level of the recorded payloads (0 = uncompressed, 1-9 = fastest to smallest)
+      void SetCompressionLevel(int compression_level);
+      int GetCompressionLevel() const;
+
+      // Individual compression levels by topic name, overriding the global compression level
+      void SetTopicCompressionLevels(const std::map<std::string, int>& topic_compression_levels);
+      std::map<std::string, int> GetTopicCompressionLevels() const;
+
     //////////////////////////////
     // Evaluation
     //////////////////////////////
@@ -77,6 +86,8 @@ namespace eCAL
       int64_t      max_file_size_mb_;
       bool         one_file_per_topic_;
       std::string  description_;
+      int          compression_level_;
+      std::map<std::string, int> topic_compression_levels_;
     };
   }
 }
\ No newline at end of file
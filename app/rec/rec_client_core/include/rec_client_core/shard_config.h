@@ -0,0 +1,63 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#pragma once
+
+#include <string>
+
+namespace eCAL
+{
+  namespace rec
+  {
+    /**
+     * @brief Distribution of the recorded topics of one host across multiple recorder clients
+     *
+     * Each of the shard_count_ recorder clients on a host only records the
+     * topics assigned to its shard_index_ and writes its own HDF5 files into
+     * the host directory of the measurement. The files are merged again when
+     * reading the measurement.
+     */
+    struct ShardConfig
+    {
+      enum class Mode
+      {
+        Hash,       //!< Topics are assigned by a hash of the topic name
+        Bandwidth,  //!< Topics are assigned by the bandwidth reported by the eCAL monitoring, so all shards get a similar load
+      };
+
+      ShardConfig()
+        : shard_count_(1)
+        , shard_index_(0)
+        , mode_       (Mode::Hash)
+      {}
+
+      bool IsEnabled() const { return shard_count_ > 1; }
+
+      // The first shard writes the meta data files that exist only once per measurement / host
+      bool IsPrimary() const { return shard_index_ == 0; }
+
+      // Appended to the HDF5 file base name, so the shards don't overwrite each other's files
+      std::string GetFileBaseNameSuffix() const { return (IsEnabled() ? "_shard" + std::to_string(shard_index_) : ""); }
+
+      unsigned int shard_count_;
+      unsigned int shard_index_;
+      Mode         mode_;
+    };
+  }
+}
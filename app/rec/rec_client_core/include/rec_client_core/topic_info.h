@@ -73,6 +73,8 @@ namespace eCAL
 
       int description_quality_ = 0;
 
+      double bandwidth_ = 0.0;  //!< Sum of the bandwidth of all publishers in bytes per second, as reported by the eCAL monitoring
+
       std::map<std::string, std::set<std::string>> publishers_;
     };
   }
@@ -156,6 +156,16 @@ namespace eCAL
       return recorder_->GetListedTopics();
     }
 
+    bool EcalRec::SetShardConfig(const ShardConfig& shard_config)
+    {
+      return recorder_->SetShardConfig(shard_config);
+    }
+
+    ShardConfig EcalRec::GetShardConfig() const
+    {
+      return recorder_->GetShardConfig();
+    }
+
     //////////////////////////////////////
     /// eCAL                          ////
     //////////////////////////////////////
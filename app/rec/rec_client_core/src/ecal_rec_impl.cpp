@@ -30,6 +30,7 @@
 #include <monitoring_thread.h>
 
 #include "addons/addon_manager.h"
+#include "shard_assignment.h"
 
 #include <sstream>
 #include <iomanip>
@@ -44,6 +45,13 @@ namespace eCAL
 {
   namespace rec
   {
+    namespace
+    {
+      // Time that a topic that moved to another shard is still recorded by the old shard.
+      // The new shard evaluates its topics every second and then needs to connect.
+      const std::chrono::steady_clock::duration shard_handover_time = std::chrono::seconds(5);
+    }
+
     EcalRecImpl::EcalRecImpl()
       : addon_manager_(std::make_unique<AddonManager>([this](int64_t job_id, const std::string& addon_id, const RecAddonJobStatus& job_status)
                                                       {
@@ -61,6 +69,7 @@ namespace eCAL
       , pre_buffer_            (false, std::chrono::steady_clock::duration(0))
       , connected_to_ecal_     (false)
       , record_mode_           (RecordMode::All)
+      , shard_handover_        (shard_handover_time)
     {
       garbage_collector_trigger_thread_ = std::make_unique<GarbageCollectorTriggerThread>(*this);
       garbage_collector_trigger_thread_->Start();
@@ -181,7 +190,7 @@ namespace eCAL
           EcalRecLogger::Instance()->info(ss.str());
 
           // Create the job
-          record_job_history_.emplace_back(evaluated_job_config);
+          record_job_history_.emplace_back(evaluated_job_config, shard_config_);
 
           if (!record_job_history_.back().InitializeMeasurementDirectory())
           {
@@ -285,7 +294,7 @@ namespace eCAL
         }
 
         // Create the job
-        record_job_history_.emplace_back(evaluated_job_config);
+        record_job_history_.emplace_back(evaluated_job_config, shard_config_);
 
         if (!record_job_history_.back().InitializeMeasurementDirectory())
         {
@@ -628,6 +637,77 @@ namespace eCAL
       return listed_topics_;
     }
 
+    bool EcalRecImpl::SetShardConfig(const ShardConfig& shard_config)
+    {
+      bool success = false;
+
+      if ((shard_config.shard_count_ == 0) || (shard_config.shard_index_ >= shard_config.shard_count_))
+      {
+        const std::string error_message = "Unable to set shard config: Shard index " + std::to_string(shard_config.shard_index_) + " is invalid for a shard count of " + std::to_string(shard_config.shard_count_);
+        info_ = { false, error_message };
+        EcalRecLogger::Instance()->error(error_message);
+        return false;
+      }
+
+      {
+        std::lock(ecal_mutex_, recorder_mutex_);
+        std::lock_guard<decltype(ecal_mutex_)>     ecal_lock    (ecal_mutex_,     std::adopt_lock);
+        std::unique_lock<decltype(recorder_mutex_)> recorder_lock(recorder_mutex_, std::adopt_lock);
+
+        if (recording_recorder_job_ && (recording_recorder_job_->GetMainRecorderState() == JobState::Recording))
+        {
+          // We cannot switch the shard while recording, as this would influence the current recording
+          success = false;
+        }
+        else
+        {
+          shard_config_ = shard_config;
+          pre_buffer_.clear();
+
+          // Drop all subscribers, so the topics are re-distributed from scratch
+          // instead of sticking to the subscriptions of the old shard config
+          subscriber_map_.clear();
+          shard_handover_.Clear();
+          success = true;
+        }
+      }
+
+      // Log a status
+      if (success)
+      {
+        if (shard_config.IsEnabled())
+        {
+          EcalRecLogger::Instance()->info("Shard:                 " + std::to_string(shard_config.shard_index_) + " of " + std::to_string(shard_config.shard_count_)
+                                          + (shard_config.mode_ == ShardConfig::Mode::Bandwidth ? " (by bandwidth)" : " (by hash)"));
+        }
+        else
+        {
+          EcalRecLogger::Instance()->info("Shard:                 Disabled");
+        }
+        info_ = { true, "" };
+      }
+      else
+      {
+        const std::string error_message = "Unable to set shard config";
+        info_ = { false, error_message };
+        EcalRecLogger::Instance()->error(error_message);
+      }
+
+      // Update eCAL subscribers if necessary
+      if (success && connected_to_ecal_)
+      {
+        UpdateAndCleanSubscribers();
+      }
+
+      return success;
+    }
+
+    ShardConfig EcalRecImpl::GetShardConfig() const
+    {
+      std::lock_guard<decltype(ecal_mutex_)> ecal_lock(ecal_mutex_);
+      return shard_config_;
+    }
+
     //////////////////////////////////////
     /// eCAL                          ////
     //////////////////////////////////////
@@ -663,6 +743,7 @@ namespace eCAL
           EcalRecLogger::Instance()->info("Disconnecting from eCAL");
 
           subscriber_map_.clear();
+          shard_handover_.Clear();
           connected_to_ecal_ = false;
         }
       }
@@ -731,6 +812,7 @@ namespace eCAL
         {
           auto filtered_topics = FilterAvailableTopics_NoLock(topic_info_map);
           CreateNewSubscribers_NoLock(filtered_topics);
+          RemoveHandedOverSubscribers_NoLock();
         }
       }
 
@@ -760,9 +842,10 @@ namespace eCAL
       auto filtered_topic_set = FilterAvailableTopics_NoLock(topic_info_map);
       CreateNewSubscribers_NoLock(filtered_topic_set);
       RemoveOldSubscribers_NoLock(filtered_topic_set);
+      RemoveHandedOverSubscribers_NoLock();
     }
 
-    std::set<std::string> EcalRecImpl::FilterAvailableTopics_NoLock(const std::map<std::string, TopicInfo>& topic_info_map) const
+    std::set<std::string> EcalRecImpl::FilterAvailableTopics_NoLock(const std::map<std::string, TopicInfo>& topic_info_map)
     {
       std::set<std::string> topic_set;
 
@@ -811,9 +894,36 @@ namespace eCAL
         topic_set.emplace(topic_info.first);
       }
 
+      if (shard_config_.IsEnabled())
+      {
+        return FilterShardTopics_NoLock(topic_set, topic_info_map);
+      }
+
       return topic_set;
     }
 
+    std::set<std::string> EcalRecImpl::FilterShardTopics_NoLock(const std::set<std::string>& topic_set, const std::map<std::string, TopicInfo>& topic_info_map)
+    {
+      // All recorders of a host have to come to the same result independently,
+      // so the assignment is always computed over the full topic set
+      std::set<std::string> shard_topic_set = GetShardTopics(topic_set, topic_info_map, shard_config_);
+
+      // Topics that we already subscribed to may have moved to another shard
+      // with the bandwidth. We keep recording them while the other recorder is
+      // taking over, so no data is lost. After the handover time, they are dropped.
+      std::set<std::string> subscribed_topic_set;
+      for (const std::string& topic : topic_set)
+      {
+        if (subscriber_map_.find(topic) != subscriber_map_.end())
+          subscribed_topic_set.emplace(topic);
+      }
+
+      const std::set<std::string> handover_topic_set = shard_handover_.GetHandoverTopics(shard_topic_set, subscribed_topic_set, std::chrono::steady_clock::now());
+      shard_topic_set.insert(handover_topic_set.begin(), handover_topic_set.end());
+
+      return shard_topic_set;
+    }
+
     void EcalRecImpl::CreateNewSubscribers_NoLock(const std::set<std::string>& topic_set)
     {
       for (const std::string& topic : topic_set)
@@ -852,6 +962,19 @@ namespace eCAL
       }
     }
 
+    void EcalRecImpl::RemoveHandedOverSubscribers_NoLock()
+    {
+      for (const std::string& topic : shard_handover_.TakeExpiredTopics())
+      {
+        auto subscriber_it = subscriber_map_.find(topic);
+        if (subscriber_it != subscriber_map_.end())
+        {
+          EcalRecLogger::Instance()->info("Unsubscribing from " + topic + " (recorded by another shard now)");
+          subscriber_map_.erase(subscriber_it);
+        }
+      }
+    }
+
     bool EcalRecImpl::StopRecording_NoLock()
     {
       if ((recording_recorder_job_ == nullptr)
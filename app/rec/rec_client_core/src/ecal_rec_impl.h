@@ -33,12 +33,14 @@
 #include <rec_client_core/state.h>
 #include <rec_client_core/topic_info.h>
 #include <rec_client_core/record_mode.h>
+#include <rec_client_core/shard_config.h>
 #include <rec_client_core/job_config.h>
 #include <rec_client_core/upload_config.h>
 
 #include "job/record_job.h"
 
 #include "frame_buffer.h"
+#include "shard_assignment.h"
 
 #include <ecal/pubsub/subscriber.h>
 
@@ -102,6 +104,10 @@ namespace eCAL
 
       std::set<std::string> GetListedTopics() const;
 
+      bool SetShardConfig(const ShardConfig& shard_config);
+
+      ShardConfig GetShardConfig() const;
+
       //////////////////////////////////////
       //// eCAL                         ////
       //////////////////////////////////////
@@ -129,10 +135,12 @@ namespace eCAL
     private:
       void UpdateAndCleanSubscribers();
 
-      std::set<std::string> FilterAvailableTopics_NoLock(const std::map<std::string, TopicInfo>& topic_info_map) const;
+      std::set<std::string> FilterAvailableTopics_NoLock(const std::map<std::string, TopicInfo>& topic_info_map);
+      std::set<std::string> FilterShardTopics_NoLock(const std::set<std::string>& topic_set, const std::map<std::string, TopicInfo>& topic_info_map);
 
       void CreateNewSubscribers_NoLock(const std::set<std::string>& topic_set);
       void RemoveOldSubscribers_NoLock(const std::set<std::string>& topic_set);
+      void RemoveHandedOverSubscribers_NoLock();
 
       bool StopRecording_NoLock();
       Error IsAnyJobUsingPath_NoLock(const std::string& path) const;
@@ -164,6 +172,8 @@ namespace eCAL
       RecordMode                                                record_mode_;       /**< All / Blacklist / Whitelist */
       std::set<std::string>                                     listed_topics_;     /**< When in Blacklist or Whitelist mode, this list holds the according topic list */
       std::set<std::string>                                     hosts_filter_;      /**< Only subscribe to topics published by there hosts*/
+      ShardConfig                                               shard_config_;      /**< Only subscribe to the topics assigned to this recorder's shard */
+      ShardHandover                                             shard_handover_;    /**< Topics that moved to another shard are only kept for a limited time */
     };
   }
 }
\ No newline at end of file
@@ -23,6 +23,22 @@
 
 #include <ecal_utils/filesystem.h>
 
+#include <algorithm>
+
+namespace
+{
+  eCAL::eh5::SCompressionSettings ToCompressionSettings(int compression_level)
+  {
+    eCAL::eh5::SCompressionSettings settings;
+    if (compression_level > 0)
+    {
+      settings.type  = eCAL::eh5::eCompressionType::DEFLATE;
+      settings.level = std::min(compression_level, 9);
+    }
+    return settings;
+  }
+}
+
 namespace eCAL
 {
   namespace rec
@@ -32,9 +48,10 @@ namespace eCAL
     // Constructor & Destructor
     ///////////////////////////////
 
-    Hdf5WriterThread::Hdf5WriterThread(const JobConfig& job_config, const std::map<std::string, TopicInfo>& initial_topic_info_map, const std::deque<std::shared_ptr<Frame>>& initial_frame_buffer)
+    Hdf5WriterThread::Hdf5WriterThread(const JobConfig& job_config, const ShardConfig& shard_config, const std::map<std::string, TopicInfo>& initial_topic_info_map, const std::deque<std::shared_ptr<Frame>>& initial_frame_buffer)
       : InterruptibleThread          ()
       , job_config_                  (job_config)
+      , shard_config_                (shard_config)
       , frame_buffer_                (initial_frame_buffer)
       , written_frames_              (0)
       , new_topic_info_map_          (initial_topic_info_map)
@@ -259,8 +276,11 @@ namespace eCAL
       std::string host_name = eCAL::Process::GetHostName();
       std::string hdf5_dir  = EcalUtils::Filesystem::ToNativeSeperators(job_config_.GetCompleteMeasurementPath() + "/" + host_name);
 
+      // All shards of a host write into the same directory. The reader merges their files again.
+      std::string base_name = host_name + shard_config_.GetFileBaseNameSuffix();
+
 #ifndef NDEBUG
-      EcalRecLogger::Instance()->debug("Hdf5WriterThread::Open(): hdf5_dir: \"" + hdf5_dir + "\", base_name: \"" + host_name + "\"");
+      EcalRecLogger::Instance()->debug("Hdf5WriterThread::Open(): hdf5_dir: \"" + hdf5_dir + "\", base_name: \"" + base_name + "\"");
 #endif // NDEBUG
       std::unique_lock<decltype(hdf5_writer_mutex_)> hdf5_writer_lock(hdf5_writer_mutex_);
 
@@ -270,9 +290,17 @@ namespace eCAL
         EcalRecLogger::Instance()->debug("Hdf5WriterThread::Open(): Successfully opened HDF5-Writer with path \"" + hdf5_dir + "\"");
 #endif // NDEBUG
 
-        hdf5_writer_->SetFileBaseName(host_name);
+        hdf5_writer_->SetFileBaseName(base_name);
         hdf5_writer_->SetMaxSizePerFile(job_config_.GetMaxFileSize());
         hdf5_writer_->SetOneFilePerChannelEnabled(job_config_.GetOneFilePerTopicEnabled());
+
+        // Payloads are compressed by the writer's worker threads, so the
+        // compression does not slow down the recording itself
+        hdf5_writer_->SetCompression(ToCompressionSettings(job_config_.GetCompressionLevel()));
+        for (const auto& topic_compression_level : job_config_.GetTopicCompressionLevels())
+        {
+          hdf5_writer_->SetChannelCompression(topic_compression_level.first, ToCompressionSettings(topic_compression_level.second));
+        }
       }
       else
       {
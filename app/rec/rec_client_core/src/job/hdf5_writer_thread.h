@@ -28,6 +28,7 @@
 
 #include "frame.h"
 #include "rec_client_core/job_config.h"
+#include "rec_client_core/shard_config.h"
 #include "rec_client_core/topic_info.h"
 #include "rec_client_core/state.h"
 
@@ -41,7 +42,7 @@ namespace eCAL
     // Constructor & Destructor
     ///////////////////////////////
     public:
-      Hdf5WriterThread(const JobConfig& job_config, const std::map<std::string, TopicInfo>& initial_topic_info_map = {}, const std::deque<std::shared_ptr<Frame>>& initial_frame_buffer = {});
+      Hdf5WriterThread(const JobConfig& job_config, const ShardConfig& shard_config, const std::map<std::string, TopicInfo>& initial_topic_info_map = {}, const std::deque<std::shared_ptr<Frame>>& initial_frame_buffer = {});
 
       ~Hdf5WriterThread();
 
@@ -81,7 +82,8 @@ namespace eCAL
     // Member Variables
     ///////////////////////////////
     private:
-      JobConfig job_config_;
+      JobConfig   job_config_;
+      ShardConfig shard_config_;
 
       mutable std::mutex                    input_mutex_;                       /**< Mutex protecting every input variables (notably the variables below). */
       mutable std::condition_variable       input_cv_;                          /**< condition variable for notifying the internal worker thread that new input data is available */
@@ -49,8 +49,9 @@ namespace eCAL
     // Constructor & Destructor
     ///////////////////////////////////////////////
 
-    RecordJob::RecordJob(const JobConfig& evaluated_job_config)
+    RecordJob::RecordJob(const JobConfig& evaluated_job_config, const ShardConfig& shard_config)
       : job_config_         (evaluated_job_config)
+      , shard_config_       (shard_config)
       , main_recorder_state_(JobState::NotStarted)
       , safe_to_delete_dir_ (false)
       , is_deleted_         (false)
@@ -138,6 +139,7 @@ namespace eCAL
         }
 
         // Create system_information.txt
+        if (shard_config_.IsPrimary())
         {
           std::string system_information_path = hostname_dir + "/system_information.txt";
 
@@ -169,6 +171,7 @@ namespace eCAL
 #define CopyFile_6376c040f4f54106b205ef6ddbb2090a CopyFile
 #undef CopyFile
 #endif // CopyFile
+        if (shard_config_.IsPrimary())
         {
           std::string ecal_ini_original_path = eCAL::Config::GetLoadedEcalIniPath();
 
@@ -205,6 +208,7 @@ namespace eCAL
       }
 
       // .ecalmeas file
+      if (shard_config_.IsPrimary())
       {
         // Get the last dirname of the complete measurement path and use it as meas name
         std::vector<std::string> path_components = EcalUtils::Filesystem::CleanPathComponentList(measurement_path);
@@ -251,6 +255,7 @@ namespace eCAL
       }
 
       // description.txt file
+      if (shard_config_.IsPrimary())
       {
         std::string relative_description_path = "doc/description.txt";
         std::string full_path = EcalUtils::Filesystem::ToNativeSeperators(measurement_path + "/" + relative_description_path);
@@ -292,7 +297,7 @@ namespace eCAL
         return false;
       }
 
-      hdf5_writer_thread_ = std::make_unique<Hdf5WriterThread>(job_config_, initial_topic_info_map, initial_frame_buffer);
+      hdf5_writer_thread_ = std::make_unique<Hdf5WriterThread>(job_config_, shard_config_, initial_topic_info_map, initial_frame_buffer);
       hdf5_writer_thread_->Start();
 
       main_recorder_state_ = JobState::Recording;
@@ -326,7 +331,7 @@ namespace eCAL
         return false;
       }
 
-      hdf5_writer_thread_ = std::make_unique<Hdf5WriterThread>(job_config_, topic_info_map, frame_buffer);
+      hdf5_writer_thread_ = std::make_unique<Hdf5WriterThread>(job_config_, shard_config_, topic_info_map, frame_buffer);
       hdf5_writer_thread_->Flush();
       hdf5_writer_thread_->Start();
 
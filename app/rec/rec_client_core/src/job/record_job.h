@@ -29,6 +29,7 @@
 
 #include <rec_client_core/state.h>
 #include <rec_client_core/job_config.h>
+#include <rec_client_core/shard_config.h>
 #include <rec_client_core/upload_config.h>
 #include <rec_client_core/topic_info.h>
 
@@ -55,7 +56,7 @@ namespace eCAL
     // Constructor & Destructor
     ///////////////////////////////////////////////
     public:
-      RecordJob(const JobConfig& evaluated_job_config);
+      RecordJob(const JobConfig& evaluated_job_config, const ShardConfig& shard_config = ShardConfig());
       ~RecordJob();
       void Interrupt();
 
@@ -107,6 +108,7 @@ namespace eCAL
       mutable std::shared_timed_mutex          job_mutex_;
 
       const JobConfig                          job_config_;
+      const ShardConfig                        shard_config_;
       std::unique_ptr<Hdf5WriterThread>        hdf5_writer_thread_;
 
 #ifdef ECAL_HAS_CURL
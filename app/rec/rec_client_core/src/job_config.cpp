@@ -34,6 +34,7 @@ namespace eCAL
       : job_id_(0)
       , max_file_size_mb_(1000)
       , one_file_per_topic_(false)
+      , compression_level_(0)
     {}
 
     JobConfig::~JobConfig()
@@ -78,6 +79,12 @@ namespace eCAL
     void            JobConfig::SetDescription           (const std::string& description)   { description_ = description; }
     std::string     JobConfig::GetDescription           () const                           { return description_; }
 
+    void            JobConfig::SetCompressionLevel      (int compression_level)            { compression_level_ = compression_level; }
+    int             JobConfig::GetCompressionLevel      () const                           { return compression_level_; }
+
+    void                       JobConfig::SetTopicCompressionLevels(const std::map<std::string, int>& topic_compression_levels) { topic_compression_levels_ = topic_compression_levels; }
+    std::map<std::string, int> JobConfig::GetTopicCompressionLevels() const                                                      { return topic_compression_levels_; }
+
     //////////////////////////////
     // Evaluation
     //////////////////////////////
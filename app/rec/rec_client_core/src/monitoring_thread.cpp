@@ -62,10 +62,11 @@ namespace eCAL
         {
           std::lock_guard<decltype(monitoring_mutex_)> monitoring_lock(monitoring_mutex_);
 
-          // Clear publisher lists of all topics
+          // Clear publisher lists and bandwidths of all topics
           for (auto& topic_info : topic_info_map_)
           {
             topic_info.second.publishers_.clear();
+            topic_info.second.bandwidth_ = 0.0;
           }
 
           // Collect all descriptors
@@ -105,6 +106,9 @@ namespace eCAL
             {
               this_topic_info_quality |= INFO_COMES_FROM_PUBLISHER_QUALITYBIT;
 
+              // The data frequency is given in mHz
+              topic_info_map_it->second.bandwidth_ += static_cast<double>(topic.topic_size()) * static_cast<double>(topic.data_frequency()) / 1000.0;
+
               // Also update the publisher list
               auto existing_publisher_it = topic_info_map_it->second.publishers_.find(topic.host_name());
               if (existing_publisher_it != topic_info_map_it->second.publishers_.end())
@@ -0,0 +1,166 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include "shard_assignment.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+
+namespace eCAL
+{
+  namespace rec
+  {
+    namespace
+    {
+      // std::hash is not guaranteed to be stable across processes, so we use FNV-1a
+      uint64_t TopicHash(const std::string& topic_name)
+      {
+        uint64_t hash = 14695981039346656037ull;
+        for (const char c : topic_name)
+        {
+          hash ^= static_cast<uint8_t>(c);
+          hash *= 1099511628211ull;
+        }
+        return hash;
+      }
+    }
+
+    std::set<std::string> GetShardTopics(const std::set<std::string>& topic_set, const std::map<std::string, TopicInfo>& topic_info_map, const ShardConfig& shard_config)
+    {
+      std::set<std::string> shard_topic_set;
+
+      // Topics with an unknown bandwidth are assigned by their hash
+      struct WeightedTopic
+      {
+        int         bandwidth_class;
+        uint64_t    hash;
+        std::string name;
+      };
+      std::vector<WeightedTopic> weighted_topics;
+
+      for (const std::string& topic : topic_set)
+      {
+        double bandwidth = 0.0;
+        if (shard_config.mode_ == ShardConfig::Mode::Bandwidth)
+        {
+          auto topic_info_it = topic_info_map.find(topic);
+          if (topic_info_it != topic_info_map.end())
+            bandwidth = topic_info_it->second.bandwidth_;
+        }
+
+        if (bandwidth < 1.0)
+        {
+          if ((TopicHash(topic) % shard_config.shard_count_) == shard_config.shard_index_)
+            shard_topic_set.emplace(topic);
+        }
+        else
+        {
+          // The bandwidth is quantized to powers of two, so small fluctuations
+          // don't cause all recorders to re-distribute the topics
+          int bandwidth_class = 0;
+          std::frexp(bandwidth, &bandwidth_class);
+          weighted_topics.push_back(WeightedTopic{ bandwidth_class, TopicHash(topic), topic });
+        }
+      }
+
+      if (!weighted_topics.empty())
+      {
+        // Longest-processing-time-first: Assign the largest topic to the
+        // shard with the least load
+        std::sort(weighted_topics.begin(), weighted_topics.end(),
+                  [](const WeightedTopic& lhs, const WeightedTopic& rhs) -> bool
+                  {
+                    if (lhs.bandwidth_class != rhs.bandwidth_class) return lhs.bandwidth_class > rhs.bandwidth_class;
+                    if (lhs.hash            != rhs.hash)            return lhs.hash            < rhs.hash;
+                    return lhs.name < rhs.name;
+                  });
+
+        std::vector<double> shard_load(shard_config.shard_count_, 0.0);
+        for (const auto& weighted_topic : weighted_topics)
+        {
+          const size_t shard_index = static_cast<size_t>(std::distance(shard_load.begin(), std::min_element(shard_load.begin(), shard_load.end())));
+          shard_load[shard_index] += std::ldexp(1.0, weighted_topic.bandwidth_class);
+
+          if (shard_index == shard_config.shard_index_)
+            shard_topic_set.emplace(weighted_topic.name);
+        }
+      }
+
+      return shard_topic_set;
+    }
+
+    ShardHandover::ShardHandover(std::chrono::steady_clock::duration handover_time)
+      : handover_time_(handover_time)
+    {}
+
+    std::set<std::string> ShardHandover::GetHandoverTopics(const std::set<std::string>& shard_topic_set, const std::set<std::string>& subscribed_topic_set, std::chrono::steady_clock::time_point now)
+    {
+      std::set<std::string> handover_topics;
+
+      // Forget topics that are assigned to us again or that we don't subscribe to anymore
+      for (auto it = unassigned_since_.begin(); it != unassigned_since_.end();)
+      {
+        if ((shard_topic_set.find(it->first) != shard_topic_set.end())
+          || (subscribed_topic_set.find(it->first) == subscribed_topic_set.end()))
+        {
+          it = unassigned_since_.erase(it);
+        }
+        else
+        {
+          it++;
+        }
+      }
+
+      for (const std::string& topic : subscribed_topic_set)
+      {
+        if (shard_topic_set.find(topic) != shard_topic_set.end())
+          continue;
+
+        auto unassigned_since_it = unassigned_since_.emplace(topic, now).first;
+        if (now - unassigned_since_it->second < handover_time_)
+        {
+          handover_topics.emplace(topic);
+        }
+        else
+        {
+          expired_topics_.emplace(topic);
+          unassigned_since_.erase(unassigned_since_it);
+        }
+      }
+
+      return handover_topics;
+    }
+
+    std::set<std::string> ShardHandover::TakeExpiredTopics()
+    {
+      std::set<std::string> expired_topics;
+      expired_topics.swap(expired_topics_);
+      return expired_topics;
+    }
+
+    void ShardHandover::Clear()
+    {
+      unassigned_since_.clear();
+      expired_topics_.clear();
+    }
+  }
+}
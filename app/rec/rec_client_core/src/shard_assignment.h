@@ -0,0 +1,80 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#pragma once
+
+#include <chrono>
+#include <map>
+#include <set>
+#include <string>
+
+#include <rec_client_core/shard_config.h>
+#include <rec_client_core/topic_info.h>
+
+namespace eCAL
+{
+  namespace rec
+  {
+    /**
+     * @brief Returns the topics of topic_set that are assigned to the shard of shard_config
+     *
+     * The assignment only depends on the topic names and (in bandwidth mode)
+     * the bandwidth from topic_info_map. All recorders of a host that
+     * evaluate the same input therefore come to complementary results: every
+     * topic is assigned to exactly one shard.
+     */
+    std::set<std::string> GetShardTopics(const std::set<std::string>& topic_set, const std::map<std::string, TopicInfo>& topic_info_map, const ShardConfig& shard_config);
+
+    /**
+     * @brief Keeps subscriptions of topics that moved to another shard for a limited time
+     *
+     * In bandwidth mode the assignment of a topic can change. The shard that
+     * takes over a topic needs some time to subscribe to it, so the old shard
+     * keeps recording it for the handover time. After that, the topic is
+     * dropped, so it is only recorded by one shard.
+     *
+     * Not thread-safe
+     */
+    class ShardHandover
+    {
+    public:
+      explicit ShardHandover(std::chrono::steady_clock::duration handover_time);
+
+      /**
+       * @brief Returns the subscribed topics that are not assigned to this shard anymore, but still in their handover time
+       *
+       * Topics whose handover time expired are remembered until they are
+       * taken with TakeExpiredTopics().
+       */
+      std::set<std::string> GetHandoverTopics(const std::set<std::string>& shard_topic_set, const std::set<std::string>& subscribed_topic_set, std::chrono::steady_clock::time_point now);
+
+      /**
+       * @brief Returns the topics whose handover time expired and forgets them
+       */
+      std::set<std::string> TakeExpiredTopics();
+
+      void Clear();
+
+    private:
+      std::chrono::steady_clock::duration                          handover_time_;
+      std::map<std::string, std::chrono::steady_clock::time_point> unassigned_since_;
+      std::set<std::string>                                        expired_topics_;
+    };
+  }
+}
@@ -0,0 +1,234 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include <gtest/gtest.h>
+
+#include <shard_assignment.h>
+
+#include <chrono>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace
+{
+  // Runs all shards over the same input, like the recorders of one host do
+  std::vector<std::set<std::string>> AssignAllShards(const std::set<std::string>& topic_set, const std::map<std::string, eCAL::rec::TopicInfo>& topic_info_map, unsigned int shard_count, eCAL::rec::ShardConfig::Mode mode)
+  {
+    std::vector<std::set<std::string>> shard_topics;
+    for (unsigned int shard_index = 0; shard_index < shard_count; shard_index++)
+    {
+      eCAL::rec::ShardConfig shard_config;
+      shard_config.shard_count_ = shard_count;
+      shard_config.shard_index_ = shard_index;
+      shard_config.mode_        = mode;
+      shard_topics.push_back(eCAL::rec::GetShardTopics(topic_set, topic_info_map, shard_config));
+    }
+    return shard_topics;
+  }
+
+  // Every topic must be recorded by exactly one shard
+  void ExpectPartition(const std::set<std::string>& topic_set, const std::vector<std::set<std::string>>& shard_topics)
+  {
+    std::map<std::string, int> owner_count;
+    for (const auto& topics : shard_topics)
+    {
+      for (const auto& topic : topics)
+      {
+        EXPECT_EQ(topic_set.count(topic), 1u) << topic;
+        owner_count[topic]++;
+      }
+    }
+
+    for (const auto& topic : topic_set)
+      EXPECT_EQ(owner_count[topic], 1) << topic;
+  }
+
+  // Subscribes to topics like the recorder does: the assigned topics plus the ones still in their handover time
+  struct SimulatedShardRecorder
+  {
+    SimulatedShardRecorder(unsigned int shard_index, unsigned int shard_count, std::chrono::steady_clock::duration handover_time)
+      : shard_handover(handover_time)
+    {
+      shard_config.shard_count_ = shard_count;
+      shard_config.shard_index_ = shard_index;
+      shard_config.mode_        = eCAL::rec::ShardConfig::Mode::Bandwidth;
+    }
+
+    void Update(const std::set<std::string>& topic_set, const std::map<std::string, eCAL::rec::TopicInfo>& topic_info_map, std::chrono::steady_clock::time_point now)
+    {
+      std::set<std::string> shard_topic_set = eCAL::rec::GetShardTopics(topic_set, topic_info_map, shard_config);
+      const std::set<std::string> handover_topic_set = shard_handover.GetHandoverTopics(shard_topic_set, subscribed_topics, now);
+      shard_topic_set.insert(handover_topic_set.begin(), handover_topic_set.end());
+
+      for (const auto& topic : shard_handover.TakeExpiredTopics())
+        EXPECT_EQ(shard_topic_set.count(topic), 0u) << topic;
+
+      subscribed_topics = shard_topic_set;
+    }
+
+    eCAL::rec::ShardConfig     shard_config;
+    eCAL::rec::ShardHandover   shard_handover;
+    std::set<std::string>      subscribed_topics;
+  };
+}
+
+TEST(rec_shard, Hash_CoversAllTopics)
+{
+  std::set<std::string> topic_set;
+  for (int i = 0; i < 100; i++)
+    topic_set.emplace("topic_" + std::to_string(i));
+
+  for (unsigned int shard_count = 2; shard_count <= 5; shard_count++)
+  {
+    const auto shard_topics = AssignAllShards(topic_set, {}, shard_count, eCAL::rec::ShardConfig::Mode::Hash);
+    ExpectPartition(topic_set, shard_topics);
+  }
+}
+
+TEST(rec_shard, Bandwidth_CoversAllTopics)
+{
+  std::set<std::string>                         topic_set;
+  std::map<std::string, eCAL::rec::TopicInfo>   topic_info_map;
+  for (int i = 0; i < 100; i++)
+  {
+    const std::string topic = "topic_" + std::to_string(i);
+    topic_set.emplace(topic);
+
+    // Mix of topics with and without a known bandwidth
+    if (i % 3 != 0)
+      topic_info_map[topic].bandwidth_ = 1000.0 * (i + 1) * (i + 1);
+  }
+
+  for (unsigned int shard_count = 2; shard_count <= 5; shard_count++)
+  {
+    const auto shard_topics = AssignAllShards(topic_set, topic_info_map, shard_count, eCAL::rec::ShardConfig::Mode::Bandwidth);
+    ExpectPartition(topic_set, shard_topics);
+  }
+}
+
+TEST(rec_shard, Bandwidth_BalancesLoad)
+{
+  std::set<std::string>                         topic_set;
+  std::map<std::string, eCAL::rec::TopicInfo>   topic_info_map;
+
+  // Two large topics and many small ones: the large topics must end up in different shards
+  for (const std::string topic : { "camera_front", "camera_rear" })
+  {
+    topic_set.emplace(topic);
+    topic_info_map[topic].bandwidth_ = 100.0 * 1024 * 1024;
+  }
+  for (int i = 0; i < 20; i++)
+  {
+    const std::string topic = "small_" + std::to_string(i);
+    topic_set.emplace(topic);
+    topic_info_map[topic].bandwidth_ = 1024.0;
+  }
+
+  const auto shard_topics = AssignAllShards(topic_set, topic_info_map, 2, eCAL::rec::ShardConfig::Mode::Bandwidth);
+  ExpectPartition(topic_set, shard_topics);
+
+  EXPECT_NE(shard_topics[0].count("camera_front"), shard_topics[0].count("camera_rear"));
+}
+
+TEST(rec_shard, Handover_ReassignedTopicIsDroppedByOldShard)
+{
+  const unsigned int                        shard_count   = 2;
+  const std::chrono::steady_clock::duration handover_time = std::chrono::seconds(5);
+
+  std::set<std::string>                         topic_set { "large", "medium", "small" };
+  std::map<std::string, eCAL::rec::TopicInfo>   topic_info_map;
+  topic_info_map["large"] .bandwidth_ = 1024.0 * 1024;
+  topic_info_map["medium"].bandwidth_ = 1024.0;
+  topic_info_map["small"] .bandwidth_ = 128.0;
+
+  std::vector<SimulatedShardRecorder> recorders;
+  for (unsigned int shard_index = 0; shard_index < shard_count; shard_index++)
+    recorders.emplace_back(shard_index, shard_count, handover_time);
+
+  auto now = std::chrono::steady_clock::now();
+  for (auto& recorder : recorders)
+    recorder.Update(topic_set, topic_info_map, now);
+
+  const auto assignment_before = AssignAllShards(topic_set, topic_info_map, shard_count, eCAL::rec::ShardConfig::Mode::Bandwidth);
+
+  // The medium topic becomes the largest one, so the topics are re-distributed
+  topic_info_map["medium"].bandwidth_ = 1024.0 * 1024 * 1024;
+  const auto assignment_after = AssignAllShards(topic_set, topic_info_map, shard_count, eCAL::rec::ShardConfig::Mode::Bandwidth);
+
+  std::set<std::string> moved_topics;
+  for (const auto& topic : topic_set)
+  {
+    for (unsigned int shard_index = 0; shard_index < shard_count; shard_index++)
+    {
+      if ((assignment_before[shard_index].count(topic) == 1) && (assignment_after[shard_index].count(topic) == 0))
+        moved_topics.emplace(topic);
+    }
+  }
+  ASSERT_FALSE(moved_topics.empty());
+
+  // During the handover, the moved topics are recorded by both shards
+  for (int i = 0; i < 4; i++)
+  {
+    now += std::chrono::seconds(1);
+    for (auto& recorder : recorders)
+      recorder.Update(topic_set, topic_info_map, now);
+
+    for (const auto& topic : moved_topics)
+    {
+      for (auto& recorder : recorders)
+        EXPECT_EQ(recorder.subscribed_topics.count(topic), 1u) << topic;
+    }
+  }
+
+  // After the handover time, every topic is only recorded by one shard again
+  now += std::chrono::seconds(2);
+  std::vector<std::set<std::string>> subscribed_topics;
+  for (auto& recorder : recorders)
+  {
+    recorder.Update(topic_set, topic_info_map, now);
+    subscribed_topics.push_back(recorder.subscribed_topics);
+  }
+  ExpectPartition(topic_set, subscribed_topics);
+  EXPECT_EQ(subscribed_topics, assignment_after);
+}
+
+TEST(rec_shard, Handover_TopicAssignedAgainIsKept)
+{
+  eCAL::rec::ShardHandover shard_handover(std::chrono::seconds(5));
+  auto now = std::chrono::steady_clock::now();
+
+  // The topic moves away and comes back within the handover time
+  EXPECT_EQ(shard_handover.GetHandoverTopics({}, { "topic" }, now), std::set<std::string>{ "topic" });
+  now += std::chrono::seconds(3);
+  EXPECT_TRUE(shard_handover.GetHandoverTopics({ "topic" }, { "topic" }, now).empty());
+
+  // Moving away again starts a new handover time
+  now += std::chrono::seconds(3);
+  EXPECT_EQ(shard_handover.GetHandoverTopics({}, { "topic" }, now), std::set<std::string>{ "topic" });
+  now += std::chrono::seconds(3);
+  EXPECT_EQ(shard_handover.GetHandoverTopics({}, { "topic" }, now), std::set<std::string>{ "topic" });
+  EXPECT_TRUE(shard_handover.TakeExpiredTopics().empty());
+
+  now += std::chrono::seconds(3);
+  EXPECT_TRUE(shard_handover.GetHandoverTopics({}, { "topic" }, now).empty());
+  EXPECT_EQ(shard_handover.TakeExpiredTopics(), std::set<std::string>{ "topic" });
+  EXPECT_TRUE(shard_handover.TakeExpiredTopics().empty());
+}
@@ -103,6 +103,8 @@ public:
     bool use_localhost_for_all_tasks;
     bool local_tasks_only;
     bool check_target_reachability;
+    bool         concurrent_launch_groups;      /**< When true, a launch group without waiting time doesn't wait for its start requests before the next launch group is started */
+    unsigned int max_parallel_starts_per_host;  /**< Maximum number of start requests (not tasks) that are sent to the same host in parallel. 0 means unlimited. */
   };
 
   //////////////////////////////////////////////////////////////////////////////
@@ -213,6 +213,8 @@ bool ConfigManager::LoadConfig(EcalSys& ecalsys, const std::string& path, bool a
       options.kill_all_on_close           = config.GetOptions().stop_all_on_close_;
       options.use_localhost_for_all_tasks = config.GetOptions().use_all_on_this_host_;
       options.local_tasks_only            = config.GetOptions().use_only_local_host_;
+      options.concurrent_launch_groups     = config.GetOptions().concurrent_launch_groups_;
+      options.max_parallel_starts_per_host = config.GetOptions().max_parallel_starts_per_host_;
       ecalsys.SetOptions(options);
     }
 
@@ -448,6 +450,8 @@ bool ConfigManager::SaveConfig(EcalSys& ecalsys, const std::string& path, Config
     options_config.stop_all_on_close_     = options.kill_all_on_close;
     options_config.use_all_on_this_host_  = options.use_localhost_for_all_tasks;
     options_config.use_only_local_host_   = options.local_tasks_only;
+    options_config.concurrent_launch_groups_     = options.concurrent_launch_groups;
+    options_config.max_parallel_starts_per_host_ = options.max_parallel_starts_per_host;
     config.SetOptions(options_config);
 
     // Write everything to a file
@@ -480,6 +480,8 @@ namespace eCAL
            bool use_only_local_host_ = false;
            bool use_all_on_this_host_ = false;
            bool stop_all_on_close_ = false;
+           bool concurrent_launch_groups_ = false;
+           unsigned int max_parallel_starts_per_host_ = 4;
         };
 
         typedef std::list<Target>   TargetList;
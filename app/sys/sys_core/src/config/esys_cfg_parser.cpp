@@ -571,6 +571,12 @@ namespace eCAL
               if (opt->FirstChildElement("all_targets_reachable") != nullptr)
                 options.all_targets_reachable_ = std::stoi(opt->FirstChildElement("all_targets_reachable")->GetText()) > 0;
 
+              if (opt->FirstChildElement("concurrent_launch_groups") != nullptr)
+                options.concurrent_launch_groups_ = std::stoi(opt->FirstChildElement("concurrent_launch_groups")->GetText()) > 0;
+
+              if (opt->FirstChildElement("max_parallel_starts_per_host") != nullptr)
+                options.max_parallel_starts_per_host_ = static_cast<unsigned int>(std::stoul(opt->FirstChildElement("max_parallel_starts_per_host")->GetText()));
+
               // try to find option "stop_all_on_close"  in the root (for old versions of xml) - to be deleted at some point
               auto stop_all_element = FindElementByName(src, "stop_all_on_close");
               if (stop_all_element != nullptr)
@@ -816,6 +822,8 @@ namespace eCAL
         AddChildElement(doc, *opt_element, "only_local_host", opt.use_only_local_host_ ? "1" : "0");
         AddChildElement(doc, *opt_element, "all_on_this_host", opt.use_all_on_this_host_ ? "1" : "0");
         AddChildElement(doc, *opt_element, "stop_all_on_close", opt.stop_all_on_close_ ? "1" : "0");
+        AddChildElement(doc, *opt_element, "concurrent_launch_groups", opt.concurrent_launch_groups_ ? "1" : "0");
+        AddChildElement(doc, *opt_element, "max_parallel_starts_per_host", std::to_string(opt.max_parallel_starts_per_host_));
         root_element->InsertEndChild(opt_element);
 
         // Set layout
@@ -69,6 +69,8 @@ EcalSys::EcalSys()
   m_options.kill_all_on_close = false;
   m_options.local_tasks_only = false;
   m_options.use_localhost_for_all_tasks = false;
+  m_options.concurrent_launch_groups = false;
+  m_options.max_parallel_starts_per_host = 4;
 
   LogAppNameVersion();
 
@@ -158,6 +160,8 @@ void EcalSys::ClearConfig()
   m_options.kill_all_on_close           = false;
   m_options.local_tasks_only            = false;
   m_options.use_localhost_for_all_tasks = false;
+  m_options.concurrent_launch_groups     = false;
+  m_options.max_parallel_starts_per_host = 4;
 }
 
 bool EcalSys::IsConfigOpened()
@@ -536,7 +540,8 @@ void EcalSys::StartTaskList(const std::list<std::shared_ptr<EcalSysTask>>& task_
     actual_target_override = eCAL::Process::GetHostName();
   }
 
-  std::shared_ptr<TaskListThread> start_task_list_thread(new StartTaskListThread(filtered_task_list, m_connection_manager, actual_target_override));
+  const auto options = GetOptions();
+  std::shared_ptr<TaskListThread> start_task_list_thread(new StartTaskListThread(filtered_task_list, m_connection_manager, actual_target_override, options.concurrent_launch_groups, options.max_parallel_starts_per_host));
   m_task_list_action_thread_container.add(start_task_list_thread);
   start_task_list_thread->Start();
 
@@ -584,7 +589,8 @@ void EcalSys::RestartTaskList(const std::list<std::shared_ptr<EcalSysTask>>& tas
     actual_target_override = eCAL::Process::GetHostName();
   }
 
-  std::shared_ptr<TaskListThread> restart_task_list_thread(new RestartTaskListThread(filtered_task_list, m_connection_manager, request_shutdown, kill_process, actual_target_override, by_name, wait_for_shutdown));
+  const auto options = GetOptions();
+  std::shared_ptr<TaskListThread> restart_task_list_thread(new RestartTaskListThread(filtered_task_list, m_connection_manager, request_shutdown, kill_process, actual_target_override, by_name, wait_for_shutdown, options.concurrent_launch_groups, options.max_parallel_starts_per_host));
   m_task_list_action_thread_container.add(restart_task_list_thread);
   restart_task_list_thread->Start();
 
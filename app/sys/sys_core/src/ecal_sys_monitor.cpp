@@ -91,12 +91,18 @@ void EcalSysMonitor::UpdateMonitor()
     m_all_hosts.clear();
     m_hosts_running_ecal_sys_client.clear();
     m_hosts_running_ecalsys.clear();
+    m_process_index.clear();
 
-    for (const auto& process : m_monitoring_pb.processes())
+    for (int process_index = 0; process_index < m_monitoring_pb.processes_size(); ++process_index)
     {
+      const auto& process = m_monitoring_pb.processes(process_index);
+
       // Update list of all Hosts
       m_all_hosts.emplace(process.host_name());
 
+      // Update the index for matching tasks. If a process is listed twice, the first one is used.
+      m_process_index[process.host_name()].emplace(static_cast<int>(process.process_id()), process_index);
+
       //Update list of available Targets
       if (process.unit_name() == "eCALSysClient")
       {
@@ -143,19 +149,27 @@ void EcalSysMonitor::UpdateTaskStates(const std::list<std::shared_ptr<EcalSysTas
       task->SetFoundInMonitorOnce(false);
     }
     else {
-      // Monitoring enabled => search in monitored processes for the current task
-      for (auto& process : m_monitoring_pb.processes())
+      // Monitoring enabled => look up the monitored processes of the current task
+      auto host_processes = m_process_index.find(task->GetHostStartedOn());
+      if (host_processes != m_process_index.end())
       {
-        std::vector<int> task_pids = task->GetPids();
-
+        // If multiple PIDs of the task are running, the process listed first is used
+        int matching_process_index = -1;
+        for (int pid : task->GetPids())
+        {
+          auto process_index = host_processes->second.find(pid);
+          if ((process_index != host_processes->second.end())
+            && ((matching_process_index < 0) || (process_index->second < matching_process_index)))
+          {
+            matching_process_index = process_index->second;
+          }
+        }
 
-        if ((task->GetHostStartedOn() == process.host_name())
-          && (std::find(task_pids.begin(), task_pids.end(), (int)process.process_id()) != task_pids.end()))
+        if (matching_process_index >= 0)
         {
           // The task is matching!
           task_mapping_found = true;
-          task_state         = eCAL::sys::proto_helpers::FromProtobuf(process.state());
-          break;
+          task_state         = eCAL::sys::proto_helpers::FromProtobuf(m_monitoring_pb.processes(matching_process_index).state());
         }
       }
     }
@@ -204,15 +218,33 @@ void EcalSysMonitor::RestartBySeverity()
 {
   std::list<std::shared_ptr<EcalSysTask>> tasks_for_restarting;
 
+  const bool        local_tasks_only = m_ecalsys_instance.GetOptions().local_tasks_only;
+  const std::string host_name        = eCAL::Process::GetHostName();
+
+  // Evaluating the targets is expensive and they rarely change, so the results are
+  // kept as long as the target is used by any task.
+  std::unordered_map<std::string, std::string> evaluated_targets;
+
   for (auto& task : m_task_list)
   {
     bool is_starting_or_stopping = m_ecalsys_instance.IsTaskActionRunning(task);
 
     std::lock_guard<std::recursive_mutex> task_lock(task->mutex);
     // tasks on other hosts than local won't be restarted if the flag local_tasks_only is set
-    if ((m_ecalsys_instance.GetOptions().local_tasks_only) && (EcalParser::Evaluate(task->GetTarget(), false) != eCAL::Process::GetHostName()))
+    if (local_tasks_only)
     {
-      continue;
+      const std::string target = task->GetTarget();
+      auto evaluated_target = evaluated_targets.find(target);
+      if (evaluated_target == evaluated_targets.end())
+      {
+        auto cached_target = m_evaluated_targets.find(target);
+        evaluated_target = evaluated_targets.emplace(target, (cached_target != m_evaluated_targets.end()) ? cached_target->second : EcalParser::Evaluate(target, false)).first;
+      }
+
+      if (evaluated_target->second != host_name)
+      {
+        continue;
+      }
     }
 
     if (task->IsMonitoringEnabled()
@@ -238,6 +270,8 @@ void EcalSysMonitor::RestartBySeverity()
     }
   }
 
+  m_evaluated_targets.swap(evaluated_targets);
+
   if (tasks_for_restarting.size() != 0)
   {
     m_ecalsys_instance.RestartTaskList(tasks_for_restarting, false, true);
@@ -21,6 +21,8 @@
 
 #include <chrono>
 #include <set>
+#include <string>
+#include <unordered_map>
 
 #include <ecal/msg/protobuf/publisher.h>
 
@@ -130,6 +132,9 @@ private:
   std::set<std::string>                             m_all_hosts;                       /**< A list of all hosts that are running any eCAL based software */
   std::set<std::string>                             m_hosts_running_ecal_sys_client;   /**< A list of all hosts where we found a running eCAL sys client during monitoring */
   std::vector<std::pair<std::string, int>>          m_hosts_running_ecalsys;           /**< A list of all hosts where we found a running eCAL Sys instance. Using multiple eCAL Sys instances might cause undefined behaviour, as each instance cannot track the current state of the tasks properly. Thus, we want to warn the user about that */
+  std::unordered_map<std::string, std::unordered_map<int, int>> m_process_index;       /**< Host name -> (PID -> index in m_monitoring_pb.processes()). Rebuilt with m_monitoring_pb, so tasks can be matched to their processes without iterating over all processes */
+
+  std::unordered_map<std::string, std::string>      m_evaluated_targets;               /**< Task target -> target evaluated by the EcalParser. Only the targets of the current task list are kept */
 
   std::list<std::shared_ptr<EcalSysTask>>           m_task_list;                       /**< List of all task that gets updated each iteration. This is a member variable to make sure that all functions operate on the same list. */
 
@@ -145,6 +150,7 @@ private:
    *    m_all_hosts
    *    m_hosts_running_ecal_sys_client
    *    m_hosts_running_ecalsys
+   *    m_process_index
    */
   void UpdateMonitor();
 
@@ -0,0 +1,138 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include "launch_group_scheduling.h"
+
+#include <algorithm>
+
+namespace eCAL
+{
+  namespace sys
+  {
+    bool IsTaskReady(const std::shared_ptr<EcalSysTask>& task)
+    {
+      std::lock_guard<std::recursive_mutex> task_lock(task->mutex);
+
+      // A task that failed to start will never come up, so we don't wait for it
+      if (task->GetStartStopState() != EcalSysTask::StartStopState::Started_Successfully)
+        return true;
+
+      if (!task->FoundInLastMonitorLoop())
+        return false;
+
+      const auto severity = task->GetMonitoringTaskState().severity;
+      return (severity != eCAL::Process::eSeverity::critical)
+          && (severity != eCAL::Process::eSeverity::failed);
+    }
+
+    bool WaitUntilLaunchGroupReady(const std::list<std::shared_ptr<EcalSysTask>>& launch_group
+                                  , std::chrono::nanoseconds max_waiting_time
+                                  , std::chrono::nanoseconds poll_interval
+                                  , const std::function<bool(std::chrono::nanoseconds)>& sleep_for)
+    {
+      const auto deadline = std::chrono::steady_clock::now() + max_waiting_time;
+
+      for (;;)
+      {
+        if (std::all_of(launch_group.begin(), launch_group.end(), &IsTaskReady))
+          return true;
+
+        const auto now = std::chrono::steady_clock::now();
+        if (now >= deadline)
+          return false;
+
+        if (!sleep_for(std::min<std::chrono::nanoseconds>(poll_interval, deadline - now)))
+          return false;
+      }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    //// HostStartLimiter                                                   ////
+    ////////////////////////////////////////////////////////////////////////////
+
+    HostStartLimiter::HostStartLimiter(unsigned int max_parallel_requests_per_host)
+      : m_max_parallel_requests_per_host(max_parallel_requests_per_host)
+    {}
+
+    uint64_t HostStartLimiter::Enqueue(const std::string& host)
+    {
+      const std::lock_guard<std::mutex> lock(m_mutex);
+
+      HostQueue& host_queue = m_host_queues[host];
+      const uint64_t ticket = host_queue.next_ticket++;
+      host_queue.waiting.push_back(ticket);
+      return ticket;
+    }
+
+    bool HostStartLimiter::Acquire(const std::string& host, uint64_t ticket, const std::function<bool()>& is_interrupted)
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+
+      HostQueue& host_queue = m_host_queues[host];
+      while ((host_queue.waiting.front() != ticket)
+          || ((m_max_parallel_requests_per_host > 0) && (host_queue.running >= m_max_parallel_requests_per_host)))
+      {
+        if (is_interrupted())
+        {
+          host_queue.waiting.erase(std::find(host_queue.waiting.begin(), host_queue.waiting.end(), ticket));
+          lock.unlock();
+          m_cv.notify_all();
+          return false;
+        }
+
+        // Check the interrupt flag regularly, as the interrupting thread doesn't know our condition variable
+        m_cv.wait_for(lock, std::chrono::milliseconds(100));
+      }
+
+      host_queue.waiting.pop_front();
+      host_queue.running++;
+      lock.unlock();
+
+      // The next request in the queue may be allowed to run, as well
+      m_cv.notify_all();
+      return true;
+    }
+
+    void HostStartLimiter::Release(const std::string& host)
+    {
+      {
+        const std::lock_guard<std::mutex> lock(m_mutex);
+        m_host_queues[host].running--;
+      }
+      m_cv.notify_all();
+    }
+
+    HostStartSlot::HostStartSlot(HostStartLimiter& limiter, const std::string& host, uint64_t ticket, const std::function<bool()>& is_interrupted)
+      : m_limiter (limiter)
+      , m_host    (host)
+      , m_acquired(limiter.Acquire(host, ticket, is_interrupted))
+    {}
+
+    HostStartSlot::~HostStartSlot()
+    {
+      if (m_acquired)
+        m_limiter.Release(m_host);
+    }
+
+    bool HostStartSlot::IsAcquired() const
+    {
+      return m_acquired;
+    }
+  }
+}
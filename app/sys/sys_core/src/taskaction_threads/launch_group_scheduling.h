@@ -0,0 +1,143 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "ecalsys/task/ecal_sys_task.h"
+
+namespace eCAL
+{
+  namespace sys
+  {
+    /**
+     * @brief Checks whether a started task is up, so tasks with a higher launch order may be started
+     *
+     * A task is ready, once its process has registered in the eCAL monitoring
+     * with a severity that is neither critical nor failed. Tasks that failed
+     * to start will never come up, so they are considered ready, as well.
+     */
+    bool IsTaskReady(const std::shared_ptr<EcalSysTask>& task);
+
+    /**
+     * @brief Waits until all tasks of the launch group are ready or the max_waiting_time has passed
+     *
+     * Tasks without monitoring can never become ready, so for those the full
+     * time is waited.
+     *
+     * @param launch_group      The started tasks
+     * @param max_waiting_time  The maximum time to wait
+     * @param poll_interval     How often the tasks are checked
+     * @param sleep_for         Sleeps for the given time. Returns false, if waiting shall be aborted (e.g. because the thread has been interrupted).
+     *
+     * @return True, if all tasks are ready
+     */
+    bool WaitUntilLaunchGroupReady(const std::list<std::shared_ptr<EcalSysTask>>& launch_group
+                                  , std::chrono::nanoseconds max_waiting_time
+                                  , std::chrono::nanoseconds poll_interval
+                                  , const std::function<bool(std::chrono::nanoseconds)>& sleep_for);
+
+    /**
+     * @brief Limits the number of start requests that are running in parallel for each host
+     *
+     * The limit counts requests (i.e. ConnectionManager::StartTasks() calls),
+     * not tasks, as one request may start many tasks at once. Requests to the
+     * same host are sent in the order in which they have been enqueued.
+     */
+    class HostStartLimiter
+    {
+    public:
+      /**
+       * @param max_parallel_requests_per_host  The maximum number of requests running for the same host. 0 means unlimited.
+       */
+      explicit HostStartLimiter(unsigned int max_parallel_requests_per_host);
+
+      /**
+       * @brief Reserves the next place in the queue of the host
+       *
+       * Call this in the order in which the requests shall be sent. Every
+       * ticket must be passed to Acquire() afterwards.
+       *
+       * @return The ticket of the request
+       */
+      uint64_t Enqueue(const std::string& host);
+
+      /**
+       * @brief Blocks until the request with the given ticket may be sent
+       *
+       * @param is_interrupted  Checked regularly while waiting. When it returns true, the ticket is dropped from the queue.
+       *
+       * @return True, if the request may be sent now. Release() must be called once it has finished.
+       */
+      bool Acquire(const std::string& host, uint64_t ticket, const std::function<bool()>& is_interrupted);
+
+      /** @brief Marks a request that has been acquired before as finished */
+      void Release(const std::string& host);
+
+    private:
+      struct HostQueue
+      {
+        uint64_t             next_ticket = 0;
+        std::deque<uint64_t> waiting;
+        unsigned int         running     = 0;
+      };
+
+      const unsigned int                m_max_parallel_requests_per_host;
+
+      std::mutex                        m_mutex;
+      std::condition_variable           m_cv;
+      std::map<std::string, HostQueue>  m_host_queues;
+    };
+
+    /**
+     * @brief Acquires a ticket of a HostStartLimiter and releases it when destroyed
+     *
+     * This makes sure the host gets its start slot back, even if sending the
+     * request throws.
+     */
+    class HostStartSlot
+    {
+    public:
+      /** @brief Blocks until the request may be sent, see HostStartLimiter::Acquire() */
+      HostStartSlot(HostStartLimiter& limiter, const std::string& host, uint64_t ticket, const std::function<bool()>& is_interrupted);
+      ~HostStartSlot();
+
+      HostStartSlot(const HostStartSlot&)            = delete;
+      HostStartSlot& operator=(const HostStartSlot&) = delete;
+
+      /** @return False, if waiting has been interrupted. The request must not be sent then. */
+      bool IsAcquired() const;
+
+    private:
+      HostStartLimiter& m_limiter;
+      const std::string m_host;
+      const bool        m_acquired;
+    };
+  }
+}
@@ -21,13 +21,15 @@
 
 #include <map>
 
-RestartTaskListThread::RestartTaskListThread(const std::list<std::shared_ptr<EcalSysTask>>& task_list, const std::shared_ptr<eCAL::sys::ConnectionManager>& connection_manager, bool request_shutdown, bool kill_process, const std::string& target_override, bool by_name, std::chrono::nanoseconds wait_for_shutdown)
+RestartTaskListThread::RestartTaskListThread(const std::list<std::shared_ptr<EcalSysTask>>& task_list, const std::shared_ptr<eCAL::sys::ConnectionManager>& connection_manager, bool request_shutdown, bool kill_process, const std::string& target_override, bool by_name, std::chrono::nanoseconds wait_for_shutdown, bool concurrent_launch_groups, unsigned int max_parallel_starts_per_host)
   : TaskListThread     (task_list, connection_manager)
   , m_request_shutdown (request_shutdown)
   , m_kill_process     (kill_process)
   , m_target_override  (target_override)
   , m_by_name          (by_name)
   , m_wait_for_shutdown(wait_for_shutdown)
+  , m_concurrent_launch_groups    (concurrent_launch_groups)
+  , m_max_parallel_starts_per_host(max_parallel_starts_per_host)
 {}
 
 RestartTaskListThread::~RestartTaskListThread()
@@ -52,7 +54,7 @@ void RestartTaskListThread::Run()
     if (IsInterrupted()) {
       return; 
     }
-    m_start_task_list_thread = std::unique_ptr<StartTaskListThread>(new StartTaskListThread(m_task_list, m_connection_manager, m_target_override));
+    m_start_task_list_thread = std::unique_ptr<StartTaskListThread>(new StartTaskListThread(m_task_list, m_connection_manager, m_target_override, m_concurrent_launch_groups, m_max_parallel_starts_per_host));
     m_start_task_list_thread->Start();
   }
   m_start_task_list_thread->Join();
@@ -33,7 +33,7 @@ class RestartTaskListThread :
   public TaskListThread
 {
 public:
-  RestartTaskListThread(const std::list<std::shared_ptr<EcalSysTask>>& task_list, const std::shared_ptr<eCAL::sys::ConnectionManager>& connection_manager, bool request_shutdown, bool kill_process, const std::string& target_override = "", bool by_name = false, std::chrono::nanoseconds wait_for_shutdown = std::chrono::seconds(3));
+  RestartTaskListThread(const std::list<std::shared_ptr<EcalSysTask>>& task_list, const std::shared_ptr<eCAL::sys::ConnectionManager>& connection_manager, bool request_shutdown, bool kill_process, const std::string& target_override = "", bool by_name = false, std::chrono::nanoseconds wait_for_shutdown = std::chrono::seconds(3), bool concurrent_launch_groups = false, unsigned int max_parallel_starts_per_host = 4);
 
   // Copy construction is not allowed for threads
   RestartTaskListThread(RestartTaskListThread const&) = delete;
@@ -54,6 +54,8 @@ private:
   std::string              m_target_override;                                   /**< When not empty, the task will be started on that given host. Otherwise, the configured target is used. */
   bool                     m_by_name;                                           /**< Whether the task shall be killed by it's name rather than the known PID (only needed when killing non-eCAL Task from the command line where their PID is unknown */
   std::chrono::nanoseconds m_wait_for_shutdown;                                 /**< Time to wait for a gracefull shutdown, if both a shutdown request shall be sent and the task shall be killed afterwards */
+  bool                     m_concurrent_launch_groups;                          /**< Whether launch groups without waiting time may overlap with the next launch group when starting */
+  unsigned int             m_max_parallel_starts_per_host;                      /**< Maximum number of start requests that are sent to the same host in parallel */
 
   std::unique_ptr<StopTaskListThread>  m_stop_task_list_thread;                 /**< The thread that is actually stopping the tasks */
   std::unique_ptr<StartTaskListThread> m_start_task_list_thread;                /**< The thread that is actually starting the tasks */
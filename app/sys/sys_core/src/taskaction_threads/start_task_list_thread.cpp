@@ -21,14 +21,23 @@
 #include <ecalsys/ecal_sys_logger.h>
 
 #include "start_task_list_thread.h"
-#include <map>
-#include <future>
+
+#include <algorithm>
+#include <string>
 
 #include <EcalParser/EcalParser.h>
 
-StartTaskListThread::StartTaskListThread(const std::list<std::shared_ptr<EcalSysTask>>& task_list, const std::shared_ptr<eCAL::sys::ConnectionManager>& connection_manager, const std::string& target_override)
-  : TaskListThread(task_list, connection_manager)
-  , m_target_override(target_override)
+namespace
+{
+  // How often the monitoring state of the tasks is checked while waiting for a launch group
+  const std::chrono::milliseconds readiness_poll_interval(100);
+}
+
+StartTaskListThread::StartTaskListThread(const std::list<std::shared_ptr<EcalSysTask>>& task_list, const std::shared_ptr<eCAL::sys::ConnectionManager>& connection_manager, const std::string& target_override, bool concurrent_launch_groups, unsigned int max_parallel_starts_per_host)
+  : TaskListThread            (task_list, connection_manager)
+  , m_target_override         (target_override)
+  , m_concurrent_launch_groups(concurrent_launch_groups)
+  , m_host_start_limiter      (max_parallel_starts_per_host)
 {}
 
 StartTaskListThread::~StartTaskListThread()
@@ -48,113 +57,158 @@ void StartTaskListThread::Run()
 
   if (IsInterrupted()) return;
 
+  // Launch groups that have been started, but whose start results have not been evaluated, yet
+  std::list<LaunchGroupStart> running_launch_group_starts;
+
   // std::map already sorts everything with std::less, which is exactly what we want
   for (auto launch_group_it = launch_groups.begin(); launch_group_it != launch_groups.end(); launch_group_it++)
-  //for (auto& task_list : launch_groups)
   {
-    // Sort the tasks into different Targets.
-    // Also convert the task to the primitive sys_client task struct
-    std::map<std::string, std::vector<eCAL::sys_client::StartTaskParameters>> start_tasks_param_map;
-    std::map<std::string, std::vector<std::shared_ptr<EcalSysTask>>>          original_task_ptr_map; // Needed for return values
+    if (IsInterrupted()) return;
 
     std::chrono::nanoseconds waiting_time(0);
+    running_launch_group_starts.push_back(StartLaunchGroup(launch_group_it->second, waiting_time));
 
-    for (const auto& task : launch_group_it->second)
-    {
-      std::lock_guard<std::recursive_mutex> task_lock(task->mutex);
-      if (IsInterrupted()) return;
-
-      // Initialize task state
-      task->SetStartStopState        (EcalSysTask::StartStopState::NotStarted);
-      task->SetFoundInLastMonitorLoop(false);
-      task->SetFoundInMonitorOnce    (false);
-      task->SetHostStartedOn         ("");
-      task->SetPids                  ({});
-
-      TaskState task_state;
-      task_state.info           = "";
-      task_state.severity       = eCAL::Process::eSeverity::unknown;
-      task_state.severity_level = eCAL::Process::eSeverityLevel::level1;
-      task->SetMonitoringTaskState(task_state);
-      task->ResetConfigModifiedSinceStart();
-
-      // Create primitive StartTaskParameters struct for ecal_sys_client API
-      if (m_target_override.empty())
-      {
-        auto evaluated_target = EcalParser::Evaluate(task->GetTarget(), false);
-        start_tasks_param_map[evaluated_target].push_back(eCAL::sys::task_helpers::ToSysClientStartParameters_NoLock(task));
-        original_task_ptr_map[evaluated_target].push_back(task);
-      }
-      else
-      {
-        start_tasks_param_map[m_target_override].push_back(eCAL::sys::task_helpers::ToSysClientStartParameters_NoLock(task));
-        original_task_ptr_map[m_target_override].push_back(task);
-      }
+    const bool is_last_launch_group = (std::next(launch_group_it) == launch_groups.end());
+
+    // Only when explicitly enabled, a launch group without any waiting time
+    // lets the next launch group start before its own start requests have
+    // returned. The host start limiter still sends the requests to each host
+    // in launch order.
+    if (m_concurrent_launch_groups && !is_last_launch_group && (waiting_time <= std::chrono::nanoseconds(0)))
+      continue;
 
-      // Check if the task requires us to wait after the start
-      waiting_time = std::max(waiting_time, task->GetTimeoutAfterStart());
+    for (auto& launch_group_start : running_launch_group_starts)
+    {
+      if (!EvaluateStartResults(launch_group_start)) return;
     }
+    running_launch_group_starts.clear();
 
-    // Start all task of this launch group (Hosts are started in parallel)
-    std::map<std::string, std::future<std::vector<int32_t>>> future_map;
-    for (const auto& host_taskparamlist_pair : start_tasks_param_map)
+    // Wait for the required amount of time before starting the next launch
+    // group. The waiting time ends early, once all tasks of this launch group are up.
+    if (!is_last_launch_group && (waiting_time > std::chrono::nanoseconds(0)))
     {
-      future_map.emplace(host_taskparamlist_pair.first, std::async(std::launch::async, [this, &host_taskparamlist_pair]{ return this->m_connection_manager->StartTasks(host_taskparamlist_pair.first, host_taskparamlist_pair.second); }));
+      const auto wait_start = std::chrono::steady_clock::now();
+      const bool ready = eCAL::sys::WaitUntilLaunchGroupReady(launch_group_it->second, waiting_time, readiness_poll_interval
+                                                               , [this](std::chrono::nanoseconds duration) { SleepFor(duration); return !IsInterrupted(); });
+      if (ready)
+      {
+        auto waited_ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - wait_start).count();
+        EcalSysLogger::Log("Launch group is ready after " + std::to_string(waited_ms) + " ms, starting the next launch group", spdlog::level::debug);
+      }
     }
 
-    for (const auto& host_taskparamlist_pair : start_tasks_param_map)
+    if (IsInterrupted()) return;
+  }
+}
+
+StartTaskListThread::LaunchGroupStart StartTaskListThread::StartLaunchGroup(const std::list<std::shared_ptr<EcalSysTask>>& launch_group, std::chrono::nanoseconds& waiting_time)
+{
+  // Sort the tasks into different Targets.
+  // Also convert the task to the primitive sys_client task struct
+  std::map<std::string, std::vector<eCAL::sys_client::StartTaskParameters>> start_tasks_param_map;
+  LaunchGroupStart                                                           launch_group_start;
+
+  for (const auto& task : launch_group)
+  {
+    std::lock_guard<std::recursive_mutex> task_lock(task->mutex);
+    if (IsInterrupted()) return launch_group_start;
+
+    // Initialize task state
+    task->SetStartStopState        (EcalSysTask::StartStopState::NotStarted);
+    task->SetFoundInLastMonitorLoop(false);
+    task->SetFoundInMonitorOnce    (false);
+    task->SetHostStartedOn         ("");
+    task->SetPids                  ({});
+
+    TaskState task_state;
+    task_state.info           = "";
+    task_state.severity       = eCAL::Process::eSeverity::unknown;
+    task_state.severity_level = eCAL::Process::eSeverityLevel::level1;
+    task->SetMonitoringTaskState(task_state);
+    task->ResetConfigModifiedSinceStart();
+
+    // Create primitive StartTaskParameters struct for ecal_sys_client API
+    const std::string target = (m_target_override.empty() ? EcalParser::Evaluate(task->GetTarget(), false) : m_target_override);
+    start_tasks_param_map[target].push_back(eCAL::sys::task_helpers::ToSysClientStartParameters_NoLock(task));
+    launch_group_start[target].tasks.push_back(task);
+
+    // Check if the task requires us to wait after the start
+    waiting_time = std::max(waiting_time, task->GetTimeoutAfterStart());
+  }
+
+  // Start all task of this launch group (Hosts are started in parallel).
+  // The tickets are taken here, so the requests to each host keep the launch order.
+  for (auto& host_taskparamlist_pair : start_tasks_param_map)
+  {
+    const uint64_t ticket = m_host_start_limiter.Enqueue(host_taskparamlist_pair.first);
+    launch_group_start[host_taskparamlist_pair.first].process_ids
+        = std::async(std::launch::async
+                    , [this, host = host_taskparamlist_pair.first, ticket, task_param_list = std::move(host_taskparamlist_pair.second)]
+                      { return this->StartTasksOnHost(host, ticket, task_param_list); });
+  }
+
+  return launch_group_start;
+}
+
+bool StartTaskListThread::EvaluateStartResults(LaunchGroupStart& launch_group_start)
+{
+  for (auto& host_start_pair : launch_group_start)
+  {
+    const std::string& host  = host_start_pair.first;
+    const auto&        tasks = host_start_pair.second.tasks;
+
+    if (IsInterrupted()) return false;
+    if (!host_start_pair.second.process_ids.valid()) continue;
+    std::vector<int32_t> process_ids = host_start_pair.second.process_ids.get();
+    if (IsInterrupted()) return false;
+
+    for (size_t i = 0; (i < process_ids.size()) && (i < tasks.size()); i++)
     {
-      if (IsInterrupted()) return;
-      std::vector<int32_t> process_ids = future_map[host_taskparamlist_pair.first].get();
-      if (IsInterrupted()) return;
+      const std::shared_ptr<EcalSysTask>& task = tasks[i];
 
-      for (size_t i = 0; (i < process_ids.size()) && (i < original_task_ptr_map[host_taskparamlist_pair.first].size()); i++)
       {
-        std::shared_ptr<EcalSysTask> task = original_task_ptr_map[host_taskparamlist_pair.first][i];
+        std::lock_guard<std::recursive_mutex> task_lock(task->mutex);
+        if (IsInterrupted()) return false;
 
+        if (process_ids[i] != 0)
         {
-          std::lock_guard<std::recursive_mutex> task_lock(task->mutex);
-          if (IsInterrupted()) return;
-
-          if (process_ids[i] != 0)
-          {
-            task->SetPids({process_ids[i]});
-            task->SetHostStartedOn(host_taskparamlist_pair.first);
-            task->SetStartStopState(EcalSysTask::StartStopState::Started_Successfully);
-
-            EcalSysLogger::Log("Successfully started Task: " + task->GetName() + " @ " + host_taskparamlist_pair.first, spdlog::level::info);
-          }
-          else
-          {
-            task->SetPids({});
-            task->SetHostStartedOn("");
-            task->SetStartStopState(EcalSysTask::StartStopState::Started_Failed);
-
-            EcalSysLogger::Log("FAILED starting Task:      " + task->GetName() + " @ " + host_taskparamlist_pair.first, spdlog::level::err);
-          }
-        }
-      }
-
-      // Log an error for all tasks that we didn't get a response for (e.g. because we weren't able to contact the client)
-      for (size_t i = process_ids.size(); i < original_task_ptr_map[host_taskparamlist_pair.first].size(); i++)
-      {
-        std::shared_ptr<EcalSysTask> task = original_task_ptr_map[host_taskparamlist_pair.first][i];
+          task->SetPids({process_ids[i]});
+          task->SetHostStartedOn(host);
+          task->SetStartStopState(EcalSysTask::StartStopState::Started_Successfully);
 
-        task->SetPids({});
-        task->SetHostStartedOn("");
-        task->SetStartStopState(EcalSysTask::StartStopState::Started_Failed);
+          EcalSysLogger::Log("Successfully started Task: " + task->GetName() + " @ " + host, spdlog::level::info);
+        }
+        else
+        {
+          task->SetPids({});
+          task->SetHostStartedOn("");
+          task->SetStartStopState(EcalSysTask::StartStopState::Started_Failed);
 
-        EcalSysLogger::Log("FAILED starting Task:      " + task->GetName() + " @ " + host_taskparamlist_pair.first + " (Unable to contact client)", spdlog::level::err);
+          EcalSysLogger::Log("FAILED starting Task:      " + task->GetName() + " @ " + host, spdlog::level::err);
+        }
       }
     }
 
-    // Wait for the required amount of time before starting the next launch group
-    if (std::next(launch_group_it) != launch_groups.end())
+    // Log an error for all tasks that we didn't get a response for (e.g. because we weren't able to contact the client)
+    for (size_t i = process_ids.size(); i < tasks.size(); i++)
     {
-      if (IsInterrupted()) return;
-      SleepFor(waiting_time);
-    }
+      const std::shared_ptr<EcalSysTask>& task = tasks[i];
 
-    if (IsInterrupted()) return;
+      task->SetPids({});
+      task->SetHostStartedOn("");
+      task->SetStartStopState(EcalSysTask::StartStopState::Started_Failed);
+
+      EcalSysLogger::Log("FAILED starting Task:      " + task->GetName() + " @ " + host + " (Unable to contact client)", spdlog::level::err);
+    }
   }
+  return true;
+}
+
+std::vector<int32_t> StartTaskListThread::StartTasksOnHost(const std::string& host, uint64_t ticket, const std::vector<eCAL::sys_client::StartTaskParameters>& task_param_list)
+{
+  const eCAL::sys::HostStartSlot start_slot(m_host_start_limiter, host, ticket, [this]() { return IsInterrupted(); });
+  if (!start_slot.IsAcquired())
+    return {};
+
+  return m_connection_manager->StartTasks(host, task_param_list);
 }
@@ -22,15 +22,24 @@
 #include "task_list_thread.h"
 
 #include <chrono>
+#include <cstdint>
+#include <future>
 #include <list>
+#include <map>
+#include <vector>
 
 #include "ecalsys/task/ecal_sys_task.h"
+#include "launch_group_scheduling.h"
 
 class StartTaskListThread :
   public TaskListThread
 {
 public:
-  StartTaskListThread(const std::list<std::shared_ptr<EcalSysTask>>& task_list, const std::shared_ptr<eCAL::sys::ConnectionManager>& connection_manager, const std::string& target_override = "");
+  /**
+   * @param concurrent_launch_groups      When true, a launch group without any waiting time doesn't wait for its start requests to return, before the next launch group is started
+   * @param max_parallel_starts_per_host  The maximum number of start requests (not tasks) that are sent to the same host in parallel. 0 means unlimited.
+   */
+  StartTaskListThread(const std::list<std::shared_ptr<EcalSysTask>>& task_list, const std::shared_ptr<eCAL::sys::ConnectionManager>& connection_manager, const std::string& target_override = "", bool concurrent_launch_groups = false, unsigned int max_parallel_starts_per_host = 4);
 
   // Copy construction is not allowed for threads
   StartTaskListThread(StartTaskListThread const&) = delete;
@@ -42,6 +51,33 @@ protected:
   void Run();
 
 private:
+  /** The tasks of one launch group that are started on one host */
+  struct HostStart
+  {
+    std::vector<std::shared_ptr<EcalSysTask>> tasks;
+    std::future<std::vector<int32_t>>         process_ids;
+  };
+  using LaunchGroupStart = std::map<std::string, HostStart>;
+
+  /**
+   * @brief Resets the state of all tasks of the launch group and starts them asynchronously (hosts are started in parallel)
+   * @param launch_group  The tasks to start
+   * @param waiting_time  [out] The maximum TimeoutAfterStart of the tasks of this launch group
+   * @return The pending start requests, one per host
+   */
+  LaunchGroupStart StartLaunchGroup(const std::list<std::shared_ptr<EcalSysTask>>& launch_group, std::chrono::nanoseconds& waiting_time);
+
+  /**
+   * @brief Waits for the start requests of a launch group and sets the PIDs and StartStopState of its tasks
+   * @return False, if the thread has been interrupted
+   */
+  bool EvaluateStartResults(LaunchGroupStart& launch_group_start);
+
+  /** Starts the tasks on the given host, once the host start limiter lets the request with the given ticket through */
+  std::vector<int32_t> StartTasksOnHost(const std::string& host, uint64_t ticket, const std::vector<eCAL::sys_client::StartTaskParameters>& task_param_list);
+
   std::string                             m_target_override;                    /**< When not empty, the task will be started on that given host.Otherwise, the configured target is used. */
-};
+  bool                                    m_concurrent_launch_groups;           /**< Whether launch groups without waiting time may overlap with the next launch group */
 
+  eCAL::sys::HostStartLimiter             m_host_start_limiter;                 /**< Limits the number of start requests that are running in parallel for each host */
+};
@@ -61,7 +61,9 @@ PYBIND11_MODULE(ecal_sys_python, Sys) {
     .def_readwrite("kill_all_on_close", &EcalSys::Options::kill_all_on_close, "bool")
     .def_readwrite("use_localhost_for_all_tasks", &EcalSys::Options::use_localhost_for_all_tasks, "bool")
     .def_readwrite("local_tasks_only", &EcalSys::Options::local_tasks_only, "bool")
-    .def_readwrite("check_target_reachability", &EcalSys::Options::check_target_reachability, "bool");
+    .def_readwrite("check_target_reachability", &EcalSys::Options::check_target_reachability, "bool")
+    .def_readwrite("concurrent_launch_groups", &EcalSys::Options::concurrent_launch_groups, "bool")
+    .def_readwrite("max_parallel_starts_per_host", &EcalSys::Options::max_parallel_starts_per_host, "int");
 
   py::enum_<eCAL_Process_eStartMode>(Sys, "eCAL_Process_eStartMode")
     .value("proc_smode_normal", eCAL_Process_eStartMode::proc_smode_normal)
@@ -0,0 +1,248 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include <gtest/gtest.h>
+
+#include <taskaction_threads/launch_group_scheduling.h>
+
+#include <atomic>
+#include <chrono>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+  std::shared_ptr<EcalSysTask> StartedTask(bool found_in_monitor, eCAL::Process::eSeverity severity)
+  {
+    auto task = std::make_shared<EcalSysTask>();
+    task->SetStartStopState(EcalSysTask::StartStopState::Started_Successfully);
+    task->SetFoundInLastMonitorLoop(found_in_monitor);
+
+    TaskState task_state;
+    task_state.severity = severity;
+    task->SetMonitoringTaskState(task_state);
+    return task;
+  }
+
+  bool SleepFor(std::chrono::nanoseconds duration)
+  {
+    std::this_thread::sleep_for(duration);
+    return true;
+  }
+}
+
+TEST(sys_core, IsTaskReady)
+{
+  EXPECT_TRUE (eCAL::sys::IsTaskReady(StartedTask(true,  eCAL::Process::eSeverity::healthy)));
+  EXPECT_TRUE (eCAL::sys::IsTaskReady(StartedTask(true,  eCAL::Process::eSeverity::warning)));
+  EXPECT_FALSE(eCAL::sys::IsTaskReady(StartedTask(false, eCAL::Process::eSeverity::healthy)));
+  EXPECT_FALSE(eCAL::sys::IsTaskReady(StartedTask(true,  eCAL::Process::eSeverity::critical)));
+  EXPECT_FALSE(eCAL::sys::IsTaskReady(StartedTask(true,  eCAL::Process::eSeverity::failed)));
+
+  // A task that failed to start will never come up, so nobody must wait for it
+  auto failed_task = StartedTask(false, eCAL::Process::eSeverity::unknown);
+  failed_task->SetStartStopState(EcalSysTask::StartStopState::Started_Failed);
+  EXPECT_TRUE(eCAL::sys::IsTaskReady(failed_task));
+}
+
+TEST(sys_core, WaitUntilLaunchGroupReady_ReturnsEarly)
+{
+  auto task = StartedTask(false, eCAL::Process::eSeverity::healthy);
+  const std::list<std::shared_ptr<EcalSysTask>> launch_group{ task };
+
+  std::thread monitor_thread([task]()
+                            {
+                              std::this_thread::sleep_for(std::chrono::milliseconds(100));
+                              task->SetFoundInLastMonitorLoop(true);
+                            });
+
+  const auto start = std::chrono::steady_clock::now();
+  const bool ready = eCAL::sys::WaitUntilLaunchGroupReady(launch_group, std::chrono::seconds(10), std::chrono::milliseconds(10), &SleepFor);
+  const auto waited = std::chrono::steady_clock::now() - start;
+
+  monitor_thread.join();
+
+  EXPECT_TRUE(ready);
+  EXPECT_LT(waited, std::chrono::seconds(5));
+}
+
+TEST(sys_core, WaitUntilLaunchGroupReady_Timeout)
+{
+  // The task never shows up in the monitoring (e.g. monitoring disabled), so the full time is waited
+  const std::list<std::shared_ptr<EcalSysTask>> launch_group{ StartedTask(false, eCAL::Process::eSeverity::unknown)
+                                                            , StartedTask(true,  eCAL::Process::eSeverity::healthy) };
+
+  const auto start = std::chrono::steady_clock::now();
+  const bool ready = eCAL::sys::WaitUntilLaunchGroupReady(launch_group, std::chrono::milliseconds(200), std::chrono::milliseconds(10), &SleepFor);
+  const auto waited = std::chrono::steady_clock::now() - start;
+
+  EXPECT_FALSE(ready);
+  EXPECT_GE(waited, std::chrono::milliseconds(200));
+}
+
+TEST(sys_core, WaitUntilLaunchGroupReady_Interrupted)
+{
+  const std::list<std::shared_ptr<EcalSysTask>> launch_group{ StartedTask(false, eCAL::Process::eSeverity::unknown) };
+
+  int sleep_calls(0);
+  const bool ready = eCAL::sys::WaitUntilLaunchGroupReady(launch_group, std::chrono::seconds(10), std::chrono::milliseconds(10)
+                                                         , [&sleep_calls](std::chrono::nanoseconds) { ++sleep_calls; return false; });
+
+  EXPECT_FALSE(ready);
+  EXPECT_EQ(sleep_calls, 1);
+}
+
+TEST(sys_core, HostStartLimiter_LimitsParallelRequests)
+{
+  const unsigned int max_parallel = 2;
+  eCAL::sys::HostStartLimiter limiter(max_parallel);
+
+  std::atomic<unsigned int> running(0);
+  std::atomic<unsigned int> max_running(0);
+  std::atomic<unsigned int> running_other_host(0);
+
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 8; i++)
+  {
+    const uint64_t ticket = limiter.Enqueue("host_a");
+    threads.emplace_back([&, ticket]()
+                        {
+                          ASSERT_TRUE(limiter.Acquire("host_a", ticket, []() { return false; }));
+                          const unsigned int now_running = ++running;
+                          unsigned int expected = max_running;
+                          while ((now_running > expected) && !max_running.compare_exchange_weak(expected, now_running)) {}
+                          std::this_thread::sleep_for(std::chrono::milliseconds(20));
+                          --running;
+                          limiter.Release("host_a");
+                        });
+  }
+
+  // Other hosts have their own limit
+  for (int i = 0; i < 2; i++)
+  {
+    const uint64_t ticket = limiter.Enqueue("host_b");
+    ASSERT_TRUE(limiter.Acquire("host_b", ticket, []() { return false; }));
+    running_other_host++;
+  }
+  EXPECT_EQ(running_other_host, 2u);
+  limiter.Release("host_b");
+  limiter.Release("host_b");
+
+  for (auto& thread : threads)
+    thread.join();
+
+  EXPECT_EQ(max_running, max_parallel);
+}
+
+TEST(sys_core, HostStartLimiter_KeepsOrder)
+{
+  eCAL::sys::HostStartLimiter limiter(1);
+
+  std::vector<uint64_t> tickets;
+  for (int i = 0; i < 5; i++)
+    tickets.push_back(limiter.Enqueue("host"));
+
+  std::mutex            order_mutex;
+  std::vector<uint64_t> order;
+
+  // Acquire in reverse order, the requests must still run in the order they have been enqueued
+  std::vector<std::thread> threads;
+  for (auto it = tickets.rbegin(); it != tickets.rend(); ++it)
+  {
+    const uint64_t ticket = *it;
+    threads.emplace_back([&, ticket]()
+                        {
+                          ASSERT_TRUE(limiter.Acquire("host", ticket, []() { return false; }));
+                          {
+                            const std::lock_guard<std::mutex> lock(order_mutex);
+                            order.push_back(ticket);
+                          }
+                          limiter.Release("host");
+                        });
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+
+  for (auto& thread : threads)
+    thread.join();
+
+  EXPECT_EQ(order, tickets);
+}
+
+TEST(sys_core, HostStartLimiter_Interrupted)
+{
+  eCAL::sys::HostStartLimiter limiter(1);
+
+  const uint64_t first  = limiter.Enqueue("host");
+  const uint64_t second = limiter.Enqueue("host");
+  const uint64_t third  = limiter.Enqueue("host");
+
+  ASSERT_TRUE(limiter.Acquire("host", first, []() { return false; }));
+
+  // The second request gives up while waiting and must not block the queue
+  EXPECT_FALSE(limiter.Acquire("host", second, []() { return true; }));
+
+  limiter.Release("host");
+  EXPECT_TRUE(limiter.Acquire("host", third, []() { return false; }));
+  limiter.Release("host");
+}
+
+TEST(sys_core, HostStartSlot_ReleasedOnException)
+{
+  eCAL::sys::HostStartLimiter limiter(1);
+
+  // Sending the request fails with an exception
+  const uint64_t first = limiter.Enqueue("host");
+  EXPECT_THROW(
+    {
+      const eCAL::sys::HostStartSlot start_slot(limiter, "host", first, []() { return false; });
+      ASSERT_TRUE(start_slot.IsAcquired());
+      throw std::runtime_error("Unable to contact client");
+    }, std::runtime_error);
+
+  // The slot must have been returned, so the next request doesn't block
+  const uint64_t second = limiter.Enqueue("host");
+  const eCAL::sys::HostStartSlot start_slot(limiter, "host", second, []() { return false; });
+  EXPECT_TRUE(start_slot.IsAcquired());
+}
+
+TEST(sys_core, HostStartSlot_Interrupted)
+{
+  eCAL::sys::HostStartLimiter limiter(1);
+
+  const uint64_t first  = limiter.Enqueue("host");
+  const uint64_t second = limiter.Enqueue("host");
+  const uint64_t third  = limiter.Enqueue("host");
+
+  {
+    const eCAL::sys::HostStartSlot first_slot(limiter, "host", first, []() { return false; });
+    ASSERT_TRUE(first_slot.IsAcquired());
+
+    // An interrupted slot has nothing to release
+    const eCAL::sys::HostStartSlot second_slot(limiter, "host", second, []() { return true; });
+    EXPECT_FALSE(second_slot.IsAcquired());
+  }
+
+  const eCAL::sys::HostStartSlot third_slot(limiter, "host", third, []() { return false; });
+  EXPECT_TRUE(third_slot.IsAcquired());
+}
@@ -170,6 +170,25 @@ namespace eCAL
       */
       void SetOneFilePerChannelEnabled(bool enabled);
 
+      /**
+      * @brief Sets the compression of the payloads of all channels without individual settings
+      *
+      * Compression is only applied by writers of the current file format and
+      * only if the deflate filter is available. Otherwise payloads are stored
+      * uncompressed.
+      *
+      * @param settings   compression settings
+      **/
+      void SetCompression(const SCompressionSettings& settings);
+
+      /**
+      * @brief Sets the compression of the payloads of the given channel
+      *
+      * @param channel_name   channel name
+      * @param settings       compression settings
+      **/
+      void SetChannelCompression(const std::string& channel_name, const SCompressionSettings& settings);
+
       /**
        * @brief Get the available channel names of the current opened file / measurement
        *
@@ -281,6 +300,34 @@ namespace eCAL
       **/
       bool GetEntriesInfoRange(const std::string& channel_name, long long begin, long long end, EntryInfoSet& entries) const;
 
+      /**
+       * @brief Gets the header info for all data entries for the given channel as flat vector
+       *        Header = timestamp + entry id
+       *
+       *        The entries of all channels with the given name are merged and
+       *        sorted by receive timestamp.
+       *
+       * @param [in]  channel_name  channel name
+       * @param [out] entries       header info for all data entries
+       *
+       * @return                    true if succeeds, false if it fails
+      **/
+      bool GetEntriesInfo(const std::string& channel_name, EntryInfoVect& entries) const;
+
+      /**
+       * @brief Gets the header info for data entries for the given channel included in given time range (begin->end)
+       *        as flat vector, sorted by receive timestamp
+       *        Header = timestamp + entry id
+       *
+       * @param [in]  channel_name channel name
+       * @param [in]  begin        time range begin timestamp
+       * @param [in]  end          time range end timestamp
+       * @param [out] entries      header info for data entries in given range
+       *
+       * @return                   true if succeeds, false if it fails
+      **/
+      bool GetEntriesInfoRange(const std::string& channel_name, long long begin, long long end, EntryInfoVect& entries) const;
+
       /**
        * @brief Gets data size of a specific entry
        *
@@ -301,6 +348,20 @@ namespace eCAL
       **/
       bool GetEntryData(long long entry_id, void* data) const;
 
+      /**
+       * @brief Gets a read-only view on the data of a specific entry without copying it
+       *
+       * The view points directly into a memory mapping of the measurement
+       * file. This only works for uncompressed payloads, so callers have to
+       * fall back to GetEntryData() if this function fails.
+       *
+       * @param [in]  entry_id   Entry ID
+       * @param [out] view       View on the entry data
+       *
+       * @return                 true if succeeds, false if the entry cannot be accessed directly
+      **/
+      bool GetEntryDataView(long long entry_id, SEntryDataView& view) const;
+
       /**
        * @brief Set measurement file base name (desired name for the actual hdf5 files that will be created)
        *
@@ -24,6 +24,8 @@
 
 #pragma once
 
+#include <cstddef>
+#include <memory>
 #include <set>
 #include <string>
 #include <vector>
@@ -71,7 +73,44 @@ namespace eCAL
         CREATE_V5  //!< Create a legacy V5 hdf5 measurement (For testing purpose only!)
       };
     }
+
+    /**
+     * @brief Compression that is applied to the payload datasets of a channel
+    **/
+    enum class eCompressionType
+    {
+      NONE,      //!< Payloads are stored uncompressed
+      DEFLATE,   //!< Payloads are compressed with the HDF5 deflate (zlib) filter
+    };
+
+    /**
+     * @brief Compression settings for writing payload datasets
+     *
+     * Compressed payloads are decompressed transparently by every HDF5 reader
+     * that supports the deflate filter.
+    **/
+    struct SCompressionSettings
+    {
+      eCompressionType type             = eCompressionType::NONE;  //!< Compression algorithm
+      int              level            = 1;                       //!< Compression level (1 = fastest, 9 = smallest)
+      size_t           min_payload_size = 1024;                    //!< Payloads smaller than this are always stored uncompressed
+    };
   
+    /**
+     * @brief Read-only view on the payload of an entry
+     *
+     * The view points directly into a memory mapping of the measurement file,
+     * so no data is copied. The mapping is kept alive by the view itself and
+     * all of its copies, so the view stays valid even after the measurement
+     * has been closed.
+    **/
+    struct SEntryDataView
+    {
+      const void*                 data = nullptr;  //!< Payload of the entry (nullptr for empty entries)
+      size_t                      size = 0;        //!< Payload size in bytes
+      std::shared_ptr<const void> handle;          //!< Keeps the underlying file mapping alive
+    };
+
     using eCAL::experimental::measurement::base::DataTypeInformation;
     //!< @endcond
   }  // namespace eh5
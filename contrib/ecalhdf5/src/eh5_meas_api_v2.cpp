@@ -28,6 +28,7 @@
 
 #include <ecalhdf5/eh5_meas_api_v3.h>
 #include "datatype_helper.h"
+#include "entry_info_helper.h"
 
 
 namespace {
@@ -121,6 +122,16 @@ void eCAL::eh5::v2::HDF5Meas::SetOneFilePerChannelEnabled(bool enabled)
   return hdf_meas_impl_->SetOneFilePerChannelEnabled(enabled);
 }
 
+void eCAL::eh5::v2::HDF5Meas::SetCompression(const SCompressionSettings& settings)
+{
+  return hdf_meas_impl_->SetCompression(settings);
+}
+
+void eCAL::eh5::v2::HDF5Meas::SetChannelCompression(const std::string& channel_name, const SCompressionSettings& settings)
+{
+  return hdf_meas_impl_->SetChannelCompression(channel_name, settings);
+}
+
 std::set<std::string> eCAL::eh5::v2::HDF5Meas::GetChannelNames() const
 {
   auto channels = hdf_meas_impl_->GetChannels();
@@ -245,6 +256,36 @@ bool eCAL::eh5::v2::HDF5Meas::GetEntriesInfoRange(const std::string& channel_nam
   return ret_value;
 }
 
+bool eCAL::eh5::v2::HDF5Meas::GetEntriesInfo(const std::string& channel_name, EntryInfoVect& entries) const
+{
+  // we need to aggregate info from all channels within the measurement with a given name.
+  auto named_channels = GetChannelsWithName(hdf_meas_impl_, channel_name);
+  std::vector<EntryInfoVect> channel_entries(named_channels.size());
+  bool ret_value{ true };
+  size_t index = 0;
+  for (const auto& channel : named_channels)
+  {
+    ret_value &= hdf_meas_impl_->GetEntriesInfo(channel, channel_entries[index++]);
+  }
+  MergeEntryInfoVects(channel_entries, entries);
+  return ret_value;
+}
+
+bool eCAL::eh5::v2::HDF5Meas::GetEntriesInfoRange(const std::string& channel_name, long long begin, long long end, EntryInfoVect& entries) const
+{
+  // we need to aggregate info from all channels within the measurement with a given name.
+  auto named_channels = GetChannelsWithName(hdf_meas_impl_, channel_name);
+  std::vector<EntryInfoVect> channel_entries(named_channels.size());
+  bool ret_value{ true };
+  size_t index = 0;
+  for (const auto& channel : named_channels)
+  {
+    ret_value &= hdf_meas_impl_->GetEntriesInfoRange(channel, begin, end, channel_entries[index++]);
+  }
+  MergeEntryInfoVects(channel_entries, entries);
+  return ret_value;
+}
+
 bool eCAL::eh5::v2::HDF5Meas::GetEntryDataSize(long long entry_id, size_t& size) const
 {
   return hdf_meas_impl_->GetEntryDataSize(entry_id, size);
@@ -255,6 +296,11 @@ bool eCAL::eh5::v2::HDF5Meas::GetEntryData(long long entry_id, void* data) const
   return hdf_meas_impl_->GetEntryData(entry_id, data);
 }
 
+bool eCAL::eh5::v2::HDF5Meas::GetEntryDataView(long long entry_id, SEntryDataView& view) const
+{
+  return hdf_meas_impl_->GetEntryDataView(entry_id, view);
+}
+
 void eCAL::eh5::v2::HDF5Meas::SetFileBaseName(const std::string& base_name)
 {
   return hdf_meas_impl_->SetFileBaseName(base_name);
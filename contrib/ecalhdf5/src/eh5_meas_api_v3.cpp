@@ -216,6 +216,22 @@ void eCAL::eh5::v3::HDF5Meas::SetOneFilePerChannelEnabled(bool enabled)
   }
 }
 
+void eCAL::eh5::v3::HDF5Meas::SetCompression(const SCompressionSettings& settings)
+{
+  if (hdf_meas_impl_ != nullptr)
+  {
+    hdf_meas_impl_->SetCompression(settings);
+  }
+}
+
+void eCAL::eh5::v3::HDF5Meas::SetChannelCompression(const std::string& channel_name, const SCompressionSettings& settings)
+{
+  if (hdf_meas_impl_ != nullptr)
+  {
+    hdf_meas_impl_->SetChannelCompression(GetEscapedTopicname(channel_name), settings);
+  }
+}
+
 std::set<eCAL::eh5::SChannel> eCAL::eh5::v3::HDF5Meas::GetChannels() const
 {
   std::set<eCAL::eh5::SChannel> ret_val;
@@ -305,6 +321,28 @@ bool eCAL::eh5::v3::HDF5Meas::GetEntriesInfoRange(const SChannel& channel, long
   return ret_val;
 }
 
+bool eCAL::eh5::v3::HDF5Meas::GetEntriesInfo(const SChannel& channel, EntryInfoVect& entries) const
+{
+  bool ret_val = false;
+  if (hdf_meas_impl_)
+  {
+    ret_val = hdf_meas_impl_->GetEntriesInfo(SEscapedChannel::fromSChannel(channel), entries);
+  }
+
+  return ret_val;
+}
+
+bool eCAL::eh5::v3::HDF5Meas::GetEntriesInfoRange(const SChannel& channel, long long begin, long long end, EntryInfoVect& entries) const
+{
+  bool ret_val = false;
+  if (hdf_meas_impl_ && begin < end)
+  {
+    ret_val = hdf_meas_impl_->GetEntriesInfoRange(SEscapedChannel::fromSChannel(channel), begin, end, entries);
+  }
+
+  return ret_val;
+}
+
 bool eCAL::eh5::v3::HDF5Meas::GetEntryDataSize(long long entry_id, size_t& size) const
 {
   bool ret_val = false;
@@ -327,6 +365,17 @@ bool eCAL::eh5::v3::HDF5Meas::GetEntryData(long long entry_id, void* data) const
   return ret_val;
 }
 
+bool eCAL::eh5::v3::HDF5Meas::GetEntryDataView(long long entry_id, SEntryDataView& view) const
+{
+  bool ret_val = false;
+  if (hdf_meas_impl_)
+  {
+    return hdf_meas_impl_->GetEntryDataView(entry_id, view);
+  }
+
+  return ret_val;
+}
+
 void eCAL::eh5::v3::HDF5Meas::SetFileBaseName(const std::string& base_name)
 {
   if (hdf_meas_impl_)
@@ -22,6 +22,7 @@
 **/
 
 #include "eh5_meas_dir.h"
+#include "entry_info_helper.h"
 #include "escape.h"
 
 #define NOMINMAX
@@ -35,6 +36,7 @@
 #include <limits>
 #include <list>
 #include <string>
+#include <vector>
 
 #include <ecal_utils/filesystem.h>
 #include <ecal_utils/str_convert.h>
@@ -177,6 +179,28 @@ void eCAL::eh5::HDF5MeasDir::SetMaxSizePerFile(size_t max_file_size_mib)
   }
 }
 
+void eCAL::eh5::HDF5MeasDir::SetCompression(const SCompressionSettings& settings)
+{
+  compression_ = settings;
+
+  // Update all file writers (if there are any)
+  for (auto& file_writer : file_writers_)
+  {
+    file_writer.second->SetCompression(settings);
+  }
+}
+
+void eCAL::eh5::HDF5MeasDir::SetChannelCompression(const std::string& channel_name, const SCompressionSettings& settings)
+{
+  channel_compression_[channel_name] = settings;
+
+  // Update all file writers (if there are any)
+  for (auto& file_writer : file_writers_)
+  {
+    file_writer.second->SetChannelCompression(channel_name, settings);
+  }
+}
+
 bool eCAL::eh5::HDF5MeasDir::IsOneFilePerChannelEnabled() const
 {
   return one_file_per_channel_;
@@ -267,7 +291,7 @@ bool eCAL::eh5::HDF5MeasDir::GetEntriesInfo(const SEscapedChannel& channel, Entr
     return false;
   }
 
-  entries = channel_it->second;
+  entries.insert(channel_it->second.begin(), channel_it->second.end());
 
   return !entries.empty();
 }
@@ -276,19 +300,42 @@ bool eCAL::eh5::HDF5MeasDir::GetEntriesInfoRange(const SEscapedChannel& channel,
 {
   entries.clear();
 
+  EntryInfoVect range_entries;
+  if (!GetEntriesInfoRange(channel, begin, end, range_entries))
+  {
+    return false;
+  }
+
+  entries.insert(range_entries.begin(), range_entries.end());
+  return true;
+}
+
+bool eCAL::eh5::HDF5MeasDir::GetEntriesInfo(const SEscapedChannel& channel, EntryInfoVect& entries) const
+{
+  entries.clear();
+
   const auto& channel_it = entries_by_chn_.find(channel);
   if (channel_it == entries_by_chn_.end())
   {
     return false;
   }
 
-  if (begin == 0) begin = entries.begin()->RcvTimestamp;
-  if (end == 0) end = entries.rbegin()->RcvTimestamp;
+  entries = channel_it->second;
 
-  const auto& lower = channel_it->second.lower_bound(SEntryInfo(begin, 0, 0));
-  const auto& upper = channel_it->second.upper_bound(SEntryInfo(end, 0, 0));
+  return !entries.empty();
+}
 
-  entries.insert(lower, upper);
+bool eCAL::eh5::HDF5MeasDir::GetEntriesInfoRange(const SEscapedChannel& channel, long long begin, long long end, EntryInfoVect& entries) const
+{
+  entries.clear();
+
+  const auto& channel_it = entries_by_chn_.find(channel);
+  if (channel_it == entries_by_chn_.end())
+  {
+    return false;
+  }
+
+  CopyEntryInfoRange(channel_it->second, begin, end, entries);
   return true;
 }
 
@@ -314,6 +361,17 @@ bool eCAL::eh5::HDF5MeasDir::GetEntryData(long long entry_id, void* data) const
   return ret_val;
 }
 
+bool eCAL::eh5::HDF5MeasDir::GetEntryDataView(long long entry_id, SEntryDataView& view) const
+{
+  auto ret_val = false;
+  const auto& found = entries_by_id_.find(entry_id);
+  if (found != entries_by_id_.end())
+  {
+    ret_val = found->second.reader->GetEntryDataView(found->second.file_id, view);
+  }
+  return ret_val;
+}
+
 void eCAL::eh5::HDF5MeasDir::SetFileBaseName(const std::string& base_name)
 {
   base_name_ = base_name;
@@ -432,6 +490,10 @@ bool eCAL::eh5::HDF5MeasDir::OpenRX(const std::string& path, v3::eAccessType acc
 
   long long id = 0;
 
+  // Each file contributes one sorted run per channel. The runs are merged
+  // after all files have been opened.
+  std::unordered_map<SEscapedChannel, std::vector<EntryInfoVect>> entry_runs_by_chn;
+
   for (const auto& file_path : files)
   {
     auto reader = new eCAL::eh5::v3::HDF5Meas(file_path);
@@ -448,16 +510,16 @@ bool eCAL::eh5::HDF5MeasDir::OpenRX(const std::string& path, v3::eAccessType acc
         channel_info.info = info;
         channel_info.files.push_back(reader);
 
-        EntryInfoSet entries;
+        EntryInfoVect entries;
         if (reader->GetEntriesInfo(channel, entries))
         {
-          for (auto entry : entries)
+          for (auto& entry : entries)
           {
             entries_by_id_[id] = EntryInfo(entry.ID, reader);
             entry.ID = id;
-            entries_by_chn_[escaped_channel].insert(entry);
             id++;
           }
+          entry_runs_by_chn[escaped_channel].push_back(std::move(entries));
         }
       }
       file_readers_.push_back(reader);
@@ -469,6 +531,12 @@ bool eCAL::eh5::HDF5MeasDir::OpenRX(const std::string& path, v3::eAccessType acc
       reader = nullptr;
     }
   }
+
+  for (const auto& channel_runs : entry_runs_by_chn)
+  {
+    MergeEntryInfoVects(channel_runs.second, entries_by_chn_[channel_runs.first]);
+  }
+
   return !file_readers_.empty();
 }
 
@@ -497,6 +565,9 @@ bool eCAL::eh5::HDF5MeasDir::OpenRX(const std::string& path, v3::eAccessType acc
     file_writer_it->second->SetFileBaseName(one_file_per_channel_ ? (base_name_ + "_" + GetEscapedFilename(GetUnescapedString(channel_name))) : (base_name_));
     if (cb_pre_split_)
       file_writer_it->second->ConnectPreSplitCallback(cb_pre_split_);
+    file_writer_it->second->SetCompression(compression_);
+    for (const auto& channel_compression : channel_compression_)
+      file_writer_it->second->SetChannelCompression(channel_compression.first, channel_compression.second);
 
     // Open the writer
     file_writer_it->second->Open(output_dir_);
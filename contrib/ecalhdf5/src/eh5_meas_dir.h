@@ -204,6 +204,30 @@ namespace eCAL
       **/
       bool GetEntriesInfoRange(const SEscapedChannel& channel, long long begin, long long end, EntryInfoSet& entries) const override;
 
+      /**
+      * @brief Gets the header info for all data entries for the given channel as flat vector,
+      *        sorted by receive timestamp
+      *
+      * @param [in]  channel_name  channel name
+      * @param [out] entries       header info for all data entries
+      *
+      * @return                    true if succeeds, false if it fails
+      **/
+      bool GetEntriesInfo(const SEscapedChannel& channel, EntryInfoVect& entries) const override;
+
+      /**
+      * @brief Gets the header info for data entries for the given channel included in given time range (begin->end)
+      *        as flat vector, sorted by receive timestamp
+      *
+      * @param [in]  channel_name channel name
+      * @param [in]  begin        time range begin timestamp
+      * @param [in]  end          time range end timestamp
+      * @param [out] entries      header info for data entries in given range
+      *
+      * @return                   true if succeeds, false if it fails
+      **/
+      bool GetEntriesInfoRange(const SEscapedChannel& channel, long long begin, long long end, EntryInfoVect& entries) const override;
+
       /**
       * @brief Gets data size of a specific entry
       *
@@ -224,6 +248,16 @@ namespace eCAL
       **/
       bool GetEntryData(long long entry_id, void* data) const override;
 
+      /**
+      * @brief Gets a read-only view on the data of a specific entry without copying it
+      *
+      * @param [in]  entry_id   Entry ID
+      * @param [out] view       View on the entry data
+      *
+      * @return                 true if succeeds, false if the entry cannot be accessed directly
+      **/
+      bool GetEntryDataView(long long entry_id, SEntryDataView& view) const override;
+
       /**
       * @brief Set measurement file base name
       *
@@ -246,6 +280,21 @@ namespace eCAL
       **/
       bool AddEntryToFile(const SEscapedWriteEntry& entry) override;
 
+      /**
+      * @brief Sets the compression of the payloads of all channels without individual settings
+      *
+      * @param settings   compression settings
+      **/
+      void SetCompression(const SCompressionSettings& settings) override;
+
+      /**
+      * @brief Sets the compression of the payloads of the given channel
+      *
+      * @param channel_name   channel name
+      * @param settings       compression settings
+      **/
+      void SetChannelCompression(const std::string& channel_name, const SCompressionSettings& settings) override;
+
       typedef std::function<void(void)> CallbackFunction;
       /**
       * @brief Connect callback for pre file split notification
@@ -291,7 +340,7 @@ namespace eCAL
       using HDF5Files = std::list<eCAL::eh5::v3::HDF5Meas*>;
       using ChannelInfoUMap = std::unordered_map<SEscapedChannel, ChannelInfo>;
       using EntriesByIdUMap = std::unordered_map<long long, EntryInfo>;
-      using EntriesByChannelUMap =  std::unordered_map<SEscapedChannel, EntryInfoSet>;
+      using EntriesByChannelUMap =  std::unordered_map<SEscapedChannel, EntryInfoVect>; //!< Entries of each channel, merged from all files and sorted by receive timestamp
 
       HDF5Files              file_readers_;
       ChannelInfoUMap        channels_info_;
@@ -335,6 +384,8 @@ namespace eCAL
 
       size_t              max_size_per_file_;                                   //!< Maximum file size after which the File Writer shall split
       CallbackFunction    cb_pre_split_;                                        //!< Callback that is executed before a new hdf5 file is created during splitting. Will be executed by each file writer individually.
+      SCompressionSettings                        compression_;                 //!< Compression of all channels without individual settings
+      std::map<std::string, SCompressionSettings> channel_compression_;         //!< Individual compression settings by channel name
 
     protected:
       /**
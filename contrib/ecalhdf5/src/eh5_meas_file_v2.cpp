@@ -67,6 +67,7 @@ bool eCAL::eh5::HDF5MeasFileV2::Open(const std::string& path, v3::eAccessType ac
   if (access != v3::eAccessType::RDONLY) return false;
 
   file_id_ = H5Fopen(path.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+  path_    = path;
 
   // call the function via its class becase it's a virtual function that is called directly/indirectly in constructor/destructor,-
   // where the vtable is not created yet or it's destructed.
@@ -76,6 +77,13 @@ bool eCAL::eh5::HDF5MeasFileV2::Open(const std::string& path, v3::eAccessType ac
 
 bool eCAL::eh5::HDF5MeasFileV2::Close()
 {
+  {
+    // Views that have already been handed out keep their own reference to the mapping
+    std::lock_guard<std::mutex> file_mapping_lock(file_mapping_mutex_);
+    file_mapping_.reset();
+    file_mapping_failed_ = false;
+  }
+
   if (HDF5MeasFileV2::IsOk() && H5Fclose(file_id_) >= 0)
   {
     file_id_ = -1;
@@ -258,11 +266,11 @@ bool eCAL::eh5::HDF5MeasFileV2::GetEntryDataSize(long long entry_id, size_t& siz
 
   if (dataset_id < 0) return false;
 
-  size = static_cast<size_t>(H5Dget_storage_size(dataset_id));
+  const bool size_status = GetPayloadSize(dataset_id, size);
 
   H5Dclose(dataset_id);
 
-  return true;
+  return size_status;
 }
 
 bool eCAL::eh5::HDF5MeasFileV2::GetEntryData(long long entry_id, void* data) const
@@ -275,10 +283,10 @@ bool eCAL::eh5::HDF5MeasFileV2::GetEntryData(long long entry_id, void* data) con
 
   if (dataset_id < 0) return false;
 
-  auto size = H5Dget_storage_size(dataset_id);
+  size_t size = 0;
 
   herr_t read_status = -1;
-  if (size >= 0)
+  if (GetPayloadSize(dataset_id, size))
   {
     read_status = H5Dread(dataset_id, H5T_NATIVE_UCHAR, H5S_ALL, H5S_ALL, H5P_DEFAULT, data);
   }
@@ -288,6 +296,53 @@ bool eCAL::eh5::HDF5MeasFileV2::GetEntryData(long long entry_id, void* data) con
   return (read_status >= 0);
 }
 
+bool eCAL::eh5::HDF5MeasFileV2::GetEntryDataView(long long entry_id, SEntryDataView& view) const
+{
+  if (!this->IsOk()) return false;
+
+  auto dataset_id = H5Dopen(file_id_, std::to_string(entry_id).c_str(), H5P_DEFAULT);
+
+  if (dataset_id < 0) return false;
+
+  size_t size   = 0;
+  size_t offset = 0;
+  const bool size_status   = GetPayloadSize(dataset_id, size);
+  const bool offset_status = size_status && (size > 0) && GetContiguousPayloadOffset(dataset_id, offset);
+
+  H5Dclose(dataset_id);
+
+  if (!size_status) return false;
+
+  if (size == 0)
+  {
+    view = SEntryDataView();
+    return true;
+  }
+
+  if (!offset_status) return false;
+
+  auto file_mapping = GetFileMapping();
+  if (!file_mapping || (offset > file_mapping->Size()) || (size > file_mapping->Size() - offset)) return false;
+
+  view.data   = file_mapping->Data() + offset;
+  view.size   = size;
+  view.handle = std::move(file_mapping);
+  return true;
+}
+
+std::shared_ptr<const eCAL::eh5::FileMapping> eCAL::eh5::HDF5MeasFileV2::GetFileMapping() const
+{
+  std::lock_guard<std::mutex> file_mapping_lock(file_mapping_mutex_);
+
+  // Don't try again on every entry, if the file cannot be mapped at all
+  if (!file_mapping_ && !file_mapping_failed_)
+  {
+    file_mapping_        = FileMapping::Create(path_);
+    file_mapping_failed_ = !file_mapping_;
+  }
+
+  return file_mapping_;
+}
 
 void eCAL::eh5::HDF5MeasFileV2::SetFileBaseName(const std::string& /*base_name*/)
 {
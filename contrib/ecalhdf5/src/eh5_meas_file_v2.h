@@ -26,6 +26,11 @@
 #include "hdf5.h"
 #include "eh5_meas_impl.h"
 #include "escape.h"
+#include "file_mapping.h"
+
+#include <memory>
+#include <mutex>
+#include <string>
 
 namespace eCAL
 {
@@ -215,6 +220,19 @@ namespace eCAL
       **/
       bool GetEntryData(long long entry_id, void* data) const override;
 
+      /**
+      * @brief Gets a read-only view on the data of a specific entry without copying it
+      *
+      * This only works for uncompressed, contiguous payloads. The file is
+      * mapped into memory on the first call.
+      *
+      * @param [in]  entry_id   Entry ID
+      * @param [out] view       View on the entry data
+      *
+      * @return                 true if succeeds, false if the entry cannot be accessed directly
+      **/
+      bool GetEntryDataView(long long entry_id, SEntryDataView& view) const override;
+
       /**
       * @brief Set measurement file base name
       *
@@ -253,6 +271,14 @@ namespace eCAL
 
     protected:
       hid_t file_id_;
+
+    private:
+      std::shared_ptr<const FileMapping> GetFileMapping() const;
+
+      std::string                                path_;
+      mutable std::mutex                         file_mapping_mutex_;
+      mutable std::shared_ptr<const FileMapping> file_mapping_;
+      mutable bool                               file_mapping_failed_ = false;
     };
 
   }  // namespace eh5
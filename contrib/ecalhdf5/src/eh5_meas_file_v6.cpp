@@ -25,6 +25,7 @@
 
 #include "hdf5.h"
 #include "hdf5_helper.h"
+#include "entry_info_helper.h"
 
 namespace eCAL
 {
@@ -124,5 +125,32 @@ namespace eCAL
 
       return true;
     }
+
+    bool eCAL::eh5::HDF5MeasFileV6::GetEntriesInfo(const SEscapedChannel& channel, EntryInfoVect& entries) const
+    {
+      entries.clear();
+
+      if (!this->IsOk()) return false;
+
+      auto hex_id = printHex(channel.id);
+      auto url = v6::GetUrl(channel.name, hex_id, kChnIdData);
+      GetEntryInfoVector(file_id_, url, entries);
+
+      // entries are written in receive order, so this is usually a no-op
+      SortEntryInfoVect(entries);
+
+      return true;
+    }
+
+    bool eCAL::eh5::HDF5MeasFileV6::GetEntriesInfoRange(const SEscapedChannel& channel, long long begin, long long end, EntryInfoVect& entries) const
+    {
+      EntryInfoVect all_entries;
+      entries.clear();
+
+      if (!GetEntriesInfo(channel, all_entries) || all_entries.empty()) return false;
+
+      CopyEntryInfoRange(all_entries, begin, end, entries);
+      return true;
+    }
   }  //  namespace eh5
 }  //  namespace eCAL
@@ -71,6 +71,10 @@ namespace eCAL
       DataTypeInformation GetChannelDataTypeInformation(const SEscapedChannel& channel) const override;
 
       bool GetEntriesInfo(const SEscapedChannel& channel, EntryInfoSet& entries) const override;
+
+      bool GetEntriesInfo(const SEscapedChannel& channel, EntryInfoVect& entries) const override;
+
+      bool GetEntriesInfoRange(const SEscapedChannel& channel, long long begin, long long end, EntryInfoVect& entries) const override;
     };
   }  //  namespace eh5
 }  //  namespace eCAL
@@ -46,6 +46,7 @@ eCAL::eh5::HDF5MeasFileWriterV6::HDF5MeasFileWriterV6()
   , file_split_counter_(-1)
   , entries_counter_   (0)
   , max_size_per_file_ (kDefaultMaxFileSizeMB * 1024 * 1024)
+  , payload_writer_    (std::make_unique<PayloadWriter>())
 {}
 
 eCAL::eh5::HDF5MeasFileWriterV6::~HDF5MeasFileWriterV6()
@@ -72,6 +73,9 @@ bool eCAL::eh5::HDF5MeasFileWriterV6::Close()
 {
   if (!this->IsOk())  return false;
 
+  // Write all payloads that are still being compressed
+  payload_writer_->Flush(file_id_);
+
   std::string channels_with_entries;
 
   for (const auto& channel_per_name : channels_)
@@ -217,30 +221,25 @@ bool eCAL::eh5::HDF5MeasFileWriterV6::AddEntryToFile(const SEscapedWriteEntry& e
       return false;
   }
 
-  //  Create DataSpace with rank 1 and size dimension
-  auto dataSpace = H5Screate_simple(1, &hsSize, nullptr);
-
-  //  Create creation property for dataSpace
-  auto dsProperty = H5Pcreate(H5P_DATASET_CREATE);
-  H5Pset_obj_track_times(dsProperty, false);
-
-  //  Create dataset in dataSpace
-  auto dataSet = H5Dcreate(file_id_, std::to_string(entries_counter_).c_str(), H5T_NATIVE_UCHAR, dataSpace, H5P_DEFAULT, dsProperty, H5P_DEFAULT);
-
-  //  Write buffer to dataset
-  herr_t writeStatus = H5Dwrite(dataSet, H5T_NATIVE_UCHAR, H5S_ALL, H5S_ALL, H5P_DEFAULT, entry.data);
-
-  //  Close dataset, data space, and data set property
-  H5Dclose(dataSet);
-  H5Pclose(dsProperty);
-  H5Sclose(dataSpace);
+  //  Write payload (compressed payloads may be written asynchronously)
+  const bool writeStatus = payload_writer_->Write(file_id_, entries_counter_, entry.channel.name, entry.data, static_cast<size_t>(entry.size));
 
   // TODO: check here about id vs channel.id
   channels_[entry.channel.name][entry.channel.id].Entries.emplace_back(SEntryInfo(entry.rcv_timestamp, static_cast<long long>(entries_counter_), entry.clock, entry.snd_timestamp, entry.sender_id));
 
   entries_counter_++;
 
-  return (writeStatus >= 0);
+  return writeStatus;
+}
+
+void eCAL::eh5::HDF5MeasFileWriterV6::SetCompression(const SCompressionSettings& settings)
+{
+  payload_writer_->SetCompression(settings);
+}
+
+void eCAL::eh5::HDF5MeasFileWriterV6::SetChannelCompression(const std::string& channel_name, const SCompressionSettings& settings)
+{
+  payload_writer_->SetChannelCompression(channel_name, settings);
 }
 
 void eCAL::eh5::HDF5MeasFileWriterV6::ConnectPreSplitCallback(CallbackFunction cb)
@@ -295,6 +294,9 @@ bool eCAL::eh5::HDF5MeasFileWriterV6::EntryFitsTheFile(const hsize_t& size) cons
   hsize_t fileSize = 0;
   bool status = GetFileSize(fileSize);
 
+  //  payloads that are still being compressed will be written to the current file, as well
+  fileSize += static_cast<hsize_t>(payload_writer_->GetPendingBytes());
+
   //  check if buffer fits the current file
   return (status && ((fileSize + size) <= max_size_per_file_));
 }
@@ -25,10 +25,12 @@
 
 #include <list>
 #include <map>
+#include <memory>
 #include <string>
 #include <unordered_map>
 
 #include "eh5_meas_impl.h"
+#include "payload_writer.h"
 
 #include "hdf5.h"
 #include "escape.h"
@@ -244,6 +246,21 @@ namespace eCAL
       **/
       bool AddEntryToFile(const SEscapedWriteEntry& entry) override;
 
+      /**
+      * @brief Sets the compression of the payloads of all channels without individual settings
+      *
+      * @param settings   compression settings
+      **/
+      void SetCompression(const SCompressionSettings& settings) override;
+
+      /**
+      * @brief Sets the compression of the payloads of the given channel
+      *
+      * @param channel_name   channel name
+      * @param settings       compression settings
+      **/
+      void SetChannelCompression(const std::string& channel_name, const SCompressionSettings& settings) override;
+
       using CallbackFunction = std::function<void ()>;
       /**
       * @brief Connect callback for pre file split notification
@@ -274,6 +291,7 @@ namespace eCAL
       int                      file_split_counter_;
       unsigned long long       entries_counter_;
       size_t                   max_size_per_file_;
+      std::unique_ptr<PayloadWriter> payload_writer_;
 
       /**
       * @brief Creates the actual file
@@ -186,6 +186,45 @@ namespace eCAL
       **/
       virtual bool GetEntriesInfoRange(const SEscapedChannel& channel, long long begin, long long end, EntryInfoSet& entries) const = 0;
 
+      /**
+      * @brief Gets the header info for all data entries for the given channel as flat vector,
+      *        sorted by receive timestamp
+      *
+      *        The default implementation converts the result of the set based
+      *        function. Readers that can fill the vector directly should override it.
+      *
+      * @param [in]  channel_name  channel name
+      * @param [out] entries       header info for all data entries
+      *
+      * @return                    true if succeeds, false if it fails
+      **/
+      virtual bool GetEntriesInfo(const SEscapedChannel& channel, EntryInfoVect& entries) const
+      {
+        EntryInfoSet entry_set;
+        const bool ret_val = GetEntriesInfo(channel, entry_set);
+        entries.assign(entry_set.begin(), entry_set.end());
+        return ret_val;
+      }
+
+      /**
+      * @brief Gets the header info for data entries for the given channel included in given time range (begin->end)
+      *        as flat vector, sorted by receive timestamp
+      *
+      * @param [in]  channel_name channel name
+      * @param [in]  begin        time range begin timestamp
+      * @param [in]  end          time range end timestamp
+      * @param [out] entries      header info for data entries in given range
+      *
+      * @return                   true if succeeds, false if it fails
+      **/
+      virtual bool GetEntriesInfoRange(const SEscapedChannel& channel, long long begin, long long end, EntryInfoVect& entries) const
+      {
+        EntryInfoSet entry_set;
+        const bool ret_val = GetEntriesInfoRange(channel, begin, end, entry_set);
+        entries.assign(entry_set.begin(), entry_set.end());
+        return ret_val;
+      }
+
       /**
       * @brief Gets data size of a specific entry
       *
@@ -206,6 +245,16 @@ namespace eCAL
       **/
       virtual bool GetEntryData(long long entry_id, void* data) const = 0;
 
+      /**
+      * @brief Gets a read-only view on the data of a specific entry without copying it
+      *
+      * @param [in]  entry_id   Entry ID
+      * @param [out] view       View on the entry data
+      *
+      * @return                 true if succeeds, false if the entry cannot be accessed directly (e.g. because it is compressed)
+      **/
+      virtual bool GetEntryDataView(long long /*entry_id*/, SEntryDataView& /*view*/) const { return false; }
+
       /**
       * @brief Set measurement file base name
       *
@@ -228,6 +277,23 @@ namespace eCAL
       **/
       virtual bool AddEntryToFile(const SEscapedWriteEntry& entry) = 0;
 
+      /**
+      * @brief Sets the compression of the payloads of all channels without individual settings
+      *        (only supported by writers)
+      *
+      * @param settings   compression settings
+      **/
+      virtual void SetCompression(const SCompressionSettings& /*settings*/) {}
+
+      /**
+      * @brief Sets the compression of the payloads of the given channel
+      *        (only supported by writers)
+      *
+      * @param channel_name   channel name
+      * @param settings       compression settings
+      **/
+      virtual void SetChannelCompression(const std::string& /*channel_name*/, const SCompressionSettings& /*settings*/) {}
+
       typedef std::function<void(void)> CallbackFunction;
       /**
       * @brief Connect callback for pre file split notification
@@ -0,0 +1,97 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  Helper functions for flat (sorted vector) entry info containers
+**/
+
+#include "entry_info_helper.h"
+
+#include <algorithm>
+#include <functional>
+#include <queue>
+#include <tuple>
+
+namespace eCAL
+{
+  namespace eh5
+  {
+    void SortEntryInfoVect(EntryInfoVect& entries)
+    {
+      if (!std::is_sorted(entries.begin(), entries.end()))
+      {
+        std::stable_sort(entries.begin(), entries.end());
+      }
+    }
+
+    void MergeEntryInfoVects(const std::vector<EntryInfoVect>& runs, EntryInfoVect& merged)
+    {
+      merged.clear();
+
+      size_t total_size = 0;
+      for (const auto& run : runs) total_size += run.size();
+      merged.reserve(total_size);
+
+      // trivial cases don't need the heap
+      if (runs.size() == 1)
+      {
+        merged = runs.front();
+        return;
+      }
+
+      // heap element: (receive timestamp, run index, position in run)
+      using HeapElement = std::tuple<long long, size_t, size_t>;
+      std::priority_queue<HeapElement, std::vector<HeapElement>, std::greater<HeapElement>> heap;
+
+      for (size_t run_index = 0; run_index < runs.size(); ++run_index)
+      {
+        if (!runs[run_index].empty())
+          heap.emplace(runs[run_index].front().RcvTimestamp, run_index, 0);
+      }
+
+      while (!heap.empty())
+      {
+        const auto top = heap.top();
+        heap.pop();
+
+        const auto& run      = runs[std::get<1>(top)];
+        const size_t pos     = std::get<2>(top);
+        merged.push_back(run[pos]);
+
+        if (pos + 1 < run.size())
+          heap.emplace(run[pos + 1].RcvTimestamp, std::get<1>(top), pos + 1);
+      }
+    }
+
+    void CopyEntryInfoRange(const EntryInfoVect& sorted_entries, long long begin, long long end, EntryInfoVect& entries)
+    {
+      entries.clear();
+      if (sorted_entries.empty()) return;
+
+      if (begin == 0) begin = sorted_entries.front().RcvTimestamp;
+      if (end   == 0) end   = sorted_entries.back().RcvTimestamp;
+
+      const auto lower = std::lower_bound(sorted_entries.begin(), sorted_entries.end(), SEntryInfo(begin, 0, 0));
+      const auto upper = std::upper_bound(lower,                  sorted_entries.end(), SEntryInfo(end,   0, 0));
+
+      if (lower < upper)
+        entries.assign(lower, upper);
+    }
+  }  // namespace eh5
+}  // namespace eCAL
@@ -0,0 +1,62 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  Helper functions for flat (sorted vector) entry info containers
+**/
+
+#pragma once
+
+#include <vector>
+
+#include <ecalhdf5/eh5_types.h>
+
+namespace eCAL
+{
+  namespace eh5
+  {
+    /**
+    * @brief Sorts the given entries by receive timestamp, if they are not sorted already.
+    *        The relative order of entries with equal timestamps is preserved.
+    *
+    * @param [in,out] entries  entries to sort
+    **/
+    void SortEntryInfoVect(EntryInfoVect& entries);
+
+    /**
+    * @brief Merges multiple individually sorted entry vectors into one sorted vector (k-way merge).
+    *        Entries with equal receive timestamps keep the order of their source vectors.
+    *
+    * @param [in]  runs     sorted input vectors
+    * @param [out] merged   merged output vector
+    **/
+    void MergeEntryInfoVects(const std::vector<EntryInfoVect>& runs, EntryInfoVect& merged);
+
+    /**
+    * @brief Copies all entries of a sorted vector within the time range [begin, end].
+    *        A begin / end of 0 selects the first / last entry.
+    *
+    * @param [in]  sorted_entries  sorted input entries
+    * @param [in]  begin           time range begin timestamp
+    * @param [in]  end             time range end timestamp
+    * @param [out] entries         entries in the given range
+    **/
+    void CopyEntryInfoRange(const EntryInfoVect& sorted_entries, long long begin, long long end, EntryInfoVect& entries);
+  }  // namespace eh5
+}  // namespace eCAL
@@ -0,0 +1,93 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  Read-only memory mapping of a measurement file
+**/
+
+#include "file_mapping.h"
+
+#ifdef WIN32
+#define NOMINMAX
+#include <windows.h>
+#include <ecal_utils/str_convert.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif // WIN32
+
+std::shared_ptr<const eCAL::eh5::FileMapping> eCAL::eh5::FileMapping::Create(const std::string& path)
+{
+  std::shared_ptr<FileMapping> mapping(new FileMapping());
+
+#ifdef WIN32
+  const std::wstring w_path = EcalUtils::StrConvert::Utf8ToWide(path);
+  HANDLE file_handle = ::CreateFileW(w_path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (file_handle == INVALID_HANDLE_VALUE) return nullptr;
+  mapping->file_handle_ = file_handle;
+
+  LARGE_INTEGER file_size;
+  if (!::GetFileSizeEx(file_handle, &file_size) || (file_size.QuadPart <= 0)) return nullptr;
+
+  HANDLE mapping_handle = ::CreateFileMappingW(file_handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  if (mapping_handle == nullptr) return nullptr;
+  mapping->mapping_handle_ = mapping_handle;
+
+  const void* data = ::MapViewOfFile(mapping_handle, FILE_MAP_READ, 0, 0, 0);
+  if (data == nullptr) return nullptr;
+
+  mapping->data_ = static_cast<const char*>(data);
+  mapping->size_ = static_cast<size_t>(file_size.QuadPart);
+#else
+  const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) return nullptr;
+
+  struct stat file_stat {};
+  if ((::fstat(fd, &file_stat) != 0) || (file_stat.st_size <= 0))
+  {
+    ::close(fd);
+    return nullptr;
+  }
+
+  void* data = ::mmap(nullptr, static_cast<size_t>(file_stat.st_size), PROT_READ, MAP_SHARED, fd, 0);
+
+  // The mapping stays valid after closing the file descriptor
+  ::close(fd);
+
+  if (data == MAP_FAILED) return nullptr;
+
+  mapping->data_ = static_cast<const char*>(data);
+  mapping->size_ = static_cast<size_t>(file_stat.st_size);
+#endif // WIN32
+
+  return mapping;
+}
+
+eCAL::eh5::FileMapping::~FileMapping()
+{
+#ifdef WIN32
+  if (data_ != nullptr)           ::UnmapViewOfFile(data_);
+  if (mapping_handle_ != nullptr) ::CloseHandle(static_cast<HANDLE>(mapping_handle_));
+  if (file_handle_ != nullptr)    ::CloseHandle(static_cast<HANDLE>(file_handle_));
+#else
+  if (data_ != nullptr)           ::munmap(const_cast<char*>(data_), size_);
+#endif // WIN32
+}
@@ -0,0 +1,74 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  Read-only memory mapping of a measurement file
+**/
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+namespace eCAL
+{
+  namespace eh5
+  {
+    /**
+    * @brief Maps a complete file read-only into memory
+    *
+    * The mapping is released when the object is destroyed. It is shared by
+    * all entry views handed out for the file, so it is only created through
+    * Create().
+    **/
+    class FileMapping
+    {
+    public:
+      /**
+      * @brief Maps the given file
+      *
+      * @param path  File path (UTF-8)
+      *
+      * @return      The mapping, or nullptr if the file could not be mapped
+      **/
+      static std::shared_ptr<const FileMapping> Create(const std::string& path);
+
+      ~FileMapping();
+
+      FileMapping(const FileMapping&)            = delete;
+      FileMapping& operator=(const FileMapping&) = delete;
+      FileMapping(FileMapping&&)                 = delete;
+      FileMapping& operator=(FileMapping&&)      = delete;
+
+      const char* Data() const { return data_; }
+      size_t      Size() const { return size_; }
+
+    private:
+      FileMapping() = default;
+
+      const char* data_ = nullptr;
+      size_t      size_ = 0;
+#ifdef WIN32
+      void*       file_handle_    = nullptr;
+      void*       mapping_handle_ = nullptr;
+#endif // WIN32
+    };
+  }  // namespace eh5
+}  // namespace eCAL
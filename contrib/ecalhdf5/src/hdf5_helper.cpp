@@ -226,6 +226,152 @@ bool GetEntryInfoVector(hid_t root, const std::string& url, eCAL::eh5::EntryInfo
   return (status >= 0);
 }
 
+bool GetEntryInfoVector(hid_t root, const std::string& url, eCAL::eh5::EntryInfoVect& entries)
+{
+  entries.clear();
+
+  auto dataset_id = H5Dopen(root, url.c_str(), H5P_DEFAULT);
+
+  if (dataset_id < 0) return false;
+
+  const size_t sizeof_ll = sizeof(long long);
+  hsize_t data_size = H5Dget_storage_size(dataset_id) / sizeof_ll;
+
+  if (data_size <= 0)
+  {
+    H5Dclose(dataset_id);
+    return false;
+  }
+
+  std::vector<long long> data(data_size);
+  herr_t status = H5Dread(dataset_id, H5T_NATIVE_LLONG, H5S_ALL, H5S_ALL, H5P_DEFAULT, &data[0]);
+  H5Dclose(dataset_id);
+
+  entries.reserve(static_cast<size_t>(data_size / 5));
+  for (size_t index = 0; index + 4 < data_size; index += 5)
+  {
+    //                        rec timestamp,  channel id,       send clock,       send time stamp,  send ID
+    entries.emplace_back(data[index], data[index + 1], data[index + 2], data[index + 3], data[index + 4]);
+  }
+
+  return (status >= 0);
+}
+
+bool CreatePayloadEntryInRoot(hid_t root, const std::string& url, const void* data, size_t size)
+{
+  hsize_t hs_size = static_cast<hsize_t>(size);
+
+  //  Create DataSpace with rank 1 and size dimension
+  auto data_space = H5Screate_simple(1, &hs_size, nullptr);
+
+  //  Create creation property for data_space
+  auto ds_property = H5Pcreate(H5P_DATASET_CREATE);
+  H5Pset_obj_track_times(ds_property, false);
+
+  //  Create dataset in data_space
+  auto data_set = H5Dcreate(root, url.c_str(), H5T_NATIVE_UCHAR, data_space, H5P_DEFAULT, ds_property, H5P_DEFAULT);
+
+  //  Write buffer to dataset
+  herr_t write_status = H5Dwrite(data_set, H5T_NATIVE_UCHAR, H5S_ALL, H5S_ALL, H5P_DEFAULT, data);
+
+  //  Close dataset, data space, and data set property
+  H5Dclose(data_set);
+  H5Pclose(ds_property);
+  H5Sclose(data_space);
+
+  return (write_status >= 0);
+}
+
+bool CreateDeflatedPayloadEntryInRoot(hid_t root, const std::string& url, size_t raw_size, const void* compressed_data, size_t compressed_size, int level)
+{
+  hsize_t hs_size = static_cast<hsize_t>(raw_size);
+
+  //  Create DataSpace with rank 1 and size dimension
+  auto data_space = H5Screate_simple(1, &hs_size, nullptr);
+
+  //  The whole payload is stored as one deflate compressed chunk
+  auto ds_property = H5Pcreate(H5P_DATASET_CREATE);
+  H5Pset_obj_track_times(ds_property, false);
+  H5Pset_chunk(ds_property, 1, &hs_size);
+  H5Pset_deflate(ds_property, static_cast<unsigned int>(level));
+
+  auto data_set = H5Dcreate(root, url.c_str(), H5T_NATIVE_UCHAR, data_space, H5P_DEFAULT, ds_property, H5P_DEFAULT);
+
+  //  Write the already compressed chunk, bypassing the filter pipeline (filter mask 0 = all filters applied)
+  herr_t write_status = -1;
+  if (data_set >= 0)
+  {
+    const hsize_t offset = 0;
+    write_status = H5Dwrite_chunk(data_set, H5P_DEFAULT, 0, &offset, compressed_size, compressed_data);
+    H5Dclose(data_set);
+  }
+
+  H5Pclose(ds_property);
+  H5Sclose(data_space);
+
+  return (write_status >= 0);
+}
+
+bool IsDeflateFilterAvailable()
+{
+  static const bool deflate_available = []() {
+    if (H5Zfilter_avail(H5Z_FILTER_DEFLATE) <= 0) return false;
+
+    unsigned int filter_config = 0;
+    if (H5Zget_filter_info(H5Z_FILTER_DEFLATE, &filter_config) < 0) return false;
+
+    return ((filter_config & H5Z_FILTER_CONFIG_ENCODE_ENABLED) != 0)
+        && ((filter_config & H5Z_FILTER_CONFIG_DECODE_ENABLED) != 0);
+  }();
+
+  return deflate_available;
+}
+
+bool GetPayloadSize(hid_t dataset_id, size_t& size)
+{
+  // The storage size of a compressed dataset differs from the payload size,
+  // so the size is taken from the dataspace instead.
+  const hid_t dataspace_id = H5Dget_space(dataset_id);
+  if (dataspace_id < 0) return false;
+
+  const hssize_t num_points = H5Sget_simple_extent_npoints(dataspace_id);
+  H5Sclose(dataspace_id);
+
+  if (num_points < 0) return false;
+
+  size = static_cast<size_t>(num_points);
+  return true;
+}
+
+bool GetContiguousPayloadOffset(hid_t dataset_id, size_t& offset)
+{
+  // Only payloads that are stored as plain bytes in one contiguous block can
+  // be read directly from the file. Chunked (e.g. compressed) and compact
+  // datasets have to be read through the HDF5 library.
+  const hid_t plist_id = H5Dget_create_plist(dataset_id);
+  if (plist_id < 0) return false;
+
+  const bool is_plain_contiguous = (H5Pget_layout(plist_id) == H5D_CONTIGUOUS) && (H5Pget_nfilters(plist_id) == 0);
+  H5Pclose(plist_id);
+
+  if (!is_plain_contiguous) return false;
+
+  const hid_t type_id = H5Dget_type(dataset_id);
+  if (type_id < 0) return false;
+
+  const bool is_byte_type = (H5Tget_size(type_id) == 1);
+  H5Tclose(type_id);
+
+  if (!is_byte_type) return false;
+
+  // The address is undefined if no storage has been allocated (e.g. for empty payloads)
+  const haddr_t address = H5Dget_offset(dataset_id);
+  if (address == HADDR_UNDEF) return false;
+
+  offset = static_cast<size_t>(address);
+  return true;
+}
+
 bool SetAttribute(hid_t id, const std::string& name, const std::string& value)
 {
   if (id < 0) return false;
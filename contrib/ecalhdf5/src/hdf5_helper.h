@@ -36,8 +36,15 @@ bool ReadBinaryEntryAsString(hid_t root, const std::string& url, std::string& da
 bool CreateNullEntryInRoot(hid_t root, const std::string& url);
 bool IsNullEntryInRoot(hid_t root, const std::string& url);
 
+bool CreatePayloadEntryInRoot(hid_t root, const std::string& url, const void* data, size_t size);
+bool CreateDeflatedPayloadEntryInRoot(hid_t root, const std::string& url, size_t raw_size, const void* compressed_data, size_t compressed_size, int level);
+bool IsDeflateFilterAvailable();
+bool GetPayloadSize(hid_t dataset_id, size_t& size);
+bool GetContiguousPayloadOffset(hid_t dataset_id, size_t& offset);
+
 bool CreateInformationEntryInRoot(hid_t root, const std::string& url, const eCAL::eh5::EntryInfoVect& entries);
 bool GetEntryInfoVector(hid_t root, const std::string& url, eCAL::eh5::EntryInfoSet& entries);
+bool GetEntryInfoVector(hid_t root, const std::string& url, eCAL::eh5::EntryInfoVect& entries);
 
 /**
 * @brief Set attribute to object(file, entry...)
@@ -0,0 +1,317 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  Writer for (optionally compressed) payload datasets
+**/
+
+#include "payload_writer.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <limits>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#ifdef ECAL_EH5_HAS_ZLIB
+#include <zlib.h>
+#endif // ECAL_EH5_HAS_ZLIB
+
+#include "hdf5_helper.h"
+
+namespace
+{
+  // Uncompressed payload bytes of one writer that may wait for compression before the writer blocks
+  constexpr size_t kMaxPendingBytes = 256 * 1024 * 1024;
+
+  // The whole payload is stored in a single chunk, which HDF5 limits to 4 GiB
+  constexpr size_t kMaxChunkSize = std::numeric_limits<uint32_t>::max();
+
+  unsigned int GetWorkerCount()
+  {
+    const unsigned int hardware_threads = std::thread::hardware_concurrency();
+    return std::max(1u, std::min(4u, hardware_threads / 2));
+  }
+}
+
+namespace eCAL
+{
+  namespace eh5
+  {
+    struct CompressionJob
+    {
+      unsigned long long         entry_id = 0;
+      int                        level    = 0;
+      std::vector<unsigned char> raw;
+      std::vector<unsigned char> compressed;
+      bool                       compressed_ok = false;
+      bool                       done          = false;   //!< Protected by the mutex of the compression pool
+    };
+
+    /**
+    * @brief Worker threads that compress the payloads of all payload writers
+    *
+    * With one file per channel, every channel has its own writer. Sharing
+    * the workers keeps the number of threads independent of the number of
+    * channels. The pool exists as long as any writer uses it.
+    **/
+    class CompressionPool
+    {
+    public:
+      static std::shared_ptr<CompressionPool> Get()
+      {
+        static std::mutex                     instance_mutex;
+        static std::weak_ptr<CompressionPool> instance;
+
+        const std::lock_guard<std::mutex> lock(instance_mutex);
+        std::shared_ptr<CompressionPool> pool = instance.lock();
+        if (!pool)
+        {
+          pool     = std::make_shared<CompressionPool>();
+          instance = pool;
+        }
+        return pool;
+      }
+
+      CompressionPool()
+        : shutdown_(false)
+      {
+        const unsigned int worker_count = GetWorkerCount();
+        for (unsigned int i = 0; i < worker_count; ++i)
+        {
+          workers_.emplace_back([this]() { WorkerLoop(); });
+        }
+      }
+
+      ~CompressionPool()
+      {
+        {
+          const std::lock_guard<std::mutex> lock(mutex_);
+          shutdown_ = true;
+        }
+        job_cv_.notify_all();
+
+        for (auto& worker : workers_)
+          worker.join();
+      }
+
+      CompressionPool(const CompressionPool&)            = delete;
+      CompressionPool& operator=(const CompressionPool&) = delete;
+      CompressionPool(CompressionPool&&)                 = delete;
+      CompressionPool& operator=(CompressionPool&&)      = delete;
+
+      void Submit(const std::shared_ptr<CompressionJob>& job)
+      {
+        {
+          const std::lock_guard<std::mutex> lock(mutex_);
+          open_jobs_.push_back(job);
+        }
+        job_cv_.notify_one();
+      }
+
+      bool IsDone(const CompressionJob& job)
+      {
+        const std::lock_guard<std::mutex> lock(mutex_);
+        return job.done;
+      }
+
+      void WaitUntilDone(const CompressionJob& job)
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        done_cv_.wait(lock, [&job]() { return job.done; });
+      }
+
+    private:
+      void WorkerLoop()
+      {
+        for (;;)
+        {
+          std::shared_ptr<CompressionJob> job;
+          {
+            std::unique_lock<std::mutex> lock(mutex_);
+            job_cv_.wait(lock, [this]() { return shutdown_ || !open_jobs_.empty(); });
+            if (open_jobs_.empty())
+              return;
+
+            job = open_jobs_.front();
+            open_jobs_.pop_front();
+          }
+
+          Compress(*job);
+
+          {
+            const std::lock_guard<std::mutex> lock(mutex_);
+            job->done = true;
+          }
+          // Multiple writers may be waiting for different jobs
+          done_cv_.notify_all();
+        }
+      }
+
+      static void Compress(CompressionJob& job)
+      {
+#ifdef ECAL_EH5_HAS_ZLIB
+        // The HDF5 deflate filter stores plain zlib streams, so the chunk can be
+        // written directly and is decompressed transparently by the reader.
+        uLongf compressed_size = compressBound(static_cast<uLong>(job.raw.size()));
+        job.compressed.resize(compressed_size);
+
+        const int status = compress2(job.compressed.data(), &compressed_size, job.raw.data(), static_cast<uLong>(job.raw.size()), job.level);
+
+        // Incompressible payloads are stored as they are
+        job.compressed_ok = (status == Z_OK) && (compressed_size < job.raw.size());
+        job.compressed.resize(job.compressed_ok ? compressed_size : 0);
+#else
+        job.compressed_ok = false;
+#endif // ECAL_EH5_HAS_ZLIB
+      }
+
+      std::mutex                                   mutex_;
+      std::condition_variable                      job_cv_;     //!< Notifies the workers about new jobs
+      std::condition_variable                      done_cv_;    //!< Notifies the writers about finished jobs
+      std::deque<std::shared_ptr<CompressionJob>>  open_jobs_;  //!< Jobs that have not been picked up by a worker
+      bool                                         shutdown_;
+      std::vector<std::thread>                     workers_;
+    };
+
+    PayloadWriter::PayloadWriter()
+      : pending_bytes_(0)
+    {}
+
+    PayloadWriter::~PayloadWriter() = default;
+
+    bool PayloadWriter::IsCompressionAvailable(eCompressionType type)
+    {
+      switch (type)
+      {
+      case eCompressionType::NONE:
+        return true;
+      case eCompressionType::DEFLATE:
+#ifdef ECAL_EH5_HAS_ZLIB
+        return IsDeflateFilterAvailable();
+#else
+        return false;
+#endif // ECAL_EH5_HAS_ZLIB
+      default:
+        return false;
+      }
+    }
+
+    void PayloadWriter::SetCompression(const SCompressionSettings& settings)
+    {
+      default_compression_ = settings;
+    }
+
+    void PayloadWriter::SetChannelCompression(const std::string& channel_name, const SCompressionSettings& settings)
+    {
+      channel_compression_[channel_name] = settings;
+    }
+
+    const SCompressionSettings& PayloadWriter::GetCompression(const std::string& channel_name) const
+    {
+      if (!channel_compression_.empty())
+      {
+        const auto channel_it = channel_compression_.find(channel_name);
+        if (channel_it != channel_compression_.end())
+          return channel_it->second;
+      }
+      return default_compression_;
+    }
+
+    bool PayloadWriter::Write(hid_t file_id, unsigned long long entry_id, const std::string& channel_name, const void* data, size_t size)
+    {
+      const auto& compression = GetCompression(channel_name);
+
+      const bool compress = (compression.type != eCompressionType::NONE)
+                          && (size >= compression.min_payload_size)
+                          && (size > 0)
+                          && (size <= kMaxChunkSize)
+                          && IsCompressionAvailable(compression.type);
+
+      if (!compress)
+      {
+        // Still write finished jobs, so compressed payloads don't pile up
+        const bool jobs_ok = pending_jobs_.empty() || WriteJobs(file_id, kMaxPendingBytes);
+        return CreatePayloadEntryInRoot(file_id, std::to_string(entry_id), data, size) && jobs_ok;
+      }
+
+      // Write finished jobs and block while too much data is waiting for compression
+      const bool jobs_ok = WriteJobs(file_id, kMaxPendingBytes - std::min(size, kMaxPendingBytes));
+
+      auto job = std::make_shared<CompressionJob>();
+      job->entry_id = entry_id;
+      job->level    = std::max(1, std::min(9, compression.level));
+      job->raw.assign(static_cast<const unsigned char*>(data), static_cast<const unsigned char*>(data) + size);
+
+      if (!compression_pool_)
+        compression_pool_ = CompressionPool::Get();
+
+      pending_jobs_.push_back(job);
+      pending_bytes_ += size;
+      compression_pool_->Submit(job);
+
+      return jobs_ok;
+    }
+
+    bool PayloadWriter::Flush(hid_t file_id)
+    {
+      return WriteJobs(file_id, 0);
+    }
+
+    size_t PayloadWriter::GetPendingBytes() const
+    {
+      return pending_bytes_;
+    }
+
+    bool PayloadWriter::WriteJobs(hid_t file_id, size_t max_pending_bytes)
+    {
+      bool ret_val = true;
+
+      while (!pending_jobs_.empty())
+      {
+        const std::shared_ptr<CompressionJob> job = pending_jobs_.front();
+
+        // Jobs are written in order. Only wait for the oldest job if we are above the limit.
+        if (!compression_pool_->IsDone(*job))
+        {
+          if (pending_bytes_ <= max_pending_bytes)
+            break;
+          compression_pool_->WaitUntilDone(*job);
+        }
+
+        pending_jobs_.pop_front();
+        pending_bytes_ -= job->raw.size();
+
+        ret_val &= WriteJob(file_id, *job);
+      }
+
+      return ret_val;
+    }
+
+    bool PayloadWriter::WriteJob(hid_t file_id, const CompressionJob& job)
+    {
+      const std::string dataset_name = std::to_string(job.entry_id);
+      if (job.compressed_ok)
+        return CreateDeflatedPayloadEntryInRoot(file_id, dataset_name, job.raw.size(), job.compressed.data(), job.compressed.size(), job.level);
+      else
+        return CreatePayloadEntryInRoot(file_id, dataset_name, job.raw.data(), job.raw.size());
+    }
+  }  // namespace eh5
+}  // namespace eCAL
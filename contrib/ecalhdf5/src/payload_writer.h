@@ -0,0 +1,135 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  Writer for (optionally compressed) payload datasets
+**/
+
+#pragma once
+
+#include <deque>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include <hdf5.h>
+
+#include <ecalhdf5/eh5_types.h>
+
+namespace eCAL
+{
+  namespace eh5
+  {
+    struct CompressionJob;
+    class  CompressionPool;
+
+    /**
+    * @brief Writes the payload datasets of the measurement file writers
+    *
+    * Uncompressed payloads are written directly. Payloads of channels with
+    * enabled compression are copied and compressed by a pool of worker
+    * threads that is shared by all payload writers of the process. The
+    * compressed chunks are written by the thread calling Write() or Flush(),
+    * so the HDF5 file is only accessed by the writer thread.
+    **/
+    class PayloadWriter
+    {
+    public:
+      PayloadWriter();
+      ~PayloadWriter();
+
+      PayloadWriter(const PayloadWriter&)            = delete;
+      PayloadWriter& operator=(const PayloadWriter&) = delete;
+      PayloadWriter(PayloadWriter&&)                 = delete;
+      PayloadWriter& operator=(PayloadWriter&&)      = delete;
+
+      /**
+      * @brief Returns whether payloads can be compressed with the given algorithm
+      *
+      * @param type  compression algorithm
+      *
+      * @return true, if eCAL was built with zlib and HDF5 provides the deflate filter
+      **/
+      static bool IsCompressionAvailable(eCompressionType type);
+
+      /**
+      * @brief Sets the compression for all channels without individual settings
+      *
+      * @param settings  compression settings
+      **/
+      void SetCompression(const SCompressionSettings& settings);
+
+      /**
+      * @brief Sets the compression for a single channel
+      *
+      * @param channel_name  (escaped) channel name
+      * @param settings      compression settings
+      **/
+      void SetChannelCompression(const std::string& channel_name, const SCompressionSettings& settings);
+
+      /**
+      * @brief Writes the payload of an entry to a dataset that is named by the entry id.
+      *
+      * If the channel is compressed, the payload is copied and handed to
+      * the worker pool. It is written by a later call to Write() or Flush().
+      *
+      * @param file_id       HDF5 file to write to
+      * @param entry_id      entry id (= dataset name)
+      * @param channel_name  (escaped) channel name
+      * @param data          payload
+      * @param size          payload size
+      *
+      * @return false, if writing this payload or a previously compressed payload failed
+      **/
+      bool Write(hid_t file_id, unsigned long long entry_id, const std::string& channel_name, const void* data, size_t size);
+
+      /**
+      * @brief Waits for all payloads that are being compressed and writes them to the file.
+      *        Must be called before the file is closed.
+      *
+      * @param file_id  HDF5 file to write to
+      *
+      * @return false, if writing any payload failed
+      **/
+      bool Flush(hid_t file_id);
+
+      /**
+      * @brief Returns the uncompressed size of all payloads that have been
+      *        passed to Write(), but have not been written to the file, yet.
+      *
+      * The compressed size is never larger, so this is an upper bound for
+      * the amount of data the file will still grow by.
+      **/
+      size_t GetPendingBytes() const;
+
+    private:
+      const SCompressionSettings& GetCompression(const std::string& channel_name) const;
+
+      bool WriteJobs(hid_t file_id, size_t max_pending_bytes);
+      static bool WriteJob(hid_t file_id, const CompressionJob& job);
+
+      SCompressionSettings                                  default_compression_;
+      std::unordered_map<std::string, SCompressionSettings> channel_compression_;
+
+      std::shared_ptr<CompressionPool>             compression_pool_;   //!< Shared worker threads, acquired with the first compressed payload
+      std::deque<std::shared_ptr<CompressionJob>>  pending_jobs_;       //!< All jobs that have not been written, in order of submission
+      size_t                                       pending_bytes_;      //!< Uncompressed size of all pending jobs
+    };
+  }  // namespace eh5
+}  // namespace eCAL
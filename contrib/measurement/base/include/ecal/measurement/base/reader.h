@@ -190,6 +190,46 @@ namespace eCAL
           **/
           virtual bool GetEntriesInfoRange(const eCAL::experimental::measurement::base::Channel& channel, long long begin, long long end, EntryInfoSet& entries) const = 0;
 
+          /**
+           * @brief Gets the header info for all data entries for the given channel as flat vector,
+           *        sorted by receive timestamp
+           *
+           *        Compared to the EntryInfoSet overload, this avoids the per node
+           *        overhead of the set and allows range queries via binary search.
+           *        The default implementation converts the result of the set overload.
+           *
+           * @param [in]  channel       (channel name & id)
+           * @param [out] entries       header info for all data entries
+           *
+           * @return                    true if succeeds, false if it fails
+          **/
+          virtual bool GetEntriesInfo(const eCAL::experimental::measurement::base::Channel& channel, EntryInfoVect& entries) const
+          {
+            EntryInfoSet entry_set;
+            const bool ret_val = GetEntriesInfo(channel, entry_set);
+            entries.assign(entry_set.begin(), entry_set.end());
+            return ret_val;
+          }
+
+          /**
+           * @brief Gets the header info for data entries for the given channel included in given time range (begin->end)
+           *        as flat vector, sorted by receive timestamp
+           *
+           * @param [in]  channel      (channel name & id)
+           * @param [in]  begin        time range begin timestamp
+           * @param [in]  end          time range end timestamp
+           * @param [out] entries      header info for data entries in given range
+           *
+           * @return                   true if succeeds, false if it fails
+          **/
+          virtual bool GetEntriesInfoRange(const eCAL::experimental::measurement::base::Channel& channel, long long begin, long long end, EntryInfoVect& entries) const
+          {
+            EntryInfoSet entry_set;
+            const bool ret_val = GetEntriesInfoRange(channel, begin, end, entry_set);
+            entries.assign(entry_set.begin(), entry_set.end());
+            return ret_val;
+          }
+
           /**
            * @brief Gets data size of a specific entry
            *
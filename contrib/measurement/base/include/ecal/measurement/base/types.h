@@ -158,6 +158,10 @@ namespace eCAL
 
         /**
          * @brief eCAL HDF5 entries (as vector container)
+         *
+         * When returned by GetEntriesInfo / GetEntriesInfoRange, the entries
+         * are sorted by receive timestamp, so std::lower_bound / std::upper_bound
+         * can be used for range queries.
         **/
         using EntryInfoVect = std::vector<EntryInfo>;
 
@@ -196,6 +196,30 @@ namespace eCAL
           **/
           bool GetEntriesInfoRange(const eCAL::experimental::measurement::base::Channel& channel, long long begin, long long end, measurement::base::EntryInfoSet& entries) const override;
 
+          /**
+           * @brief Gets the header info for all data entries for the given channel as flat vector,
+           *        sorted by receive timestamp
+           *
+           * @param [in]  channel_name  channel name
+           * @param [out] entries       header info for all data entries
+           *
+           * @return                    true if succeeds, false if it fails
+          **/
+          bool GetEntriesInfo(const eCAL::experimental::measurement::base::Channel& channel, measurement::base::EntryInfoVect& entries) const override;
+
+          /**
+           * @brief Gets the header info for data entries for the given channel included in given time range (begin->end)
+           *        as flat vector, sorted by receive timestamp
+           *
+           * @param [in]  channel_name channel name
+           * @param [in]  begin        time range begin timestamp
+           * @param [in]  end          time range end timestamp
+           * @param [out] entries      header info for data entries in given range
+           *
+           * @return                   true if succeeds, false if it fails
+          **/
+          bool GetEntriesInfoRange(const eCAL::experimental::measurement::base::Channel& channel, long long begin, long long end, measurement::base::EntryInfoVect& entries) const override;
+
           /**
            * @brief Gets data size of a specific entry
            *
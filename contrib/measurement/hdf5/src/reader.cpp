@@ -108,6 +108,16 @@ bool Reader::GetEntriesInfoRange(const base::Channel& channel, long long begin,
   return impl->measurement.GetEntriesInfoRange(channel, begin, end, entries);
 }
 
+bool Reader::GetEntriesInfo(const base::Channel& channel, base::EntryInfoVect& entries) const
+{
+  return impl->measurement.GetEntriesInfo(channel, entries);
+}
+
+bool Reader::GetEntriesInfoRange(const base::Channel& channel, long long begin, long long end, base::EntryInfoVect& entries) const
+{
+  return impl->measurement.GetEntriesInfoRange(channel, begin, end, entries);
+}
+
 bool Reader::GetEntryDataSize(long long entry_id, size_t& size) const
 {
   return impl->measurement.GetEntryDataSize(entry_id, size);
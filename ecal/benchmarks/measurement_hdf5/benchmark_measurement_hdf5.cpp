@@ -0,0 +1,98 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include <ecalhdf5/eh5_meas.h>
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+
+constexpr int entries_per_iteration = 64;
+
+constexpr int range_multiplier = 1 << 4;
+constexpr int range_start = 1 << 10;
+constexpr int range_limit = 1 << 22;
+
+const std::string meas_dir = "benchmark_measurement_hdf5";
+
+
+// Byte generator with a small alphabet, so the payload is (partially) compressible like typical sensor data
+char gen() {
+  static std::random_device rd;
+  static std::mt19937 engine(rd());
+  static std::uniform_int_distribution<> distr(0,15);
+  return static_cast<char>(distr(engine));
+}
+
+
+/*
+ *
+ * Benchmarking the HDF5 write throughput with different payload compression levels
+ * (level 0 = uncompressed)
+ *
+*/
+namespace Write {
+  // Benchmark function
+  void BM_HDF5_Write(benchmark::State& state) {
+    // Create payload to write, size depends on current argument
+    const size_t payload_size = state.range(0);
+    std::vector<char> content_vector(payload_size);
+    std::generate(content_vector.begin(), content_vector.end(), gen);
+
+    eCAL::eh5::SCompressionSettings compression;
+    if (state.range(1) > 0)
+    {
+      compression.type  = eCAL::eh5::eCompressionType::DEFLATE;
+      compression.level = static_cast<int>(state.range(1));
+    }
+
+    eCAL::eh5::SWriteEntry entry;
+    entry.channel = { "benchmark_topic", 0 };
+    entry.data    = content_vector.data();
+    entry.size    = payload_size;
+
+    // This is the benchmarked section: Writing the payloads and flushing them to the file
+    for (auto _ : state) {
+      state.PauseTiming();
+      eCAL::eh5::v3::HDF5Meas writer(meas_dir, eCAL::eh5::v3::eAccessType::CREATE);
+      writer.SetFileBaseName("benchmark_" + std::to_string(payload_size) + "_" + std::to_string(state.range(1)));
+      writer.SetCompression(compression);
+      state.ResumeTiming();
+
+      for (int i = 0; i < entries_per_iteration; ++i)
+      {
+        entry.snd_timestamp = i;
+        entry.rcv_timestamp = i;
+        writer.AddEntryToFile(entry);
+      }
+      writer.Close();
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * entries_per_iteration * static_cast<int64_t>(payload_size));
+  }
+  // Register the benchmark function
+  BENCHMARK(BM_HDF5_Write)->ArgsProduct({ benchmark::CreateRange(range_start, range_limit, range_multiplier), { 0, 1, 6 } })->UseRealTime();
+}
+
+
+// Benchmark execution
+BENCHMARK_MAIN();
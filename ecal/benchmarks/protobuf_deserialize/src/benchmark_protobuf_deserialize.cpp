@@ -0,0 +1,123 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include <ecal/msg/protobuf/serializer.h>
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+#ifdef _MSC_VER
+#pragma warning(push, 0) // disable proto warnings
+#endif
+#include <samples.pb.h>
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+constexpr int element_count = 1000;
+
+struct SDataTypeInformation
+{
+  std::string name;
+  std::string encoding;
+  std::string descriptor;
+};
+
+// Serialized list of element_count elements
+const std::string& serialized_element_list()
+{
+  static const std::string serialized = []() {
+    pb::Benchmark::ElementList element_list;
+    for (int i = 0; i < element_count; ++i)
+    {
+      auto* element = element_list.add_elements();
+      element->set_id(static_cast<uint64_t>(i));
+      element->set_value(i * 0.5);
+      element->set_name("element_" + std::to_string(i));
+      for (int j = 0; j < 8; ++j) element->add_data(static_cast<float>(i + j));
+    }
+    return element_list.SerializeAsString();
+  }();
+  return serialized;
+}
+
+
+/*
+ *
+ * Benchmarking the deserialization of a typed protobuf subscriber
+ * 
+*/
+namespace NewMessage {
+  // A new message for every sample (CSubscriber)
+  void BM_Protobuf_Deserialize_NewMessage(benchmark::State& state) {
+    const std::string& buffer = serialized_element_list();
+    const SDataTypeInformation datatype_info;
+
+    for (auto _ : state) {
+      auto msg = eCAL::protobuf::internal::Serializer<pb::Benchmark::ElementList, SDataTypeInformation>::Deserialize(buffer.data(), buffer.size(), datatype_info);
+      benchmark::DoNotOptimize(msg);
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(buffer.size()));
+  }
+  BENCHMARK(BM_Protobuf_Deserialize_NewMessage);
+}
+
+namespace ReuseMessage {
+  // One message, cleared and reparsed for every sample (CReusingSubscriber, reuse_message)
+  void BM_Protobuf_Deserialize_ReuseMessage(benchmark::State& state) {
+    const std::string& buffer = serialized_element_list();
+    const SDataTypeInformation datatype_info;
+
+    eCAL::protobuf::internal::ReusingDeserializer<pb::Benchmark::ElementList, SDataTypeInformation> deserializer;
+    deserializer.SetArenaInitialBlockSize(0);
+
+    for (auto _ : state) {
+      const auto& msg = deserializer.Deserialize(buffer.data(), buffer.size(), datatype_info);
+      benchmark::DoNotOptimize(&msg);
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(buffer.size()));
+  }
+  BENCHMARK(BM_Protobuf_Deserialize_ReuseMessage);
+}
+
+namespace Arena {
+  // Messages on an arena, that is reset for every sample (CReusingSubscriber, arena)
+  void BM_Protobuf_Deserialize_Arena(benchmark::State& state) {
+    const std::string& buffer = serialized_element_list();
+    const SDataTypeInformation datatype_info;
+
+    eCAL::protobuf::internal::ReusingDeserializer<pb::Benchmark::ElementList, SDataTypeInformation> deserializer;
+    deserializer.SetArenaInitialBlockSize(static_cast<size_t>(state.range(0)));
+
+    for (auto _ : state) {
+      const auto& msg = deserializer.Deserialize(buffer.data(), buffer.size(), datatype_info);
+      benchmark::DoNotOptimize(&msg);
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(buffer.size()));
+  }
+  // initial arena block size, the last one holds the complete message
+  BENCHMARK(BM_Protobuf_Deserialize_Arena)->Arg(4 * 1024)->Arg(64 * 1024)->Arg(256 * 1024);
+}
+
+
+// Benchmark execution
+BENCHMARK_MAIN();
@@ -83,6 +83,53 @@ namespace Send {
 }
 
 
+/*
+ *
+ * Benchmarking the eCAL send process over TCP
+ * 
+*/
+namespace Send_TCP {
+  // Benchmark function
+  void BM_eCAL_Send_TCP(benchmark::State& state) {
+    // Create payload to send, size depends on current argument
+    const size_t payload_size = state.range(0);
+    std::vector<char> content_vector(payload_size);
+    std::generate(content_vector.begin(), content_vector.end(), gen);
+    const char* content_addr = content_vector.data();
+
+    // Initialize eCAL and create sender, using the TCP layer only
+    eCAL::Initialize("Benchmark");
+    eCAL::Publisher::Configuration pub_config;
+    pub_config.layer.shm.enable = false;
+    pub_config.layer.udp.enable = false;
+    pub_config.layer.tcp.enable = true;
+    eCAL::CPublisher publisher("benchmark_topic", {}, pub_config);
+
+    // Create receiver in a different thread, TCP is disabled for subscribers by default
+    std::thread receiver_thread([]() { 
+      eCAL::Subscriber::Configuration sub_config;
+      sub_config.layer.tcp.enable = true;
+      eCAL::CSubscriber subscriber("benchmark_topic", {}, sub_config);
+      while(eCAL::Ok()) { std::this_thread::sleep_for(std::chrono::milliseconds(10)); }
+    } );
+    
+    // Wait for eCAL synchronization
+    std::this_thread::sleep_for(std::chrono::milliseconds(registration_delay_ms));
+
+    // This is the benchmarked section: Sending the payload
+    for (auto _ : state) {
+      publisher.Send(content_addr, payload_size);
+    }
+
+    // Finalize eCAL and wait for receiver thread to finish
+    eCAL::Finalize();
+    receiver_thread.join();
+  }
+  // Register the benchmark function
+  BENCHMARK(BM_eCAL_Send_TCP)->RangeMultiplier(range_multiplier)->Range(range_start, range_limit)->UseRealTime();
+}
+
+
 /*
  *
  * Benchmarking the eCAL send and receive process
@@ -20,6 +20,7 @@
 #include <ecal/ecal.h>
 #include <benchmark/benchmark.h>
 
+#include <memory>
 #include <random>
 #include <thread>
 
@@ -375,5 +376,114 @@ namespace Send_Zero_Copy_Double_Buffer_Handshake {
 }
 
 
+/*
+ *
+ * Benchmarking the first send of a large payload into a freshly created memory file
+ * with different memory file mapping options
+ * (0 = default, 1 = prefault, 2 = huge pages, 3 = huge pages + prefault)
+ *
+*/
+constexpr int large_payload_size = 1 << 24;
+constexpr int first_send_iterations = 10;
+
+namespace Send_First_Large_Payload {
+  // Benchmark function
+  void BM_eCAL_Send_First_Large_Payload(benchmark::State& state) {
+    // Create payload to send
+    const size_t payload_size = large_payload_size;
+    std::vector<char> content_vector(payload_size);
+    std::generate(content_vector.begin(), content_vector.end(), gen);
+    const char* content_addr = content_vector.data();
+
+    // Initialize eCAL
+    eCAL::Initialize("Benchmark");
+
+    // Create publisher config, the memory file is created with the payload size already
+    eCAL::Publisher::Configuration pub_config;
+    pub_config.layer.shm.memfile_min_size_bytes = static_cast<unsigned int>(payload_size + 4096);
+    pub_config.layer.shm.memfile_prefault       = (state.range(0) & 1) != 0;
+    pub_config.layer.shm.memfile_huge_pages     = (state.range(0) & 2) != 0;
+
+    // Create receiver in a different thread
+    std::thread receiver_thread([]() { 
+      eCAL::CSubscriber subscriber("benchmark_topic");
+      while(eCAL::Ok()) { std::this_thread::sleep_for(std::chrono::milliseconds(10)); }
+    } );
+
+    // This is the benchmarked section: Sending the payload with a new publisher
+    for (auto _ : state) {
+      state.PauseTiming();
+      auto publisher = std::make_unique<eCAL::CPublisher>("benchmark_topic", eCAL::SDataTypeInformation(), pub_config);
+      std::this_thread::sleep_for(std::chrono::milliseconds(registration_delay_ms));
+      state.ResumeTiming();
+
+      publisher->Send(content_addr, payload_size);
+
+      state.PauseTiming();
+      publisher.reset();
+      state.ResumeTiming();
+    }
+
+    // Finalize eCAL and wait for receiver thread to finish
+    eCAL::Finalize();
+    receiver_thread.join();
+  }
+  // Register the benchmark function
+  BENCHMARK(BM_eCAL_Send_First_Large_Payload)->DenseRange(0, 3)->Iterations(first_send_iterations)->UseRealTime();
+}
+
+
+/*
+ *
+ * Benchmarking the steady-state send throughput of a large payload
+ * with different memory file mapping options
+ * (0 = default, 1 = prefault, 2 = huge pages, 3 = huge pages + prefault)
+ *
+*/
+namespace Send_Large_Payload {
+  // Benchmark function
+  void BM_eCAL_Send_Large_Payload(benchmark::State& state) {
+    // Create payload to send
+    const size_t payload_size = large_payload_size;
+    std::vector<char> content_vector(payload_size);
+    std::generate(content_vector.begin(), content_vector.end(), gen);
+    const char* content_addr = content_vector.data();
+
+    // Initialize eCAL
+    eCAL::Initialize("Benchmark");
+
+    // Create publisher config
+    eCAL::Publisher::Configuration pub_config;
+    pub_config.layer.shm.memfile_min_size_bytes = static_cast<unsigned int>(payload_size + 4096);
+    pub_config.layer.shm.memfile_prefault       = (state.range(0) & 1) != 0;
+    pub_config.layer.shm.memfile_huge_pages     = (state.range(0) & 2) != 0;
+
+    // Create publisher with config
+    eCAL::CPublisher publisher("benchmark_topic", eCAL::SDataTypeInformation(), pub_config);
+
+    // Create receiver in a different thread
+    std::thread receiver_thread([]() { 
+      eCAL::CSubscriber subscriber("benchmark_topic");
+      while(eCAL::Ok()) { std::this_thread::sleep_for(std::chrono::milliseconds(10)); }
+    } );
+    
+    // Wait for eCAL synchronization
+    std::this_thread::sleep_for(std::chrono::milliseconds(registration_delay_ms));
+
+    // This is the benchmarked section: Sending the payload
+    for (auto _ : state) {
+      publisher.Send(content_addr, payload_size);
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(payload_size));
+
+    // Finalize eCAL and wait for receiver thread to finish
+    eCAL::Finalize();
+    receiver_thread.join();
+  }
+  // Register the benchmark function
+  BENCHMARK(BM_eCAL_Send_Large_Payload)->DenseRange(0, 3)->UseRealTime();
+}
+
+
 // Benchmark execution
 BENCHMARK_MAIN();
\ No newline at end of file
@@ -20,7 +20,10 @@
 #include <ecal/ecal.h>
 #include <benchmark/benchmark.h>
 
+#include <fstream>
 #include <random>
+#include <sstream>
+#include <string>
 #include <thread>
 
 
@@ -35,6 +38,8 @@ constexpr int per_topic_range_start = 1;
 constexpr int per_topic_range_limit = 1 << 24;
 constexpr int per_topic_range_multiplier = 1 << 12;
 
+constexpr int small_message_size = 50;
+
 
 // Random byte generator
 char gen() {
@@ -145,5 +150,90 @@ namespace Multi_Send {
     ->MinWarmUpTime(warmup_time_s);
 }
 
+/*
+ *
+ * Benchmarking small messages of multiple topics over UDP with and without sample coalescing
+ * 
+*/
+namespace Multi_Send_UDP_Coalescing {
+  // Number of UDP datagrams sent by this host so far, -1 if unknown (only available on Linux)
+  long long GetUdpOutDatagrams() {
+    std::ifstream snmp("/proc/net/snmp");
+    std::string header_line, value_line;
+    while (std::getline(snmp, header_line)) {
+      if (header_line.rfind("Udp:", 0) != 0) continue;
+      if (!std::getline(snmp, value_line)) break;
+      std::istringstream header_stream(header_line), value_stream(value_line);
+      std::string name, value;
+      while ((header_stream >> name) && (value_stream >> value)) {
+        if (name == "OutDatagrams") return std::stoll(value);
+      }
+      break;
+    }
+    return -1;
+  }
+
+  // Benchmark function
+  void BM_eCAL_Multi_Send_UDP(benchmark::State& state) {
+    // Create payload to send
+    std::vector<char> content_vector(small_message_size);
+    std::generate(content_vector.begin(), content_vector.end(), gen);
+    const char* content_addr = content_vector.data();
+
+    // Initialize eCAL
+    eCAL::Initialize("Benchmark");
+
+    // Send via UDP only, coalescing depends on second argument
+    eCAL::Publisher::Configuration pub_config;
+    pub_config.layer.shm.enable = false;
+    pub_config.layer.udp.enable = true;
+    pub_config.layer.tcp.enable = false;
+    pub_config.layer.udp.coalescing_enable = (state.range(1) != 0);
+
+    // Create publishers and subscribers, count depends on first argument
+    const int topic_count = state.range(0);
+    std::vector<eCAL::CPublisher>  publisher_vector;
+    std::vector<eCAL::CSubscriber> subscriber_vector;
+    for (int i=0; i<topic_count; i++) {
+      publisher_vector.emplace_back(eCAL::CPublisher("small_topic_" + std::to_string(i), {}, pub_config));
+      subscriber_vector.emplace_back(eCAL::CSubscriber("small_topic_" + std::to_string(i)));
+    }
+
+    // Wait for eCAL synchronization
+    std::this_thread::sleep_for(std::chrono::milliseconds(registration_delay_ms));
+
+    // The packet count includes the datagrams of other processes on this host
+    const long long out_datagrams_start = GetUdpOutDatagrams();
+
+    // This is the benchmarked section: Sending one message on every topic
+    for (auto _ : state) {
+      for (auto& publisher : publisher_vector) {
+        publisher.Send(content_addr, small_message_size);
+      }
+    }
+
+    const long long out_datagrams_end = GetUdpOutDatagrams();
+
+    state.counters["messages"] = benchmark::Counter(static_cast<double>(state.iterations() * topic_count), benchmark::Counter::kIsRate);
+    if ((out_datagrams_start >= 0) && (out_datagrams_end >= 0)) {
+      state.counters["packets"] = benchmark::Counter(static_cast<double>(out_datagrams_end - out_datagrams_start), benchmark::Counter::kIsRate);
+    }
+
+    // Finalize eCAL
+    publisher_vector.clear();
+    subscriber_vector.clear();
+    eCAL::Finalize();
+  }
+
+  // Register benchmark
+  BENCHMARK(BM_eCAL_Multi_Send_UDP)
+    ->ArgsProduct({
+      benchmark::CreateRange(background_topic_count_min, background_topic_count_max, background_topic_count_multiplier),
+      {0, 1}})
+    ->ArgNames({"topics", "coalescing"})
+    ->UseRealTime()
+    ->MinWarmUpTime(warmup_time_s);
+}
+
 // Benchmark execution
 BENCHMARK_MAIN();
\ No newline at end of file
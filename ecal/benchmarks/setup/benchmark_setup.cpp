@@ -140,5 +140,34 @@ namespace Registration_Delay {
 }
 
 
+/*
+ *
+ * Benchmarking the eCAL registration delay with fast discovery
+ * 
+*/
+namespace Registration_Delay_Fast_Discovery {
+   void BM_eCAL_Registration_Delay_Fast_Discovery(benchmark::State& state) {
+      // Initialize eCAL with publishers and subscribers answering new matches immediately
+      eCAL::Configuration config;
+      config.registration.fast_discovery = true;
+      eCAL::Initialize(config, "Benchmark");
+
+      // This is the benchmarked section: Creating publisher and subscriber (untimed) and waiting until the publisher is subscribed
+      for (auto _ : state) {
+         state.PauseTiming();
+         eCAL::CPublisher publisher("benchmark_topic");
+         eCAL::CSubscriber subscriber("benchmark_topic");
+         state.ResumeTiming();
+
+         while (publisher.GetSubscriberCount() == 0) { std::this_thread::yield(); }
+      }
+
+      // Finalize eCAL
+      eCAL::Finalize();
+   }
+   BENCHMARK(BM_eCAL_Registration_Delay_Fast_Discovery)->MinTime(minimum_time_s);
+}
+
+
 // Benchmark execution
 BENCHMARK_MAIN();
\ No newline at end of file
@@ -0,0 +1,529 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/*
+ *
+ * Multi-process transport benchmark
+ *
+ * The orchestrator spawns separate publisher and subscriber processes (this
+ * executable in the "pub" and "sub" role) for every combination of layer,
+ * payload size, send rate and subscriber count. Each role process writes its
+ * measurement to a small result file, the orchestrator collects them and
+ * writes all runs as JSON. Use benchmarks/util/throughput_calculator.py to
+ * compare the JSON files of two runs.
+ *
+ * Usage:
+ *   ecal_benchmark_transport [--layers shm,shm_zero_copy,shm_multibuffer,udp,tcp]
+ *                            [--payload-sizes 64,1024,65536,1048576] [--rates 0,1000]
+ *                            [--subscribers 1,4] [--duration 3] [--output ecal_benchmark_transport.json]
+ *
+ * A rate of 0 sends as fast as possible.
+ * 
+*/
+
+#include <ecal/ecal.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <sys/resource.h>
+#endif
+
+
+constexpr int registration_timeout_s = 10;
+constexpr int warmup_time_ms         = 500;
+constexpr int drain_time_ms          = 200;
+
+const std::vector<std::string> default_layers        = { "shm", "shm_zero_copy", "shm_multibuffer", "udp", "tcp" };
+const std::vector<long long>   default_payload_sizes = { 64, 1024, 65536, 1048576 };
+const std::vector<long long>   default_rates         = { 0, 1000 };
+const std::vector<long long>   default_subscribers   = { 1, 4 };
+constexpr int                  default_duration_s    = 3;
+
+
+/*
+ *
+ * Helpers shared by all roles
+ * 
+*/
+namespace Util {
+  // Header at the start of every payload. The send time is taken from the
+  // steady clock, which is system wide on all supported platforms, so the
+  // subscriber processes can compute the latency directly.
+  struct SampleHeader {
+    int64_t  send_time_ns;
+    uint32_t warmup;
+    uint32_t reserved;
+  };
+
+  int64_t NowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+  }
+
+  // CPU time (user + system) used by this process in seconds
+  double GetProcessCpuSeconds() {
+#ifdef _WIN32
+    FILETIME creation_time, exit_time, kernel_time, user_time;
+    if (!GetProcessTimes(GetCurrentProcess(), &creation_time, &exit_time, &kernel_time, &user_time)) return 0.0;
+    auto to_seconds = [](const FILETIME& ft) { return static_cast<double>((static_cast<uint64_t>(ft.dwHighDateTime) << 32) | ft.dwLowDateTime) * 1e-7; };
+    return to_seconds(kernel_time) + to_seconds(user_time);
+#else
+    struct rusage usage {};
+    if (getrusage(RUSAGE_SELF, &usage) != 0) return 0.0;
+    return static_cast<double>(usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) + static_cast<double>(usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) * 1e-6;
+#endif
+  }
+
+  // Measures the CPU usage of this process in percent of one core
+  class CpuUsage {
+  public:
+    void Start() {
+      cpu_start  = GetProcessCpuSeconds();
+      wall_start = std::chrono::steady_clock::now();
+    }
+    double Stop() const {
+      const double wall_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - wall_start).count();
+      return (wall_s > 0.0) ? (GetProcessCpuSeconds() - cpu_start) / wall_s * 100.0 : 0.0;
+    }
+  private:
+    double                                cpu_start = 0.0;
+    std::chrono::steady_clock::time_point wall_start;
+  };
+
+  // Applies the layer under test, all other layers are disabled
+  bool SetupLayer(const std::string& layer, eCAL::Publisher::Configuration& pub_config, eCAL::Subscriber::Configuration& sub_config) {
+    pub_config.layer.shm.enable = false;
+    pub_config.layer.udp.enable = false;
+    pub_config.layer.tcp.enable = false;
+    sub_config.layer.shm.enable = false;
+    sub_config.layer.udp.enable = false;
+    sub_config.layer.tcp.enable = false;
+
+    if (layer == "shm" || layer == "shm_zero_copy" || layer == "shm_multibuffer") {
+      pub_config.layer.shm.enable = true;
+      sub_config.layer.shm.enable = true;
+      pub_config.layer.shm.zero_copy_mode = (layer == "shm_zero_copy");
+      if (layer == "shm_multibuffer") pub_config.layer.shm.memfile_buffer_count = 3;
+    }
+    else if (layer == "udp") {
+      pub_config.layer.udp.enable = true;
+      sub_config.layer.udp.enable = true;
+    }
+    else if (layer == "tcp") {
+      pub_config.layer.tcp.enable = true;
+      sub_config.layer.tcp.enable = true;
+    }
+    else {
+      return false;
+    }
+    return true;
+  }
+
+  // The role processes report their measurement as "key value" lines
+  void WriteResultFile(const std::string& path, const std::map<std::string, double>& values) {
+    std::ofstream file(path, std::ios::trunc);
+    file << std::setprecision(17);
+    for (const auto& value : values) file << value.first << " " << value.second << "\n";
+  }
+
+  std::map<std::string, double> ReadResultFile(const std::string& path) {
+    std::map<std::string, double> values;
+    std::ifstream file(path);
+    std::string key;
+    double value = 0.0;
+    while (file >> key >> value) values[key] = value;
+    return values;
+  }
+
+  double Percentile(const std::vector<int64_t>& sorted_values, double percentile) {
+    if (sorted_values.empty()) return 0.0;
+    const auto rank = static_cast<size_t>(std::ceil(percentile / 100.0 * static_cast<double>(sorted_values.size())));
+    return static_cast<double>(sorted_values[std::min(std::max<size_t>(rank, 1), sorted_values.size()) - 1]);
+  }
+
+  template <typename T>
+  std::vector<T> ParseList(const std::string& list, T (*convert)(const std::string&)) {
+    std::vector<T> values;
+    std::stringstream stream(list);
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+      if (!item.empty()) values.push_back(convert(item));
+    }
+    return values;
+  }
+
+  long long ToNumber(const std::string& s) { return std::stoll(s); }
+  std::string ToString(const std::string& s) { return s; }
+}
+
+
+/*
+ *
+ * Publisher role: sends for the given duration, after a warm-up phase
+ * 
+*/
+namespace Publisher {
+  int Run(const std::string& topic, const std::string& layer, size_t payload_size, long long rate_hz, size_t subscriber_count, int duration_s, const std::string& result_file) {
+    eCAL::Publisher::Configuration  pub_config = eCAL::GetPublisherConfiguration();
+    eCAL::Subscriber::Configuration sub_config = eCAL::GetSubscriberConfiguration();
+    if (!Util::SetupLayer(layer, pub_config, sub_config)) return EXIT_FAILURE;
+
+    eCAL::Initialize("ecal_benchmark_transport_pub");
+
+    std::map<std::string, double> result;
+    {
+      eCAL::CPublisher publisher(topic, {}, pub_config);
+
+      // Wait until all subscribers are connected
+      const auto registration_deadline = std::chrono::steady_clock::now() + std::chrono::seconds(registration_timeout_s);
+      while ((publisher.GetSubscriberCount() < subscriber_count) && (std::chrono::steady_clock::now() < registration_deadline)) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+      }
+      result["connected_subscribers"] = static_cast<double>(publisher.GetSubscriberCount());
+
+      std::vector<char> payload(std::max(payload_size, sizeof(Util::SampleHeader)));
+      Util::SampleHeader header {};
+
+      const std::chrono::nanoseconds period(rate_hz > 0 ? 1000000000LL / rate_hz : 0);
+      auto send = [&](auto phase_end, bool warmup) {
+        long long sent = 0;
+        auto next_send = std::chrono::steady_clock::now();
+        while (std::chrono::steady_clock::now() < phase_end) {
+          header.warmup       = warmup ? 1 : 0;
+          header.send_time_ns = Util::NowNs();
+          std::memcpy(payload.data(), &header, sizeof(header));
+          publisher.Send(payload.data(), payload.size());
+          ++sent;
+
+          if (period.count() > 0) {
+            next_send += period;
+            std::this_thread::sleep_until(next_send);
+          }
+        }
+        return sent;
+      };
+
+      // The first samples also establish the data connections, so they are not measured
+      send(std::chrono::steady_clock::now() + std::chrono::milliseconds(warmup_time_ms), true);
+
+      Util::CpuUsage cpu_usage;
+      cpu_usage.Start();
+      const auto send_start = std::chrono::steady_clock::now();
+      const long long sent  = send(send_start + std::chrono::seconds(duration_s), false);
+      const double send_s   = std::chrono::duration<double>(std::chrono::steady_clock::now() - send_start).count();
+
+      result["sent"]        = static_cast<double>(sent);
+      result["send_rate"]   = (send_s > 0.0) ? static_cast<double>(sent) / send_s : 0.0;
+      result["cpu_percent"] = cpu_usage.Stop();
+    }
+
+    eCAL::Finalize();
+
+    Util::WriteResultFile(result_file, result);
+    return EXIT_SUCCESS;
+  }
+}
+
+
+/*
+ *
+ * Subscriber role: receives until the publisher is gone and reports latency and throughput
+ * 
+*/
+namespace Subscriber {
+  int Run(const std::string& topic, const std::string& layer, int timeout_s, const std::string& result_file) {
+    eCAL::Publisher::Configuration  pub_config = eCAL::GetPublisherConfiguration();
+    eCAL::Subscriber::Configuration sub_config = eCAL::GetSubscriberConfiguration();
+    if (!Util::SetupLayer(layer, pub_config, sub_config)) return EXIT_FAILURE;
+
+    eCAL::Initialize("ecal_benchmark_transport_sub");
+
+    // Only written by the receive callback, read after the subscriber has been destroyed
+    std::vector<int64_t> latencies_ns;
+    latencies_ns.reserve(1 << 20);
+    long long received       = 0;
+    long long received_bytes = 0;
+    int64_t   first_receive_ns = 0;
+    int64_t   last_receive_ns  = 0;
+
+    Util::CpuUsage cpu_usage;
+    std::atomic<bool> measuring(false);
+
+    auto subscriber = std::make_unique<eCAL::CSubscriber>(topic, eCAL::SDataTypeInformation(), sub_config);
+    subscriber->SetReceiveCallback([&](const eCAL::STopicId&, const eCAL::SDataTypeInformation&, const eCAL::SReceiveCallbackData& data_) {
+      const int64_t receive_ns = Util::NowNs();
+      if (data_.buffer_size < sizeof(Util::SampleHeader)) return;
+
+      Util::SampleHeader header {};
+      std::memcpy(&header, data_.buffer, sizeof(header));
+      if (header.warmup != 0) return;
+
+      if (!measuring) {
+        cpu_usage.Start();
+        first_receive_ns = receive_ns;
+        measuring = true;
+      }
+      latencies_ns.push_back(receive_ns - header.send_time_ns);
+      received_bytes += static_cast<long long>(data_.buffer_size);
+      last_receive_ns = receive_ns;
+      ++received;
+    });
+
+    // Receive until the publisher has been connected and is gone again
+    bool connected = false;
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(timeout_s);
+    while (std::chrono::steady_clock::now() < deadline) {
+      const bool publisher_connected = (subscriber->GetPublisherCount() > 0);
+      if (connected && !publisher_connected) break;
+      connected = connected || publisher_connected;
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(drain_time_ms));
+
+    const double cpu_percent = measuring ? cpu_usage.Stop() : 0.0;
+    subscriber.reset();
+    eCAL::Finalize();
+
+    std::sort(latencies_ns.begin(), latencies_ns.end());
+    const double receive_s = static_cast<double>(last_receive_ns - first_receive_ns) * 1e-9;
+
+    std::map<std::string, double> result;
+    result["received"]          = static_cast<double>(received);
+    result["latency_p50_us"]    = Util::Percentile(latencies_ns, 50.0) / 1000.0;
+    result["latency_p99_us"]    = Util::Percentile(latencies_ns, 99.0) / 1000.0;
+    result["latency_p99_9_us"]  = Util::Percentile(latencies_ns, 99.9) / 1000.0;
+    result["latency_max_us"]    = latencies_ns.empty() ? 0.0 : static_cast<double>(latencies_ns.back()) / 1000.0;
+    result["msgs_per_s"]        = (receive_s > 0.0) ? static_cast<double>(received - 1) / receive_s : 0.0;
+    result["bytes_per_s"]       = (receive_s > 0.0) ? result["msgs_per_s"] * static_cast<double>(received_bytes) / static_cast<double>(received) : 0.0;
+    result["cpu_percent"]       = cpu_percent;
+
+    Util::WriteResultFile(result_file, result);
+    return EXIT_SUCCESS;
+  }
+}
+
+
+/*
+ *
+ * Orchestrator: sweeps all combinations and collects the results as JSON
+ * 
+*/
+namespace Orchestrator {
+  struct Options {
+    std::vector<std::string> layers        = default_layers;
+    std::vector<long long>   payload_sizes = default_payload_sizes;
+    std::vector<long long>   rates         = default_rates;
+    std::vector<long long>   subscribers   = default_subscribers;
+    int                      duration_s    = default_duration_s;
+    std::string              output        = "ecal_benchmark_transport.json";
+  };
+
+  std::string Quote(const std::string& s) { return "\"" + s + "\""; }
+
+  int Execute(std::string command) {
+#ifdef _WIN32
+    // cmd.exe strips the outer quotes of the command line
+    command = Quote(command);
+#endif
+    return std::system(command.c_str());
+  }
+
+  // Runs one combination, returns its JSON object
+  std::string RunOnce(const std::string& self, const Options& options, const std::string& layer, long long payload_size, long long rate_hz, long long subscriber_count, int run_index) {
+    const std::string name       = "transport/" + layer + "/" + std::to_string(payload_size) + "/" + std::to_string(rate_hz) + "/" + std::to_string(subscriber_count);
+    const std::string topic      = "ecal_benchmark_transport_" + std::to_string(std::time(nullptr)) + "_" + std::to_string(run_index);
+    const std::string run_prefix = options.output + ".run" + std::to_string(run_index);
+    const int sub_timeout_s      = registration_timeout_s + options.duration_s + 5;
+
+    std::cout << "Running " << name << std::endl;
+
+    // Start the subscribers first, the publisher waits until all of them are connected
+    std::vector<std::thread> subscriber_threads;
+    std::vector<std::string> subscriber_files;
+    for (long long i = 0; i < subscriber_count; ++i) {
+      subscriber_files.push_back(run_prefix + ".sub" + std::to_string(i));
+      const std::string command = Quote(self) + " sub " + topic + " " + layer + " " + std::to_string(sub_timeout_s) + " " + Quote(subscriber_files.back());
+      subscriber_threads.emplace_back([command]() { Execute(command); });
+    }
+
+    const std::string publisher_file = run_prefix + ".pub";
+    Execute(Quote(self) + " pub " + topic + " " + layer + " " + std::to_string(payload_size) + " " + std::to_string(rate_hz) + " "
+            + std::to_string(subscriber_count) + " " + std::to_string(options.duration_s) + " " + Quote(publisher_file));
+
+    for (auto& t : subscriber_threads) t.join();
+
+    // Collect the results
+    const auto publisher_result = Util::ReadResultFile(publisher_file);
+    std::remove(publisher_file.c_str());
+    std::vector<std::map<std::string, double>> subscriber_results;
+    for (const auto& file : subscriber_files) {
+      subscriber_results.push_back(Util::ReadResultFile(file));
+      std::remove(file.c_str());
+    }
+
+    auto value = [](const std::map<std::string, double>& result, const std::string& key) {
+      auto it = result.find(key);
+      return (it != result.end()) ? it->second : 0.0;
+    };
+
+    // The summary reports the worst latency and the mean throughput over all subscribers
+    const double sent = value(publisher_result, "sent");
+    double received = 0.0, p50 = 0.0, p99 = 0.0, p99_9 = 0.0, latency_max = 0.0, msgs_per_s = 0.0, bytes_per_s = 0.0, sub_cpu = 0.0;
+    std::ostringstream subscribers_json;
+    subscribers_json << std::fixed << std::setprecision(3);
+    for (size_t i = 0; i < subscriber_results.size(); ++i) {
+      const auto& result = subscriber_results[i];
+      received    += value(result, "received");
+      p50          = std::max(p50,         value(result, "latency_p50_us"));
+      p99          = std::max(p99,         value(result, "latency_p99_us"));
+      p99_9        = std::max(p99_9,       value(result, "latency_p99_9_us"));
+      latency_max  = std::max(latency_max, value(result, "latency_max_us"));
+      msgs_per_s  += value(result, "msgs_per_s")  / static_cast<double>(subscriber_results.size());
+      bytes_per_s += value(result, "bytes_per_s") / static_cast<double>(subscriber_results.size());
+      sub_cpu     += value(result, "cpu_percent") / static_cast<double>(subscriber_results.size());
+
+      subscribers_json << (i > 0 ? ", " : "")
+        << "{ \"received\": " << value(result, "received")
+        << ", \"latency_p50_us\": "   << value(result, "latency_p50_us")
+        << ", \"latency_p99_us\": "   << value(result, "latency_p99_us")
+        << ", \"latency_p99_9_us\": " << value(result, "latency_p99_9_us")
+        << ", \"msgs_per_s\": "       << value(result, "msgs_per_s")
+        << ", \"cpu_percent\": "      << value(result, "cpu_percent") << " }";
+    }
+    const double expected = sent * static_cast<double>(subscriber_count);
+    const bool   complete = !publisher_result.empty() && (value(publisher_result, "connected_subscribers") >= static_cast<double>(subscriber_count));
+
+    std::ostringstream json;
+    json << std::fixed << std::setprecision(3);
+    json << "    {\n"
+         << "      \"name\": \"" << name << "\",\n"
+         << "      \"layer\": \"" << layer << "\",\n"
+         << "      \"payload_size\": " << payload_size << ",\n"
+         << "      \"rate_hz\": " << rate_hz << ",\n"
+         << "      \"subscriber_count\": " << subscriber_count << ",\n"
+         << "      \"complete\": " << (complete ? "true" : "false") << ",\n"
+         << "      \"sent\": " << sent << ",\n"
+         << "      \"send_rate\": " << value(publisher_result, "send_rate") << ",\n"
+         << "      \"received\": " << received << ",\n"
+         << "      \"lost\": " << std::max(0.0, expected - received) << ",\n"
+         << "      \"latency_us\": { \"p50\": " << p50 << ", \"p99\": " << p99 << ", \"p99_9\": " << p99_9 << ", \"max\": " << latency_max << " },\n"
+         << "      \"throughput\": { \"msgs_per_s\": " << msgs_per_s << ", \"bytes_per_s\": " << bytes_per_s << " },\n"
+         << "      \"cpu_percent\": { \"publisher\": " << value(publisher_result, "cpu_percent") << ", \"subscribers\": " << sub_cpu << " },\n"
+         << "      \"subscribers\": [ " << subscribers_json.str() << " ]\n"
+         << "    }";
+    return json.str();
+  }
+
+  int Run(const std::string& self, const Options& options) {
+    std::vector<std::string> runs;
+    int run_index = 0;
+    for (const auto& layer : options.layers)
+      for (const auto payload_size : options.payload_sizes)
+        for (const auto rate_hz : options.rates)
+          for (const auto subscriber_count : options.subscribers)
+            runs.push_back(RunOnce(self, options, layer, payload_size, rate_hz, subscriber_count, run_index++));
+
+    char date[32] = {};
+    const std::time_t now = std::time(nullptr);
+    std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", std::localtime(&now));
+
+    std::ofstream file(options.output, std::ios::trunc);
+    if (!file) {
+      std::cerr << "ERROR: Unable to write " << options.output << std::endl;
+      return EXIT_FAILURE;
+    }
+    file << "{\n"
+         << "  \"context\": {\n"
+         << "    \"date\": \"" << date << "\",\n"
+         << "    \"ecal_version\": \"" << eCAL::GetVersionString() << "\",\n"
+         << "    \"host_name\": \"" << eCAL::Process::GetHostName() << "\",\n"
+         << "    \"duration_s\": " << options.duration_s << "\n"
+         << "  },\n"
+         << "  \"benchmarks\": [\n";
+    for (size_t i = 0; i < runs.size(); ++i) file << runs[i] << (i + 1 < runs.size() ? ",\n" : "\n");
+    file << "  ]\n}\n";
+
+    std::cout << "Results written to " << options.output << std::endl;
+    return EXIT_SUCCESS;
+  }
+}
+
+
+int main(int argc, char** argv) {
+  const std::vector<std::string> args(argv, argv + argc);
+
+  try {
+    // Role processes spawned by the orchestrator
+    if ((args.size() == 9) && (args[1] == "pub")) {
+      return Publisher::Run(args[2], args[3], std::stoul(args[4]), std::stoll(args[5]), std::stoul(args[6]), std::stoi(args[7]), args[8]);
+    }
+    if ((args.size() == 6) && (args[1] == "sub")) {
+      return Subscriber::Run(args[2], args[3], std::stoi(args[4]), args[5]);
+    }
+
+    Orchestrator::Options options;
+    for (size_t i = 1; i + 1 < args.size(); i += 2) {
+      if      (args[i] == "--layers")        options.layers        = Util::ParseList<std::string>(args[i + 1], &Util::ToString);
+      else if (args[i] == "--payload-sizes") options.payload_sizes = Util::ParseList<long long>(args[i + 1], &Util::ToNumber);
+      else if (args[i] == "--rates")         options.rates         = Util::ParseList<long long>(args[i + 1], &Util::ToNumber);
+      else if (args[i] == "--subscribers")   options.subscribers   = Util::ParseList<long long>(args[i + 1], &Util::ToNumber);
+      else if (args[i] == "--duration")      options.duration_s    = std::stoi(args[i + 1]);
+      else if (args[i] == "--output")        options.output        = args[i + 1];
+      else {
+        std::cerr << "ERROR: Unknown option " << args[i] << std::endl;
+        return EXIT_FAILURE;
+      }
+    }
+
+    for (const auto& layer : options.layers) {
+      eCAL::Publisher::Configuration  pub_config;
+      eCAL::Subscriber::Configuration sub_config;
+      if (!Util::SetupLayer(layer, pub_config, sub_config)) {
+        std::cerr << "ERROR: Unknown layer " << layer << std::endl;
+        return EXIT_FAILURE;
+      }
+    }
+
+    return Orchestrator::Run(args[0], options);
+  }
+  catch (const std::exception& e) {
+    std::cerr << "ERROR: " << e.what() << std::endl;
+    return EXIT_FAILURE;
+  }
+}
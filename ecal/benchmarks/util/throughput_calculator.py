@@ -22,75 +22,168 @@ import json
 import re
 
 
+# Whether a higher value of a metric is better, used for comparing runs
+HIGHER_IS_BETTER = {
+   "throughput"       : True,
+   "speed"            : True,
+   "latency_p50"      : False,
+   "latency_p99"      : False,
+   "latency_p99_9"    : False,
+   "cpu_usage"        : False,
+}
+
+
+def load_benchmarks(file_path):
+   # Check if file exists
+   if not os.path.isfile(file_path):
+      print(f"ERROR: File not found at path: {file_path}")
+      exit(1)
+
+   # Decode JSON file
+   try:
+      with open(file_path, 'r') as f:
+         data = json.load(f)
+   except json.JSONDecodeError as e:
+      print(f"ERROR: Failed to parse JSON file: {e}")
+      exit(1)
+
+   # Check if benchmark data exists
+   if "benchmarks" not in data or not isinstance(data["benchmarks"], list):
+      print("ERROR: 'benchmarks' key missing or not a list in the JSON file.")
+      exit(1)
+
+   return data["benchmarks"]
+
+
+def calculate_google_benchmark(itm):
+   # Get payload size (in byte) from benchmark name
+   payload_size = int(re.search(r'/(\d+)/[a-z]', itm["name"]).group(1))
+   # Get background thread count from benchmark name (if applicable)
+   thread_count = 1
+   multi = re.search(r'[a-z]/(\d+)/[0-9]', itm["name"])
+   if multi:
+      # Adding 1 to account for the main thread
+      thread_count += int(multi.group(1))
+   # Get time taken. Expecting time in nanoseconds
+   real_time_ns = float(itm["real_time"])
+   # Calculating send frequency in hertz (corresponds to throughput in ops/s)
+   frequency = 1 / (real_time_ns * 10**-9) * thread_count
+   # Calculating speed in bytes per second
+   speed = frequency * payload_size * thread_count
+   # Output to console
+   print(f"Payload Size: {payload_size} Bytes  ||  Real Time: {real_time_ns} ns  ||  Frequency: {frequency} ops/s  ||  Datarate: {speed} Bytes/s  ||  Thread count: {thread_count}")
+   # Create new dictionary for this datapoint
+   return {
+      "throughput" : {
+         "value" : frequency
+      },
+      "speed" : {
+         "value" : speed
+      }
+   }
+
+
+def calculate_transport_benchmark(itm):
+   # The transport benchmark suite already measured everything, only convert it to the same format
+   frequency = float(itm["throughput"]["msgs_per_s"])
+   speed     = float(itm["throughput"]["bytes_per_s"])
+   latency   = itm["latency_us"]
+   cpu_usage = float(itm["cpu_percent"]["publisher"]) + float(itm["cpu_percent"]["subscribers"]) * int(itm["subscriber_count"])
+   print(f"{itm['name']}  ||  Frequency: {frequency} ops/s  ||  Datarate: {speed} Bytes/s  ||  Latency p50/p99/p99.9: {latency['p50']}/{latency['p99']}/{latency['p99_9']} us  ||  Lost: {itm['lost']}  ||  CPU: {cpu_usage} %")
+   return {
+      "throughput"    : { "value" : frequency },
+      "speed"         : { "value" : speed },
+      "latency_p50"   : { "value" : float(latency["p50"]) },
+      "latency_p99"   : { "value" : float(latency["p99"]) },
+      "latency_p99_9" : { "value" : float(latency["p99_9"]) },
+      "cpu_usage"     : { "value" : cpu_usage },
+   }
+
+
+def calculate(benchmarks):
+   # Create list for the results
+   full_results = {}
+
+   for itm in benchmarks:
+      try:
+         if "latency_us" in itm:
+            datapoint = calculate_transport_benchmark(itm)
+         else:
+            datapoint = calculate_google_benchmark(itm)
+         # Add dictionary to full results dictionary
+         full_results.update({itm["name"] : datapoint})
+      except (KeyError, ValueError, AttributeError, TypeError) as e:
+         print(f"WARNING: Skipping invalid benchmark entry: {itm}. Reason: {e}")
+
+   return full_results
+
+
+def compare(results, baseline_results, threshold_percent):
+   # Compare every metric that exists in both runs, returns the comparison and the number of regressions
+   comparison = {}
+   regressions = 0
+
+   for name, datapoint in results.items():
+      if name not in baseline_results:
+         continue
+      for metric, measure in datapoint.items():
+         if metric not in baseline_results[name]:
+            continue
+         value    = measure["value"]
+         baseline = baseline_results[name][metric]["value"]
+         if baseline == 0:
+            continue
+
+         change_percent = (value - baseline) / abs(baseline) * 100
+         higher_is_better = HIGHER_IS_BETTER.get(metric, True)
+         regression = (-change_percent if higher_is_better else change_percent) > threshold_percent
+         if regression:
+            regressions += 1
+            print(f"REGRESSION: {name} {metric}: {baseline} -> {value} ({change_percent:+.1f} %)")
+
+         comparison.setdefault(name, {})[metric] = {
+            "value"          : value,
+            "baseline"       : baseline,
+            "change_percent" : change_percent,
+            "regression"     : regression
+         }
+
+   return comparison, regressions
+
+
+def write_json(file_out, content):
+   try:
+      with open(file_out, "w") as f:
+         json.dump(content, f, indent=4)
+   except IOError as e:
+      print(f"ERROR: Failed to write output file: {e}")
+      exit(1)
+
+   print(f"Results written to {os.path.abspath(file_out)}")
+
+
 # Read log file path from argument
 ap = argparse.ArgumentParser()
 ap.add_argument('-f', '--file', required=True, help="Path to the the log file. Can be relative to this python file.")
+ap.add_argument('-c', '--compare', help="Path to the log file of a baseline run. Metrics that got worse by more than the threshold are reported as regression.")
+ap.add_argument('-t', '--threshold', type=float, default=10.0, help="Allowed change of a metric in percent before it is reported as regression (default: 10).")
 args = ap.parse_args()
 file_in_path = args.file
 
-# Check if file exists
-if not os.path.isfile(file_in_path):
-   print(f"ERROR: File not found at path: {file_in_path}")
-   exit(1)
-
-# Decode JSON file
-try:
-   with open(file_in_path, 'r') as f:
-      data = json.load(f)
-except json.JSONDecodeError as e:
-   print(f"ERROR: Failed to parse JSON file: {e}")
-   exit(1)
-
-# Check if benchmark data exists
-if "benchmarks" not in data or not isinstance(data["benchmarks"], list):
-   print("ERROR: 'benchmarks' key missing or not a list in the JSON file.")
-   exit(1)
-
-# Extract benchmark data
-benchmarks = data["benchmarks"]
-# Create list for the results
-full_results = {}
-
-for itm in benchmarks:
-   try:
-      # Get payload size (in byte) from benchmark name
-      payload_size = int(re.search(r'/(\d+)/[a-z]', itm["name"]).group(1))
-      # Get background thread count from benchmark name (if applicable)
-      thread_count = 1
-      multi = re.search(r'[a-z]/(\d+)/[0-9]', itm["name"])
-      if multi:
-         # Adding 1 to account for the main thread
-         thread_count += int(multi.group(1))
-      # Get time taken. Expecting time in nanoseconds
-      real_time_ns = float(itm["real_time"])
-      # Calculating send frequency in hertz (corresponds to throughput in ops/s)
-      frequency = 1 / (real_time_ns * 10**-9) * thread_count
-      # Calculating speed in bytes per second
-      speed = frequency * payload_size * thread_count
-      # Output to console
-      print(f"Payload Size: {payload_size} Bytes  ||  Real Time: {real_time_ns} ns  ||  Frequency: {frequency} ops/s  ||  Datarate: {speed} Bytes/s  ||  Thread count: {thread_count}")
-      # Create new dictionary for this datapoint
-      datapoint = {
-         "throughput" : {
-            "value" : frequency
-         },
-         "speed" : {
-            "value" : speed
-         }
-      }
-      # Add dictionary to full results dictionary
-      full_results.update({itm["name"] : datapoint})
-   except (KeyError, ValueError, AttributeError) as e:
-      print(f"WARNING: Skipping invalid benchmark entry: {itm}. Reason: {e}")
+full_results = calculate(load_benchmarks(file_in_path))
 
 # Write full calculation results into a new json file
 filename_no_ext = re.sub(r'\.[^.]+$', "", os.path.basename(file_in_path))
-file_out = f"{filename_no_ext}_throughput-calculation.json"
-try:
-   with open(file_out, "w") as f:
-      json.dump(full_results, f, indent=4)
-except IOError as e:
-   print(f"ERROR: Failed to write output file: {e}")
-   exit(1)
-
-print(f"Results written to {os.path.abspath(file_out)}")
\ No newline at end of file
+write_json(f"{filename_no_ext}_throughput-calculation.json", full_results)
+
+# Compare to the baseline run
+if args.compare:
+   print(f"Comparing to baseline {args.compare}")
+   baseline_results = calculate(load_benchmarks(args.compare))
+   comparison, regressions = compare(full_results, baseline_results, args.threshold)
+   write_json(f"{filename_no_ext}_comparison.json", comparison)
+
+   if regressions > 0:
+      print(f"ERROR: {regressions} metric(s) regressed by more than {args.threshold} %")
+      exit(2)
+   print(f"No metric regressed by more than {args.threshold} %")
\ No newline at end of file
@@ -111,7 +111,11 @@ namespace eCAL
                                                                The publisher send call is blocked on this event with this timeout (0 == no handshake).*/
           unsigned int memfile_buffer_count    { 1U };    /*!< Maximum number of used buffers (needs to be greater than 1, default = 1) */
           unsigned int memfile_min_size_bytes  { 4096 };  //!< Default memory file size for new publisher (Default: 4096)
-          unsigned int memfile_reserve_percent { 50 };    //!< Dynamic file size reserve before recreating memory file if topic size changes (Default: 50)
+          unsigned int memfile_reserve_percent { 50 };    //!< Minimal dynamic file size reserve before recreating memory file if topic size changes, continuously growing topics get a larger reserve (Default: 50)
+          bool         memfile_memfd           { false }; /*!< Linux only: Create anonymous memory files (memfd) and pass them to local subscribers via a Unix socket
+                                                               instead of named files in /dev/shm. Requires subscribers with memfd support. (Default: false) */
+          bool         memfile_huge_pages      { false }; //!< Linux only: Back memory files larger than a huge page by transparent huge pages, if enabled for shared memory by the system (Default: false)
+          bool         memfile_prefault        { false }; //!< Linux only: Populate memory files on creation, so the first send of a large payload does not page fault (Default: false)
         };
       }
 
@@ -119,7 +123,12 @@ namespace eCAL
       {
         struct Configuration
         {
-          bool enable { true };                          //!< enable layer
+          bool         enable                  { true };  //!< enable layer
+
+          bool         coalescing_enable       { false }; /*!< Pack small samples of different topics of this process into one multi-sample frame.
+                                                               Requires subscribers with sample frame support. (Default: false) */
+          unsigned int coalescing_max_delay_us { 200 };   //!< Maximum time a sample is held back before its frame is sent in microseconds (Default: 200)
+          unsigned int coalescing_max_size     { 1400 };  //!< Maximum frame size in bytes, larger samples are sent on their own (Default: 1400)
         };
       }
 
@@ -93,6 +93,10 @@ namespace eCAL
       unsigned int           registration_refresh { 1000U };  //!< Topic registration refresh cylce (has to be smaller then registration timeout!) (Default: 1000)                                   
 
       bool                   loopback             { true };   //!< enable to receive udp messages on the same local machine (Default: true)
+      bool                   fast_discovery       { false };  /*!< Publishers and subscribers re-register immediately when they see a new matching
+                                                                 entity, so connections are established without waiting for the next refresh cycle (Default: false) */
+      unsigned int           descriptor_refresh   { 1U };     /*!< Publishers and subscribers send their full datatype descriptor only with every n-th registration
+                                                                 refresh, all other registrations carry the descriptor hash only (Default: 1 = every refresh) */
       std::string            shm_transport_domain { "" };     /*!< Common shm transport domain that enables interprocess mechanisms across
                                                                  (virtual) host borders (e.g, Docker); by default equivalent to local host name (Default: "") */
       Local::Configuration   local;
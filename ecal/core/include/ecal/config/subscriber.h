@@ -71,6 +71,11 @@ namespace eCAL
       Layer::Configuration layer;
 
       bool drop_out_of_order_messages { true }; //!< Enable dropping of payload messages that arrive out of order
+
+      unsigned int max_frequency_mhz { 0U };    //!< Maximum rate at which samples of a publisher are received in mHz, the publisher skips samples
+                                                //!< in between for this subscriber, 0 = no limit (Default: 0)
+      unsigned int downsampling      { 1U };    //!< Receive only every n-th sample of a publisher, the publisher skips the others
+                                                //!< for this subscriber, 0 or 1 = every sample (Default: 1)
     };
   }
 }
@@ -0,0 +1,52 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @file   config/threading.h
+ * @brief  eCAL configuration for the internal threads
+**/
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+namespace eCAL
+{
+  namespace Threading
+  {
+    struct Policy
+    {
+      std::string               name;             //!< Name of the threads, shown e.g. by top -H (truncated to 15 characters on Linux), empty = keep the default name
+      std::vector<unsigned int> cpu_set;          //!< CPUs the threads may run on, empty = all CPUs (Linux and Windows only)
+      unsigned int              priority { 0U };  /*!< Linux only: SCHED_FIFO priority (1 - 99) of the threads, 0 = keep the default scheduling.
+                                                       Requires the CAP_SYS_NICE capability or a matching RLIMIT_RTPRIO (Default: 0) */
+    };
+
+    struct Configuration
+    {
+      Policy registration { "ecal-reg",      {}, 0U };  //!< Registration send, receive and timeout threads
+      Policy shm          { "ecal-shm",      {}, 0U };  //!< Shared memory observer and cleanup threads
+      Policy udp          { "ecal-udp",      {}, 0U };  //!< UDP receive and sample coalescing threads
+      Policy tcp          { "ecal-tcp",      {}, 0U };  //!< tcp_pubsub executor threads (Linux only, they inherit the policy from the creating thread)
+      Policy service      { "ecal-service",  {}, 0U };  //!< Service client and server io threads
+      Policy timer        { "ecal-timer",    {}, 0U };  //!< eCAL::CTimer threads
+    };
+  }
+}
@@ -63,6 +63,10 @@ namespace eCAL
                                                                          independent of their link state. Enabling this makes sure that eCAL processes
                                                                          receive data if they are started before network devices are up and running. (Default: false)*/
         bool                    npcap_enabled       { false };   //!< Enable to receive UDP traffic with the Npcap based receiver (Default: false)
+        unsigned int            topic_group_pool_size { 0 };     /*!< v2, network mode only: Number of multicast groups following the network group base that topic payloads
+                                                                         are spread over. Publishers send a topic to its group, subscribers only join the groups of their topics,
+                                                                         so unsubscribed topics are filtered by the network and the kernel. Needs to be equal for all processes.
+                                                                         0 sends all topics to the network group base. (Default: 0) */
       
         MulticastConfiguration  network             { "239.0.0.1", 3U };      //!< default: "239.0.0.1", 3U
         MulticastConfiguration  local               { "127.255.255.255", 1U}; //!< default: "127.255.255.255", 1U
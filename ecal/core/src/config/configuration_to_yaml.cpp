@@ -188,6 +188,8 @@ namespace YAML
     node["registration_timeout"] = config_.registration_timeout;
     node["registration_refresh"] = config_.registration_refresh;
     node["loopback"]             = config_.loopback;
+    node["fast_discovery"]       = config_.fast_discovery;
+    node["descriptor_refresh"]   = config_.descriptor_refresh;
     node["shm_transport_domain"] = config_.shm_transport_domain;
     return node;
   }
@@ -197,6 +199,8 @@ namespace YAML
     AssignValue<unsigned int>(config_.registration_timeout, node_, "registration_timeout");
     AssignValue<unsigned int>(config_.registration_refresh, node_, "registration_refresh");
     AssignValue<bool>(config_.loopback, node_, "loopback");    
+    AssignValue<bool>(config_.fast_discovery, node_, "fast_discovery");
+    AssignValue<unsigned int>(config_.descriptor_refresh, node_, "descriptor_refresh");
     AssignValue<eCAL::Registration::Local::Configuration>(config_.local, node_, "local");
     AssignValue<eCAL::Registration::Network::Configuration>(config_.network, node_, "network");
 
@@ -258,6 +262,7 @@ namespace YAML
     node["receive_buffer"]      = config_.receive_buffer;
     node["join_all_interfaces"] = config_.join_all_interfaces;
     node["npcap_enabled"]       = config_.npcap_enabled;
+    node["topic_group_pool_size"] = config_.topic_group_pool_size;
     node["network"]             = config_.network;
     node["local"]               = config_.local;
     return node;
@@ -276,6 +281,7 @@ namespace YAML
     AssignValue<unsigned int>(config_.receive_buffer, node_, "receive_buffer");
     AssignValue<bool>(config_.join_all_interfaces, node_, "join_all_interfaces");
     AssignValue<bool>(config_.npcap_enabled, node_, "npcap_enabled");
+    AssignValue<unsigned int>(config_.topic_group_pool_size, node_, "topic_group_pool_size");
 
     AssignValue<eCAL::TransportLayer::UDP::MulticastConfiguration>(config_.network, node_, "network");
     AssignValue<eCAL::TransportLayer::UDP::MulticastConfiguration>(config_.local, node_, "local");
@@ -315,6 +321,9 @@ namespace YAML
     node["memfile_buffer_count"]     = config_.memfile_buffer_count;
     node["memfile_min_size_bytes"]   = config_.memfile_min_size_bytes;
     node["memfile_reserve_percent"]  = config_.memfile_reserve_percent;
+    node["memfile_memfd"]            = config_.memfile_memfd;
+    node["memfile_huge_pages"]       = config_.memfile_huge_pages;
+    node["memfile_prefault"]         = config_.memfile_prefault;
     return node;
   }
 
@@ -326,13 +335,19 @@ namespace YAML
     AssignValue<unsigned int>(config_.memfile_buffer_count, node_, "memfile_buffer_count");
     AssignValue<unsigned int>(config_.memfile_min_size_bytes, node_, "memfile_min_size_bytes");
     AssignValue<unsigned int>(config_.memfile_reserve_percent, node_, "memfile_reserve_percent");
+    AssignValue<bool>(config_.memfile_memfd, node_, "memfile_memfd");
+    AssignValue<bool>(config_.memfile_huge_pages, node_, "memfile_huge_pages");
+    AssignValue<bool>(config_.memfile_prefault, node_, "memfile_prefault");
     return true;
   }
   
   Node convert<eCAL::Publisher::Layer::UDP::Configuration>::encode(const eCAL::Publisher::Layer::UDP::Configuration& config_)
   {
     Node node;
-    node["enable"] = config_.enable;
+    node["enable"]                  = config_.enable;
+    node["coalescing_enable"]       = config_.coalescing_enable;
+    node["coalescing_max_delay_us"] = config_.coalescing_max_delay_us;
+    node["coalescing_max_size"]     = config_.coalescing_max_size;
 
     return node;
   }
@@ -340,6 +355,9 @@ namespace YAML
   bool convert<eCAL::Publisher::Layer::UDP::Configuration>::decode(const Node& node_, eCAL::Publisher::Layer::UDP::Configuration& config_)
   {
     AssignValue<bool>(config_.enable, node_, "enable");
+    AssignValue<bool>(config_.coalescing_enable, node_, "coalescing_enable");
+    AssignValue<unsigned int>(config_.coalescing_max_delay_us, node_, "coalescing_max_delay_us");
+    AssignValue<unsigned int>(config_.coalescing_max_size, node_, "coalescing_max_size");
     return true;
   }
   
@@ -465,6 +483,8 @@ namespace YAML
     Node node;
     node["layer"] = config_.layer;
     node["drop_out_of_order_messages"] = config_.drop_out_of_order_messages;
+    node["max_frequency_mhz"]          = config_.max_frequency_mhz;
+    node["downsampling"]               = config_.downsampling;
     return node;
   }
 
@@ -472,6 +492,8 @@ namespace YAML
   {
     AssignValue<eCAL::Subscriber::Layer::Configuration>(config_.layer, node_, "layer");
     AssignValue<bool>(config_.drop_out_of_order_messages, node_, "drop_out_of_order_messages");
+    AssignValue<unsigned int>(config_.max_frequency_mhz, node_, "max_frequency_mhz");
+    AssignValue<unsigned int>(config_.downsampling, node_, "downsampling");
     return true;
   }
 
@@ -669,6 +691,55 @@ namespace YAML
   }
 
 
+  /*
+     ________                   ___          
+    /_  __/ /  _______ ___ ____/ (_)__  ___ _
+     / / / _ \/ __/ -_) _ `/ _  / / _ \/ _ `/
+    /_/ /_//_/_/  \__/\_,_/\_,_/_/_//_/\_, / 
+                                      /___/  
+  */
+
+  Node convert<eCAL::Threading::Policy>::encode(const eCAL::Threading::Policy& config_)
+  {
+    Node node;
+    node["name"]     = config_.name;
+    node["cpu_set"]  = config_.cpu_set;
+    node["priority"] = config_.priority;
+    return node;
+  }
+
+  bool convert<eCAL::Threading::Policy>::decode(const Node& node_, eCAL::Threading::Policy& config_)
+  {
+    AssignValue<std::string>(config_.name, node_, "name");
+    AssignValue<std::vector<unsigned int>>(config_.cpu_set, node_, "cpu_set");
+    AssignValue<unsigned int>(config_.priority, node_, "priority");
+    return true;
+  }
+
+  Node convert<eCAL::Threading::Configuration>::encode(const eCAL::Threading::Configuration& config_)
+  {
+    Node node;
+    node["registration"] = config_.registration;
+    node["shm"]          = config_.shm;
+    node["udp"]          = config_.udp;
+    node["tcp"]          = config_.tcp;
+    node["service"]      = config_.service;
+    node["timer"]        = config_.timer;
+    return node;
+  }
+
+  bool convert<eCAL::Threading::Configuration>::decode(const Node& node_, eCAL::Threading::Configuration& config_)
+  {
+    AssignValue<eCAL::Threading::Policy>(config_.registration, node_, "registration");
+    AssignValue<eCAL::Threading::Policy>(config_.shm, node_, "shm");
+    AssignValue<eCAL::Threading::Policy>(config_.udp, node_, "udp");
+    AssignValue<eCAL::Threading::Policy>(config_.tcp, node_, "tcp");
+    AssignValue<eCAL::Threading::Policy>(config_.service, node_, "service");
+    AssignValue<eCAL::Threading::Policy>(config_.timer, node_, "timer");
+    return true;
+  }
+
+
   /*
        __  ___     _                      ____                    __  _         
       /  |/  /__ _(_)__    _______  ___  / _(_)__ ___ _________ _/ /_(_)__  ___ 
@@ -686,6 +757,7 @@ namespace YAML
     node["time"]               = config_.timesync;
     node["application"]        = config_.application;
     node["logging"]            = config_.logging;
+    node["threading"]          = config_.threading;
     node["communication_mode"] = config_.communication_mode == eCAL::eCommunicationMode::network ? "network" : "local";
     
     return node;
@@ -700,6 +772,7 @@ namespace YAML
     AssignValue<eCAL::Time::Configuration>(config_.timesync, node_, "time");
     AssignValue<eCAL::Application::Configuration>(config_.application, node_, "application");
     AssignValue<eCAL::Logging::Configuration>(config_.logging, node_, "logging");
+    AssignValue<eCAL::Threading::Configuration>(config_.threading, node_, "threading");
     
     std::string communication_mode;
     AssignValue<std::string>(communication_mode, node_, "communication_mode");
@@ -343,6 +343,30 @@ namespace YAML
   };
 
 
+  /*
+     ________                   ___          
+    /_  __/ /  _______ ___ ____/ (_)__  ___ _
+     / / / _ \/ __/ -_) _ `/ _  / / _ \/ _ `/
+    /_/ /_//_/_/  \__/\_,_/\_,_/_/_//_/\_, / 
+                                      /___/  
+  */
+  template<>
+  struct convert<eCAL::Threading::Policy>
+  {
+    static Node encode(const eCAL::Threading::Policy& config_);
+
+    static bool decode(const Node& node_, eCAL::Threading::Policy& config_);
+  };
+
+  template<>
+  struct convert<eCAL::Threading::Configuration>
+  {
+    static Node encode(const eCAL::Threading::Configuration& config_);
+
+    static bool decode(const Node& node_, eCAL::Threading::Configuration& config_);
+  };
+
+
   /*
        __  ___     _                      ____                    __  _         
       /  |/  /__ _(_)__    _______  ___  / _(_)__ ___ _________ _/ /_(_)__  ___ 
@@ -3,6 +3,7 @@
 #include "ecal/config.h"
 
 #include <string>
+#include <vector>
 
 namespace 
 {
@@ -38,6 +39,25 @@ namespace
     return result;
   }
 
+  std::string quoteString(const std::vector<unsigned int>& vector_)
+  {
+    std::string result = "[";
+    for (const auto& elem : vector_)
+    {
+      result += std::to_string(elem) + ", ";
+    }
+
+    if (!vector_.empty())
+    {
+      // remove the last ", "
+      result.pop_back();
+      result.pop_back();
+    }
+
+    result += "]";
+    return result;
+  }
+
   std::string quoteString(const eCAL::Publisher::Configuration::LayerPriorityVector& vector_)
   {
     std::string result = "[";
@@ -177,6 +197,13 @@ namespace eCAL
       ss << R"(  registration_timeout: )"                            << config_.registration.registration_timeout                   << "\n";
       ss << R"(  # Enable to receive registration information on the same local machine)"                                           << "\n";
       ss << R"(  loopback: )"                                        << config_.registration.loopback                               << "\n";
+      ss << R"(  # Re-register immediately when a new matching publisher / subscriber is detected,)"                                << "\n";
+      ss << R"(  # so connections are established without waiting for the next refresh cycle (Default: false))"                     << "\n";
+      ss << R"(  fast_discovery: )"                                  << config_.registration.fast_discovery                         << "\n";
+      ss << R"(  # Send the full datatype descriptor only with every n-th registration refresh, all other)"                          << "\n";
+      ss << R"(  # registrations carry the descriptor hash only. Keep 1 if eCAL versions older than)"                                << "\n";
+      ss << R"(  # this option are part of the system, they cannot resolve descriptor hashes (Default: 1))"                         << "\n";
+      ss << R"(  descriptor_refresh: )"                              << config_.registration.descriptor_refresh                     << "\n";
       ss << R"(  # SHM transport domain that enables interprocess mechanisms across (virtual))"                                     << "\n";
       ss << R"(  # host borders (e.g, Docker); by default equivalent to local host name)"                                           << "\n";
       ss << R"(  shm_transport_domain: )"                            << quoteString(config_.registration.shm_transport_domain)      << "\n";
@@ -226,6 +253,9 @@ namespace eCAL
       ss << R"(    join_all_interfaces: )"                           << config_.transport_layer.udp.join_all_interfaces             << "\n";
       ss << R"(    # Windows specific setting to enable receiving UDP traffic with the Npcap based receiver)"                       << "\n";
       ss << R"(    npcap_enabled: )"                                 << config_.transport_layer.udp.npcap_enabled                   << "\n";
+      ss << R"(    # v2, network mode only: Number of multicast groups following the network group base that topic payloads are spread over.)" << "\n";
+      ss << R"(    # Subscribers only join the groups of their topics. Needs to be equal for all processes, 0 sends all topics to the group base.)" << "\n";
+      ss << R"(    topic_group_pool_size: )"                         << config_.transport_layer.udp.topic_group_pool_size           << "\n";
       ss << R"()"                                                                                                                   << "\n";
       ss << R"(    # Local mode multicast group and ttl)"                                                                           << "\n";
       ss << R"(    local:)"                                                                                                         << "\n";
@@ -265,13 +295,26 @@ namespace eCAL
       ss << R"(      memfile_buffer_count: )"                        << config_.publisher.layer.shm.memfile_buffer_count            << "\n";
       ss << R"(      # Default memory file size for new publisher)"                                                                 << "\n";
       ss << R"(      memfile_min_size_bytes: )"                      << config_.publisher.layer.shm.memfile_min_size_bytes          << "\n";
-      ss << R"(      # Dynamic file size reserve before recreating memory file if topic size changes)"                              << "\n";
+      ss << R"(      # Minimal dynamic file size reserve before recreating memory file if topic size changes)"                      << "\n";
       ss << R"(      memfile_reserve_percent: )"                     << config_.publisher.layer.shm.memfile_reserve_percent         << "\n";
+      ss << R"(      # Linux only: Create anonymous memory files (memfd) and pass them to local subscribers via a Unix socket)"      << "\n";
+      ss << R"(      # instead of named files in /dev/shm. Requires subscribers with memfd support.)"                                << "\n";
+      ss << R"(      memfile_memfd: )"                               << config_.publisher.layer.shm.memfile_memfd                   << "\n";
+      ss << R"(      # Linux only: Back memory files larger than a huge page by transparent huge pages, if enabled for shared memory by the system)" << "\n";
+      ss << R"(      memfile_huge_pages: )"                          << config_.publisher.layer.shm.memfile_huge_pages              << "\n";
+      ss << R"(      # Linux only: Populate memory files on creation, so the first send of a large payload does not page fault)"    << "\n";
+      ss << R"(      memfile_prefault: )"                            << config_.publisher.layer.shm.memfile_prefault                << "\n";
       ss << R"()"                                                                                                                   << "\n";
       ss << R"(    # Base configuration for UDP publisher)"                                                                         << "\n";
       ss << R"(    udp:)"                                                                                                           << "\n";
       ss << R"(      # Enable layer)"                                                                                               << "\n";
       ss << R"(      enable: )"                                      << config_.publisher.layer.udp.enable                          << "\n";
+      ss << R"(      # Pack small samples of different topics into one multi-sample frame, subscribers need an eCAL version supporting sample frames)" << "\n";
+      ss << R"(      coalescing_enable: )"                           << config_.publisher.layer.udp.coalescing_enable               << "\n";
+      ss << R"(      # Maximum time a sample is held back before its frame is sent in microseconds)"                               << "\n";
+      ss << R"(      coalescing_max_delay_us: )"                     << config_.publisher.layer.udp.coalescing_max_delay_us         << "\n";
+      ss << R"(      # Maximum size of a frame in bytes, larger samples are sent on their own)"                                     << "\n";
+      ss << R"(      coalescing_max_size: )"                         << config_.publisher.layer.udp.coalescing_max_size             << "\n";
       ss << R"()"                                                                                                                   << "\n";
       ss << R"(    # Base configuration for TCP publisher)"                                                                         << "\n";
       ss << R"(    tcp:)"                                                                                                           << "\n";
@@ -304,6 +347,11 @@ namespace eCAL
       ss << R"()"                                                                                                                   << "\n";
       ss << R"(  # Enable dropping of payload messages that arrive out of order)"                                                   << "\n";
       ss << R"(  drop_out_of_order_messages: )"                        << config_.subscriber.drop_out_of_order_messages             << "\n";
+      ss << R"(  # Maximum rate at which samples of a publisher are received in mHz, 0 = no limit)"                                 << "\n";
+      ss << R"(  # The publisher skips the samples in between for this subscriber)"                                                 << "\n";
+      ss << R"(  max_frequency_mhz: )"                                 << config_.subscriber.max_frequency_mhz                      << "\n";
+      ss << R"(  # Receive only every n-th sample of a publisher, 0 or 1 = every sample)"                                           << "\n";
+      ss << R"(  downsampling: )"                                      << config_.subscriber.downsampling                           << "\n";
       ss << R"()"                                                                                                                   << "\n";
       ss << R"()"                                                                                                                   << "\n";
       ss << R"(# Time configuration)"                                                                                               << "\n";
@@ -377,6 +425,45 @@ namespace eCAL
       ss << R"(      # UDP Port for sending logging data)"                                                                          << "\n";
       ss << R"(      port: )"                                         << config_.logging.receiver.udp_config.port                   << "\n";
       ss << R"()"                                                                                                                   << "\n";
+      ss << R"()"                                                                                                                   << "\n";
+      ss << R"(# Configuration of the eCAL internal threads)"                                                                       << "\n";
+      ss << R"(threading:)"                                                                                                         << "\n";
+      ss << R"(  # Every thread class has a policy with)"                                                                           << "\n";
+      ss << R"(  #   name:     Thread name shown e.g. by top -H (truncated to 15 characters on Linux), "" keeps the default name)"  << "\n";
+      ss << R"(  #   cpu_set:  CPUs the threads may run on, e.g. [2, 3], [] = all CPUs (Linux and Windows only))"                   << "\n";
+      ss << R"(  #   priority: Linux only SCHED_FIFO priority (1 - 99), 0 = default scheduling)"                                      << "\n";
+      ss << R"(  #             (requires the CAP_SYS_NICE capability or a matching RLIMIT_RTPRIO))"                                   << "\n";
+      ss << R"(  # Registration send, receive and timeout threads)"                                                                 << "\n";
+      ss << R"(  registration:)"                                                                                                    << "\n";
+      ss << R"(    name: )"                                          << quoteString(config_.threading.registration.name)            << "\n";
+      ss << R"(    cpu_set: )"                                       << quoteString(config_.threading.registration.cpu_set)         << "\n";
+      ss << R"(    priority: )"                                      << config_.threading.registration.priority                     << "\n";
+      ss << R"(  # Shared memory observer and cleanup threads)"                                                                     << "\n";
+      ss << R"(  shm:)"                                                                                                             << "\n";
+      ss << R"(    name: )"                                          << quoteString(config_.threading.shm.name)                     << "\n";
+      ss << R"(    cpu_set: )"                                       << quoteString(config_.threading.shm.cpu_set)                  << "\n";
+      ss << R"(    priority: )"                                      << config_.threading.shm.priority                              << "\n";
+      ss << R"(  # UDP receive and sample coalescing threads)"                                                                      << "\n";
+      ss << R"(  udp:)"                                                                                                             << "\n";
+      ss << R"(    name: )"                                          << quoteString(config_.threading.udp.name)                     << "\n";
+      ss << R"(    cpu_set: )"                                       << quoteString(config_.threading.udp.cpu_set)                  << "\n";
+      ss << R"(    priority: )"                                      << config_.threading.udp.priority                              << "\n";
+      ss << R"(  # tcp_pubsub executor threads (Linux only, they inherit the policy from the creating thread))"                     << "\n";
+      ss << R"(  tcp:)"                                                                                                             << "\n";
+      ss << R"(    name: )"                                          << quoteString(config_.threading.tcp.name)                     << "\n";
+      ss << R"(    cpu_set: )"                                       << quoteString(config_.threading.tcp.cpu_set)                  << "\n";
+      ss << R"(    priority: )"                                      << config_.threading.tcp.priority                              << "\n";
+      ss << R"(  # Service client and server io threads)"                                                                           << "\n";
+      ss << R"(  service:)"                                                                                                         << "\n";
+      ss << R"(    name: )"                                          << quoteString(config_.threading.service.name)                 << "\n";
+      ss << R"(    cpu_set: )"                                       << quoteString(config_.threading.service.cpu_set)              << "\n";
+      ss << R"(    priority: )"                                      << config_.threading.service.priority                          << "\n";
+      ss << R"(  # eCAL::CTimer threads)"                                                                                           << "\n";
+      ss << R"(  timer:)"                                                                                                           << "\n";
+      ss << R"(    name: )"                                          << quoteString(config_.threading.timer.name)                   << "\n";
+      ss << R"(    cpu_set: )"                                       << quoteString(config_.threading.timer.cpu_set)                << "\n";
+      ss << R"(    priority: )"                                      << config_.threading.timer.priority                            << "\n";
+      ss << R"()"                                                                                                                   << "\n";
     
       return ss;
     }
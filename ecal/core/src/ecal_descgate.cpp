@@ -72,9 +72,11 @@ namespace
 
   void ApplyTopicDescription(eCAL::CDescGate::STopicIdInfoMap& topic_info_map_,
     const eCAL::CDescGate::STopicEventCallbackMap& topic_callback_map_,
+    eCAL::CDescriptorStore& descriptor_store_,
     const eCAL::Registration::SampleIdentifier& topic_id_,
     const std::string& topic_name_,
-    const eCAL::SDataTypeInformation& topic_info_)
+    const eCAL::SDataTypeInformation& topic_info_,
+    uint64_t descriptor_hash_)
   {
     const auto topic_info_key = eCAL::STopicId{ ConvertToEntityId(topic_id_), topic_name_ };
 
@@ -87,10 +89,32 @@ namespace
 
       if (new_topic_info)
       {
-        std::tie(topic_info_quality_iter, std::ignore) = topic_info_map_.map.emplace(topic_info_key, eCAL::SDataTypeInformation{});
+        std::tie(topic_info_quality_iter, std::ignore) = topic_info_map_.map.emplace(topic_info_key, eCAL::CDescGate::STopicInfo{});
       }
 
-      topic_info_quality_iter->second = topic_info_;
+      auto& topic_info = topic_info_quality_iter->second;
+      topic_info.name     = topic_info_.name;
+      topic_info.encoding = topic_info_.encoding;
+
+      if (topic_info_.descriptor.empty())
+      {
+        // the sender omitted the descriptor, keep the known one as long as the hash did not change
+        if ((descriptor_hash_ == 0) || (descriptor_hash_ != topic_info.descriptor_hash))
+        {
+          topic_info.descriptor = nullptr;
+        }
+      }
+      else
+      {
+        // intern the descriptor only if it changed, senders without hash are compared by content
+        const bool descriptor_changed = !topic_info.descriptor
+          || ((descriptor_hash_ != 0) ? (descriptor_hash_ != topic_info.descriptor_hash) : (*topic_info.descriptor != topic_info_.descriptor));
+        if (descriptor_changed)
+        {
+          topic_info.descriptor = descriptor_store_.Intern(topic_info_.descriptor);
+        }
+      }
+      topic_info.descriptor_hash = descriptor_hash_;
     }
 
     // notify publisher / subscriber registration callbacks about new entity
@@ -257,7 +281,9 @@ namespace eCAL
     }
     else
     {
-      topic_info_ = iter->second;
+      topic_info_.name       = iter->second.name;
+      topic_info_.encoding   = iter->second.encoding;
+      topic_info_.descriptor = iter->second.descriptor ? *iter->second.descriptor : std::string();
       return true;
     }
   }
@@ -311,13 +337,13 @@ namespace eCAL
       RemServiceDescription(m_client_info_map, sample_.identifier, sample_.client);
       break;
     case bct_reg_publisher:
-      ApplyTopicDescription(m_publisher_info_map, m_publisher_callback_map, sample_.identifier, sample_.topic.topic_name, sample_.topic.datatype_information);
+      ApplyTopicDescription(m_publisher_info_map, m_publisher_callback_map, m_descriptor_store, sample_.identifier, sample_.topic.topic_name, sample_.topic.datatype_information, sample_.topic.descriptor_hash);
       break;
     case bct_unreg_publisher:
       RemTopicDescription(m_publisher_info_map, m_publisher_callback_map, sample_.identifier, sample_.topic.topic_name);
       break;
     case bct_reg_subscriber:
-      ApplyTopicDescription(m_subscriber_info_map, m_subscriber_callback_map, sample_.identifier, sample_.topic.topic_name, sample_.topic.datatype_information);
+      ApplyTopicDescription(m_subscriber_info_map, m_subscriber_callback_map, m_descriptor_store, sample_.identifier, sample_.topic.topic_name, sample_.topic.datatype_information, sample_.topic.descriptor_hash);
       break;
     case bct_unreg_subscriber:
       RemTopicDescription(m_subscriber_info_map, m_subscriber_callback_map, sample_.identifier, sample_.topic.topic_name);
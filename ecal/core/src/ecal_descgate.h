@@ -29,6 +29,7 @@
 #include <ecal/util.h>
 
 #include "serialization/ecal_struct_sample_registration.h"
+#include "ecal_descriptor_store.h"
 
 #include <atomic>
 #include <chrono>
@@ -60,6 +61,9 @@ namespace eCAL
     Registration::CallbackToken AddSubscriberEventCallback(const Registration::TopicEventCallbackT& callback_);
     void RemSubscriberEventCallback(Registration::CallbackToken token_);
 
+    // shared descriptor store, used to complete registrations that only carry the descriptor hash
+    CDescriptorStore& GetDescriptorStore() { return m_descriptor_store; }
+
     // get service information
     std::set<SServiceId> GetServerIDs() const;
     bool GetServerInfo(const SServiceId& id_, ServiceMethodInformationSetT& service_info_) const;
@@ -76,7 +80,16 @@ namespace eCAL
     CDescGate(CDescGate&&) = delete;
     CDescGate& operator=(CDescGate&&) = delete;
 
-    using TopicIdInfoMap  = std::map<STopicId, SDataTypeInformation>;
+    // topic datatype information with the descriptor shared through the descriptor store
+    struct STopicInfo
+    {
+      std::string                   name;
+      std::string                   encoding;
+      CDescriptorStore::DescriptorT descriptor;
+      uint64_t                      descriptor_hash = 0;
+    };
+
+    using TopicIdInfoMap  = std::map<STopicId, STopicInfo>;
     struct STopicIdInfoMap
     {
       mutable std::mutex mtx;
@@ -118,6 +131,8 @@ namespace eCAL
     SServiceIdInfoMap                        m_service_info_map;
     SServiceIdInfoMap                        m_client_info_map;
 
+    CDescriptorStore                         m_descriptor_store;
+
     mutable std::mutex                       m_callback_token_mtx;
     std::atomic<Registration::CallbackToken> m_callback_token{ 0 };
   };
@@ -0,0 +1,108 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  eCAL datatype descriptor store
+**/
+
+#include "ecal_descriptor_store.h"
+
+namespace eCAL
+{
+  uint64_t CDescriptorStore::Hash(const std::string& descriptor_)
+  {
+    if (descriptor_.empty()) return 0;
+
+    uint64_t hash = 14695981039346656037ULL;
+    for (const char c : descriptor_)
+    {
+      hash ^= static_cast<uint8_t>(c);
+      hash *= 1099511628211ULL;
+    }
+
+    // 0 is reserved for "no descriptor"
+    return (hash != 0) ? hash : 1;
+  }
+
+  CDescriptorStore::DescriptorT CDescriptorStore::Intern(const std::string& descriptor_)
+  {
+    if (descriptor_.empty()) return nullptr;
+
+    // always hash locally, a hash announced by a remote sender is never used as key
+    const uint64_t hash = Hash(descriptor_);
+
+    const std::lock_guard<std::mutex> lock(m_descriptor_map_mtx);
+
+    auto& entry = m_descriptor_map[hash];
+    DescriptorT descriptor = entry.lock();
+    if (descriptor)
+    {
+      // same content, share it
+      if (*descriptor == descriptor_) return descriptor;
+
+      // hash collision, keep the stored one and hand out a private copy
+      return std::make_shared<const std::string>(descriptor_);
+    }
+
+    descriptor = std::make_shared<const std::string>(descriptor_);
+    entry = descriptor;
+
+    // descriptors are rarely added, so sweeping expired entries whenever
+    // the map has doubled keeps it bounded without a periodic cleanup
+    if (m_descriptor_map.size() >= m_cleanup_size)
+    {
+      RemoveExpired();
+      m_cleanup_size = 2 * m_descriptor_map.size() + 16;
+    }
+
+    return descriptor;
+  }
+
+  CDescriptorStore::DescriptorT CDescriptorStore::Find(uint64_t hash_) const
+  {
+    if (hash_ == 0) return nullptr;
+
+    const std::lock_guard<std::mutex> lock(m_descriptor_map_mtx);
+
+    auto iter = m_descriptor_map.find(hash_);
+    if (iter == m_descriptor_map.end()) return nullptr;
+    return iter->second.lock();
+  }
+
+  size_t CDescriptorStore::Size() const
+  {
+    const std::lock_guard<std::mutex> lock(m_descriptor_map_mtx);
+
+    size_t size(0);
+    for (const auto& entry : m_descriptor_map)
+    {
+      if (!entry.second.expired()) ++size;
+    }
+    return size;
+  }
+
+  void CDescriptorStore::RemoveExpired()
+  {
+    for (auto iter = m_descriptor_map.begin(); iter != m_descriptor_map.end();)
+    {
+      if (iter->second.expired()) iter = m_descriptor_map.erase(iter);
+      else                        ++iter;
+    }
+  }
+}
@@ -0,0 +1,74 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  eCAL datatype descriptor store
+ *
+ * Interns datatype descriptors by their content hash. All holders of the same
+ * descriptor (description gate, monitoring) share one refcounted copy, and
+ * registration samples that only carry the descriptor hash can be completed
+ * from it as long as any holder keeps the descriptor alive.
+**/
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace eCAL
+{
+  class CDescriptorStore
+  {
+  public:
+    using DescriptorT = std::shared_ptr<const std::string>;
+
+    /**
+     * @brief Content hash of a descriptor (64 bit FNV-1a), stable across processes and platforms.
+     *
+     * @return The hash, 0 for an empty descriptor.
+    **/
+    static uint64_t Hash(const std::string& descriptor_);
+
+    /**
+     * @brief Get the shared copy of a descriptor, insert it if it is not known yet.
+     *
+     * @return The shared descriptor, nullptr for an empty descriptor.
+    **/
+    DescriptorT Intern(const std::string& descriptor_);
+
+    /**
+     * @brief Get the shared copy of a descriptor by its hash.
+     *
+     * @return The shared descriptor, nullptr if no one holds it anymore.
+    **/
+    DescriptorT Find(uint64_t hash_) const;
+
+    size_t Size() const;
+
+  private:
+    void RemoveExpired();
+
+    mutable std::mutex                                              m_descriptor_map_mtx;
+    std::unordered_map<uint64_t, std::weak_ptr<const std::string>> m_descriptor_map;
+    size_t                                                          m_cleanup_size = 16;
+  };
+}
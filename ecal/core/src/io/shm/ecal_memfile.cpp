@@ -54,7 +54,7 @@ namespace eCAL
     Destroy(false);
   }
 
-  bool CMemoryFile::Create(const char* name_, const bool create_, const size_t len_, bool auto_sanitizing_)
+  bool CMemoryFile::Create(const char* name_, const bool create_, const size_t len_, bool auto_sanitizing_, const SMemFileMapOptions& map_options_)
   {
     assert((create_ && len_ > 0) || (!create_ && len_ == 0));
     assert((auto_sanitizing_ && create_) || !auto_sanitizing_);
@@ -83,6 +83,7 @@ namespace eCAL
       m_header       = SInternalHeader();
 
       m_memfile_info = SMemFileInfo();
+      if (create_) m_memfile_info.map_options = map_options_;
 
       // create memory file
       if (!memfile::db::AddFile(name_, create_, create_ ? len_ + m_header.int_hdr_size : SIZEOF_PARTIAL_STRUCT(SInternalHeader, int_hdr_size), m_memfile_info))
@@ -57,10 +57,12 @@ namespace eCAL
      * @param name_    Unique file name. 
      * @param create_  Add file to system if not exists.
      * @param len_     Number of bytes to allocate (only if create_ == true). 
+     * @param auto_sanitizing_  Recover the file mutex if it has been left locked by a crashed process.
+     * @param map_options_      Mapping options applied by the creating process (only if create_ == true).
      *
      * @return  true if it succeeds, false if it fails. 
     **/
-    bool Create(const char* name_, bool create_, size_t len_ = 0, bool auto_sanitizing_ = false);
+    bool Create(const char* name_, bool create_, size_t len_ = 0, bool auto_sanitizing_ = false, const SMemFileMapOptions& map_options_ = SMemFileMapOptions());
 
     /**
      * @brief Delete the associated memory file from system. 
@@ -47,6 +47,12 @@ typedef int  MapRegionT;
 
 namespace eCAL
 {
+  struct SMemFileMapOptions
+  {
+    bool huge_pages = false;  // back the mapping by (transparent) huge pages if the system supports it
+    bool prefault   = false;  // populate the mapping on creation, so the first write does not page fault
+  };
+
   struct SMemFileInfo
   {
     int          refcnt      = 0;
@@ -57,5 +63,7 @@ namespace eCAL
     std::string  name;
     size_t       size        = 0;
     bool         exists      = false;
+    bool         memfd       = false;
+    SMemFileMapOptions map_options;
   };
 }
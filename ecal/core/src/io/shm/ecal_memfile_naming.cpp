@@ -19,6 +19,7 @@
 
 #include "io/shm/ecal_memfile_naming.h"
 
+#include <cctype>
 #include <ios>
 #include <limits>
 #include <random>
@@ -40,5 +41,36 @@ namespace eCAL
 
       return out.str();
     }
+
+    namespace
+    {
+      const std::string memfd_tag = "memfd";
+    }
+
+    // <base_name>memfd<process_id>_<random>
+    std::string BuildRandomMemFdFileName(const std::string& base_name, int process_id)
+    {
+      return BuildRandomMemFileName(base_name + memfd_tag + std::to_string(process_id) + "_");
+    }
+
+    bool ParseMemFdFileName(const std::string& name, int& process_id)
+    {
+      const size_t tag_pos = name.rfind(memfd_tag);
+      if (tag_pos == std::string::npos) return false;
+
+      const size_t pid_pos = tag_pos + memfd_tag.size();
+      const size_t pid_end = name.find('_', pid_pos);
+      if ((pid_end == std::string::npos) || (pid_end == pid_pos) || (pid_end - pid_pos > 9)) return false;
+
+      int pid(0);
+      for (size_t i = pid_pos; i < pid_end; ++i)
+      {
+        if (std::isdigit(static_cast<unsigned char>(name[i])) == 0) return false;
+        pid = pid * 10 + (name[i] - '0');
+      }
+
+      process_id = pid;
+      return true;
+    }
   }
 }
\ No newline at end of file
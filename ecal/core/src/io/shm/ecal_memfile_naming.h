@@ -30,5 +30,15 @@ namespace eCAL
   namespace memfile
   {
     std::string BuildRandomMemFileName(const std::string& base_name);
+
+    /**
+     * @brief Build a random name for a memfd memory file, that encodes the id of the creating process.
+    **/
+    std::string BuildRandomMemFdFileName(const std::string& base_name, int process_id);
+
+    /**
+     * @brief Check whether the name belongs to a memfd memory file and extract the id of the creating process.
+    **/
+    bool ParseMemFdFileName(const std::string& name, int& process_id);
   }
 }
\ No newline at end of file
@@ -24,7 +24,9 @@
 
 #include "ecal_event.h"
 #include "ecal_memfile_pool.h"
+#include "util/ecal_thread_factory.h"
 
+#include <algorithm>
 #include <chrono>
 #include <mutex>
 #include <string>
@@ -59,12 +61,25 @@ namespace eCAL
     if (m_created) return false;
 
     // open memory file events
-    gOpenNamedEvent(&m_event_snd, memfile_event_, false);
-    gOpenNamedEvent(&m_event_ack, memfile_event_ + "_ack", false);
+    {
+      const std::lock_guard<std::mutex> lock(m_event_sync);
+      gOpenNamedEvent(&m_event_snd, memfile_event_, false);
+      gOpenNamedEvent(&m_event_ack, memfile_event_ + "_ack", false);
+    }
 
     // create memory file access
     m_memfile.Create(memfile_name_.c_str(), false);
 
+    // the events of a successor memory file are named the same way
+    {
+      const std::lock_guard<std::mutex> lock(m_memfile_name_sync);
+      m_memfile_name = memfile_name_;
+    }
+    if (memfile_event_.compare(0, memfile_name_.size(), memfile_name_) == 0)
+    {
+      m_memfile_event_suffix = memfile_event_.substr(memfile_name_.size());
+    }
+
     m_created = true;
 
 #ifndef NDEBUG
@@ -83,8 +98,11 @@ namespace eCAL
     m_memfile.Destroy(false);
 
     // close memory file events
-    gCloseEvent(m_event_snd);
-    gCloseEvent(m_event_ack);
+    {
+      const std::lock_guard<std::mutex> lock(m_event_sync);
+      gCloseEvent(m_event_snd);
+      gCloseEvent(m_event_ack);
+    }
 
     m_created = false;
 
@@ -108,7 +126,7 @@ namespace eCAL
     m_is_observing = true;
 
     // start observer thread
-    m_thread = std::thread(&CMemFileObserver::Observe, this, timeout_);
+    m_thread = Threading::CreateThread(Threading::eThreadClass::shm, [this, timeout_]() { Observe(timeout_); });
 
 #ifndef NDEBUG
     // log it
@@ -129,6 +147,7 @@ namespace eCAL
       m_do_stop = true;
 
       // set sync event to unlock loop
+      const std::lock_guard<std::mutex> lock(m_event_sync);
       gSetEvent(m_event_snd);
     }
 
@@ -147,6 +166,12 @@ namespace eCAL
     return true;
   }
 
+  std::string CMemFileObserver::GetMemFileName()
+  {
+    const std::lock_guard<std::mutex> lock(m_memfile_name_sync);
+    return m_memfile_name;
+  }
+
   void CMemFileObserver::Observe(const int timeout_)
   {
     // internal clock sample update checking
@@ -191,8 +216,21 @@ namespace eCAL
           SMemFileHeader mfile_hdr;
           ReadFileHeader(mfile_hdr);
 
+          // the publisher replaced the memory file (i.e. to grow it)
+          if (mfile_hdr.options.successor != 0)
+          {
+            std::string successor_name(static_cast<size_t>(mfile_hdr.data_size), '\0');
+            const bool successor_read = m_memfile.Read(&successor_name[0], successor_name.size(), mfile_hdr.hdr_size) == successor_name.size();
+            m_memfile.ReleaseReadAccess();
+
+            // switch to the successor, if that fails we are waiting for the registration layer to tell us
+            if (!successor_read || !FollowSuccessor(successor_name)) break;
+
+            // the successor may contain a sample already, that has been signaled before we opened its events
+            has_unprocessed_data = true;
+          }
           // check for new content
-          if (mfile_hdr.clock <= last_sample_clock)
+          else if (mfile_hdr.clock <= last_sample_clock)
           {
             // release access and leave
             m_memfile.ReleaseReadAccess();
@@ -293,6 +331,39 @@ namespace eCAL
     m_is_observing = false; //-V1020
   }
 
+  bool CMemFileObserver::FollowSuccessor(const std::string& successor_name_)
+  {
+    if (successor_name_.empty() || m_memfile_event_suffix.empty()) return false;
+
+    // close the predecessor (access only)
+    m_memfile.Destroy(false);
+
+    // and switch the events
+    {
+      const std::lock_guard<std::mutex> lock(m_event_sync);
+      gCloseEvent(m_event_snd);
+      gCloseEvent(m_event_ack);
+
+      const std::string memfile_event = successor_name_ + m_memfile_event_suffix;
+      gOpenNamedEvent(&m_event_snd, memfile_event, false);
+      gOpenNamedEvent(&m_event_ack, memfile_event + "_ack", false);
+    }
+
+    // open the successor
+    if (!m_memfile.Create(successor_name_.c_str(), false)) return false;
+
+    {
+      const std::lock_guard<std::mutex> lock(m_memfile_name_sync);
+      m_memfile_name = successor_name_;
+    }
+
+#ifndef NDEBUG
+    Logging::Log(Logging::log_level_debug2, std::string("CMemFileObserver followed successor ") + successor_name_);
+#endif
+
+    return true;
+  }
+
   bool CMemFileObserver::ReadFileHeader(SMemFileHeader& mfile_hdr_)
   {
     // retrieve size of received buffer
@@ -336,7 +407,7 @@ namespace eCAL
 
     // start cleanup thread
     m_do_cleanup = true;
-    m_cleanup_thread = std::thread(&CMemFileThreadPool::CleanupPoolThread, this);
+    m_cleanup_thread = Threading::CreateThread(Threading::eThreadClass::shm, [this]() { CleanupPoolThread(); });
 
     m_created = true;
   }
@@ -378,6 +449,15 @@ namespace eCAL
     // there are no incoming data but the registration layer
     // confirms that there are still existing (sleepy) shm writer on this host
     auto observer_it = m_observer_pool.find(memfile_name_);
+
+    // the observer may have followed a successor memory file already, before
+    // the registration layer told us about the new file name
+    if (observer_it == m_observer_pool.end())
+    {
+      observer_it = std::find_if(m_observer_pool.begin(), m_observer_pool.end(),
+        [&memfile_name_](const std::pair<const std::string, std::shared_ptr<CMemFileObserver>>& observer_) { return observer_.second->GetMemFileName() == memfile_name_; });
+    }
+
     if(observer_it != m_observer_pool.end())
     {
       auto& observer = observer_it->second;
@@ -67,9 +67,12 @@ namespace eCAL
 
     bool ResetTimeout();
 
+    std::string GetMemFileName();
+
   protected:
     void Observe(int timeout_);
     bool ReadFileHeader(SMemFileHeader& memfile_hdr);
+    bool FollowSuccessor(const std::string& successor_name_);
 
     std::atomic<bool>       m_created;
     std::atomic<bool>       m_do_stop;
@@ -80,9 +83,14 @@ namespace eCAL
     MemFileDataCallbackT    m_data_callback;
 
     std::thread             m_thread;
+    std::mutex              m_event_sync;
     EventHandleT            m_event_snd;
     EventHandleT            m_event_ack;
     CMemoryFile             m_memfile;
+
+    std::mutex              m_memfile_name_sync;
+    std::string             m_memfile_name;
+    std::string             m_memfile_event_suffix;
   };
 
   ////////////////////////////////////////
@@ -22,12 +22,14 @@
 **/
 
 #include <ecal/log.h>
+#include <ecal/process.h>
 
 #include "ecal_event.h"
 #include "ecal_memfile_header.h"
 #include "ecal_memfile_naming.h"
 #include "ecal_memfile_sync.h"
 
+#include <algorithm>
 #include <chrono>
 #include <mutex>
 #include <sstream>
@@ -38,7 +40,8 @@ namespace eCAL
 {
   CSyncMemoryFile::CSyncMemoryFile(const std::string& base_name_, size_t size_, SSyncMemoryFileAttr attr_) :
     m_attr(attr_),
-    m_created(false)
+    m_created(false),
+    m_last_reserve(0)
   {
     Create(base_name_, size_);
   }
@@ -127,16 +130,16 @@ namespace eCAL
     if (!m_created) return false;
 
     // we recreate a memory file if the file size is too small
-    const bool file_to_small = m_memfile.MaxDataSize() < (sizeof(SMemFileHeader) + size_);
+    const bool file_to_small = m_memfile->MaxDataSize() < (sizeof(SMemFileHeader) + size_);
     if (file_to_small)
     {
 #ifndef NDEBUG
       Logging::Log(Logging::log_level_debug4, m_base_name + "::CSyncMemoryFile::CheckSize - RECREATE");
 #endif
       // estimate size of memory file
-      const size_t memfile_size = sizeof(SMemFileHeader) + size_ + static_cast<size_t>((static_cast<float>(m_attr.reserve) / 100.0f) * static_cast<float>(size_));
+      const size_t memfile_size = sizeof(SMemFileHeader) + size_ + EstimateReserve(size_);
 
-      // recreate the file
+      // recreate the file, connected readers are forwarded to the new one
       if (!Recreate(memfile_size)) return false;
 
       // return true to trigger registration and immediately inform listening subscribers
@@ -146,6 +149,37 @@ namespace eCAL
     return false;
   }
 
+  /*
+  * Estimates the reserve to add to the payload size when the memory file has to grow.
+  *
+  * The configured reserve is used as lower bound. If the payload keeps growing, we expect
+  * it to grow by at least the same step again, and if the file has to grow again shortly
+  * after the last growth, the reserve is doubled (up to the payload size itself).
+  * So continuously growing payloads end up in a logarithmic number of recreations.
+  */
+  size_t CSyncMemoryFile::EstimateReserve(size_t size_)
+  {
+    // configured reserve
+    size_t reserve = static_cast<size_t>((static_cast<float>(m_attr.reserve) / 100.0f) * static_cast<float>(size_));
+
+    // last growth step
+    const size_t max_data_size = m_memfile->MaxDataSize();
+    const size_t capacity      = (max_data_size > sizeof(SMemFileHeader)) ? max_data_size - sizeof(SMemFileHeader) : 0;
+    if (size_ > capacity) reserve = std::max(reserve, size_ - capacity);
+
+    // fast consecutive growth
+    const auto now = std::chrono::steady_clock::now();
+    if (now - m_last_growth_time < std::chrono::seconds(1))
+    {
+      reserve = std::max(reserve, std::min(2 * m_last_reserve, size_));
+    }
+
+    m_last_reserve     = reserve;
+    m_last_growth_time = now;
+
+    return reserve;
+  }
+
   bool CSyncMemoryFile::Write(CPayloadWriter& payload_, const SWriterAttr& data_, bool force_full_write_/* = false*/)
   {
     if (!m_created)
@@ -181,7 +215,7 @@ namespace eCAL
     memfile_hdr.ack_timout_ms     = static_cast<int64_t>(data_.acknowledge_timeout_ms);
 
     // acquire write access
-    bool write_access = m_memfile.GetWriteAccess(static_cast<int>(m_attr.timeout_open_ms));
+    bool write_access = m_memfile->GetWriteAccess(static_cast<int>(m_attr.timeout_open_ms));
 
     // maybe it's locked by a zombie or a crashed process
     // so we try to recreate a new one
@@ -192,10 +226,10 @@ namespace eCAL
 #endif
 
       // try to recreate the memory file
-      if (!Recreate(m_memfile.MaxDataSize())) return false;
+      if (!Recreate(m_memfile->MaxDataSize())) return false;
 
       // then try to get access again
-      write_access = m_memfile.GetWriteAccess(static_cast<int>(m_attr.timeout_open_ms));
+      write_access = m_memfile->GetWriteAccess(static_cast<int>(m_attr.timeout_open_ms));
       // still no chance ? hell .... we give up
       if (!write_access)
       {
@@ -209,18 +243,18 @@ namespace eCAL
     size_t wbytes(0);
 
     // write the user file header
-    written &= m_memfile.WriteBuffer(&memfile_hdr, memfile_hdr.hdr_size, wbytes) > 0;
+    written &= m_memfile->WriteBuffer(&memfile_hdr, memfile_hdr.hdr_size, wbytes) > 0;
     wbytes += memfile_hdr.hdr_size;
     // write the buffer
     if (data_.len > 0)
     {
-      written &= m_memfile.WritePayload(payload_, data_.len, wbytes, force_full_write_) > 0;
+      written &= m_memfile->WritePayload(payload_, data_.len, wbytes, force_full_write_) > 0;
     }
     // release write access
-    m_memfile.ReleaseWriteAccess();
+    m_memfile->ReleaseWriteAccess();
 
     // and fire the publish event for local subscriber
-    if (written) SyncContent();
+    if (written) SyncContent(data_);
 
     if (written)
     {
@@ -253,35 +287,56 @@ namespace eCAL
 
     // build unique memory file name
     m_base_name = base_name_;
-    m_memfile_name = eCAL::memfile::BuildRandomMemFileName(base_name_);
+    m_memfile_name = BuildMemFileName();
 
+    // create the memory file
+    m_memfile = CreateMemFile(m_memfile_name, size_);
+    if (!m_memfile) return false;
+
+    // it's created
+    m_created = true;
+
+    return true;
+  }
+
+  std::string CSyncMemoryFile::BuildMemFileName() const
+  {
+    // memfd files are requested from this process by the readers, so the name has to contain our process id
+    if (m_attr.memfd) return eCAL::memfile::BuildRandomMemFdFileName(m_base_name, Process::GetProcessID());
+    return eCAL::memfile::BuildRandomMemFileName(m_base_name);
+  }
+
+  std::unique_ptr<CMemoryFile> CSyncMemoryFile::CreateMemFile(const std::string& memfile_name_, size_t size_)
+  {
     // create new memory file object
     // with additional space for SMemFileHeader
     size_t memfile_size = sizeof(SMemFileHeader) + size_;
     // check for minimal size
     if (memfile_size < m_attr.min_size) memfile_size = m_attr.min_size;
 
+    SMemFileMapOptions map_options;
+    map_options.huge_pages = m_attr.huge_pages;
+    map_options.prefault   = m_attr.prefault;
+
     // create the memory file
-    if (!m_memfile.Create(m_memfile_name.c_str(), true, memfile_size))
+    auto memfile = std::make_unique<CMemoryFile>();
+    if (!memfile->Create(memfile_name_.c_str(), true, memfile_size, false, map_options))
     {
-      Logging::Log(Logging::log_level_error, std::string("CSyncMemoryFile::Create FAILED : ") + m_memfile_name);
-      return false;
+      Logging::Log(Logging::log_level_error, std::string("CSyncMemoryFile::Create FAILED : ") + memfile_name_);
+      return nullptr;
     }
 
 #ifndef NDEBUG
-    Logging::Log(Logging::log_level_debug2, std::string("CSyncMemoryFile::Create SUCCESS : ") + m_memfile_name);
+    Logging::Log(Logging::log_level_debug2, std::string("CSyncMemoryFile::Create SUCCESS : ") + memfile_name_);
 #endif
 
     // initialize memory file with empty header
     struct SMemFileHeader memfile_hdr;
-    m_memfile.GetWriteAccess(static_cast<int>(m_attr.timeout_open_ms));
-    m_memfile.WriteBuffer(&memfile_hdr, memfile_hdr.hdr_size, 0);
-    m_memfile.ReleaseWriteAccess();
-
-    // it's created
-    m_created = true;
+    memfile->GetWriteAccess(static_cast<int>(m_attr.timeout_open_ms));
+    memfile->WriteBuffer(&memfile_hdr, memfile_hdr.hdr_size, 0);
+    memfile->ReleaseWriteAccess();
 
-    return true;
+    return memfile;
   }
 
   bool CSyncMemoryFile::Destroy()
@@ -297,49 +352,128 @@ namespace eCAL
     // disconnect all processes
     DisconnectAll();
 
+    // destroy the predecessor of the last recreation
+    DestroyRetired();
+
     // destroy the file
-    if (!m_memfile.Destroy(true))
+    if (!m_memfile->Destroy(true))
     {
 #ifndef NDEBUG
-      Logging::Log(Logging::log_level_debug2, std::string(m_base_name + "::CSyncMemoryFile::Destroy - FAILED : ") + m_memfile.Name());
+      Logging::Log(Logging::log_level_debug2, std::string(m_base_name + "::CSyncMemoryFile::Destroy - FAILED : ") + m_memfile->Name());
 #endif
       return false;
     }
 
 #ifndef NDEBUG
-    Logging::Log(Logging::log_level_debug2, std::string(m_base_name + "::CSyncMemoryFile::Destroy - SUCCESS : ") + m_memfile.Name());
+    Logging::Log(Logging::log_level_debug2, std::string(m_base_name + "::CSyncMemoryFile::Destroy - SUCCESS : ") + m_memfile->Name());
 #endif
     return true;
   }
 
+  /*
+  * Replaces the memory file by a new one with the given size.
+  *
+  * The successor is created before the current file is given up. Its events are opened
+  * for all connected processes and a successor record is written into the current file,
+  * so observing readers switch to the new file immediately, without waiting for the
+  * registration layer. The current file stays alive until the next recreation.
+  */
   bool CSyncMemoryFile::Recreate(size_t size_)
   {
-    // collect id's of the currently connected processes
-    std::vector<std::string> process_id_list;
+    if (!m_created) return false;
+
+    // the readers had enough time to follow the last successor record
+    DestroyRetired();
+
+    // create the successor
+    const std::string successor_name = BuildMemFileName();
+    auto successor_memfile = CreateMemFile(successor_name, size_);
+    if (!successor_memfile) return false;
+
+    // open the successor events for all connected processes
+    EventHandleMapT successor_event_handle_map;
     {
       const std::lock_guard<std::mutex> lock(m_event_handle_map_sync);
       for (const auto& event_handle : m_event_handle_map)
       {
-        process_id_list.push_back(event_handle.first);
+        SEventHandlePair event_pair;
+        gOpenNamedEvent(&event_pair.event_snd, successor_name + "_" + event_handle.first, true);
+        gOpenNamedEvent(&event_pair.event_ack, successor_name + "_" + event_handle.first + "_ack", true);
+        event_pair.event_ack_is_invalid = event_handle.second.event_ack_is_invalid;
+        successor_event_handle_map.insert(std::pair<std::string, SEventHandlePair>(event_handle.first, event_pair));
       }
     }
 
-    // destroy existing memory file object
-    Destroy();
+    // forward the readers of the current file
+    // (if the file is locked by a zombie, they will follow by registration)
+    WriteSuccessor(successor_name);
+
+    // switch to the successor
+    {
+      const std::lock_guard<std::mutex> lock(m_event_handle_map_sync);
+      m_retired_event_handle_map = std::move(m_event_handle_map);
+      m_event_handle_map         = std::move(successor_event_handle_map);
+      m_memfile_name             = successor_name;
+    }
+    m_retired_memfile = std::move(m_memfile);
+    m_memfile         = std::move(successor_memfile);
 
-    // create a new one
-    if (!Create(m_base_name, size_)) return false;
+    return true;
+  }
+
+  bool CSyncMemoryFile::WriteSuccessor(const std::string& successor_name_)
+  {
+    if (!m_memfile->GetWriteAccess(static_cast<int>(m_attr.timeout_open_ms))) return false;
 
-    // reconnect processes
-    for (const auto& process_id : process_id_list)
+    // the successor record has a zero clock, so readers not knowing
+    // the successor flag skip it like an outdated sample
+    struct SMemFileHeader memfile_hdr;
+    memfile_hdr.data_size         = static_cast<uint64_t>(successor_name_.size());
+    memfile_hdr.options.successor = 1;
+
+    bool written(true);
+    written &= m_memfile->WriteBuffer(&memfile_hdr, memfile_hdr.hdr_size, 0) > 0;
+    written &= m_memfile->WriteBuffer(successor_name_.data(), successor_name_.size(), memfile_hdr.hdr_size) > 0;
+    m_memfile->ReleaseWriteAccess();
+
+    if (!written) return false;
+
+    // wake up the readers, no acknowledge needed
+    const std::lock_guard<std::mutex> lock(m_event_handle_map_sync);
+    for (const auto& event_handle : m_event_handle_map)
     {
-      Connect(process_id);
+      gSetEvent(event_handle.second.event_snd);
     }
 
+#ifndef NDEBUG
+    Logging::Log(Logging::log_level_debug2, m_base_name + "::CSyncMemoryFile::WriteSuccessor - " + m_memfile_name + " -> " + successor_name_);
+#endif
+
     return true;
   }
 
-  void CSyncMemoryFile::SyncContent()
+  void CSyncMemoryFile::DestroyRetired()
+  {
+    {
+      const std::lock_guard<std::mutex> lock(m_event_handle_map_sync);
+      for (auto& event_handle : m_retired_event_handle_map)
+      {
+        gCloseEvent(event_handle.second.event_snd);
+        gCloseEvent(event_handle.second.event_ack);
+        gInvalidateEvent(&event_handle.second.event_snd);
+        gInvalidateEvent(&event_handle.second.event_ack);
+      }
+      m_retired_event_handle_map.clear();
+    }
+
+    if (m_retired_memfile)
+    {
+      m_retired_memfile->Destroy(true);
+      m_retired_memfile.reset();
+    }
+  }
+
+  void CSyncMemoryFile::SyncContent(const SWriterAttr& data_)
   {
     if (!m_created) return;
 
@@ -355,6 +489,15 @@ namespace eCAL
       event_handle_map_snapshot = m_event_handle_map;
     }
 
+    // processes that do not need this sample are neither signaled nor awaited
+    if (data_.skip_processes != nullptr)
+    {
+      for (const auto& process_id : *data_.skip_processes)
+      {
+        event_handle_map_snapshot.erase(process_id);
+      }
+    }
+
     // "eat" old acknowledge events :)
     if (m_attr.timeout_ack_ms != 0)
     {
@@ -31,6 +31,8 @@
 #include "ecal_eventhandle.h"
 #include "ecal_memfile.h"
 
+#include <chrono>
+#include <memory>
 #include <mutex>
 #include <string>
 #include <unordered_map>
@@ -40,9 +42,12 @@ namespace eCAL
   struct SSyncMemoryFileAttr
   {
     size_t  min_size;           //!< memory file minimum size [Bytes]
-    size_t  reserve;            //!< dynamic file size reserve before recreating memory file if payload size changes [%]
+    size_t  reserve;            //!< minimal dynamic file size reserve before recreating memory file if payload size changes [%]
     int64_t timeout_open_ms;    //!< timeout to open a memory file using mutex lock [ms]
     int64_t timeout_ack_ms;     //!< timeout for memory read acknowledge signal from data reader [ms]
+    bool    memfd;              //!< create anonymous memory files and pass them to the readers by unix socket (linux only)
+    bool    huge_pages;         //!< back large memory files by transparent huge pages if available (linux only)
+    bool    prefault;           //!< populate memory files on creation, so the first write does not page fault (linux only)
   };
 
   class CSyncMemoryFile
@@ -66,14 +71,24 @@ namespace eCAL
     bool Destroy();
     bool Recreate(size_t size_);
 
-    void SyncContent();
+    std::string BuildMemFileName() const;
+    std::unique_ptr<CMemoryFile> CreateMemFile(const std::string& memfile_name_, size_t size_);
+    size_t EstimateReserve(size_t size_);
+    bool   WriteSuccessor(const std::string& successor_name_);
+    void   DestroyRetired();
+
+    void SyncContent(const SWriterAttr& data_);
     void DisconnectAll();
 
-    std::string         m_base_name;
-    std::string         m_memfile_name;
-    CMemoryFile         m_memfile;
-    SSyncMemoryFileAttr m_attr;
-    bool                m_created;
+    std::string                  m_base_name;
+    std::string                  m_memfile_name;
+    std::unique_ptr<CMemoryFile> m_memfile;
+    SSyncMemoryFileAttr          m_attr;
+    bool                         m_created;
+
+    // capacity prediction
+    size_t                                m_last_reserve;
+    std::chrono::steady_clock::time_point m_last_growth_time;
 
     struct SEventHandlePair
     {
@@ -84,5 +99,10 @@ namespace eCAL
     using EventHandleMapT = std::unordered_map<std::string, SEventHandlePair>;
     std::mutex       m_event_handle_map_sync;
     EventHandleMapT  m_event_handle_map;
+
+    // predecessor memory file and its events, kept alive until the next
+    // recreation, so late readers can still follow the successor record
+    std::unique_ptr<CMemoryFile> m_retired_memfile;
+    EventHandleMapT              m_retired_event_handle_map;
   };
 }
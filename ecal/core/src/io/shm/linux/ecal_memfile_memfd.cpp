@@ -0,0 +1,323 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  memfd memory files, passed between processes via unix domain sockets
+**/
+
+#include "ecal_memfile_memfd.h"
+#include "util/ecal_thread_factory.h"
+
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+// memfd_create and fd passing are linux specific, other posix systems are using named memory files only
+#if defined(__linux__)
+
+namespace
+{
+  // abstract socket address (no file system entry, released by the kernel with the process)
+  std::string BuildSocketAddress(int process_id_)
+  {
+    return std::string(1, '\0') + "ecal_memfd_" + std::to_string(process_id_);
+  }
+
+  socklen_t FillSocketAddress(const std::string& address_, sockaddr_un& sock_addr_)
+  {
+    std::memset(&sock_addr_, 0, sizeof(sock_addr_));
+    sock_addr_.sun_family = AF_UNIX;
+    std::memcpy(sock_addr_.sun_path, address_.data(), address_.size());
+    return static_cast<socklen_t>(offsetof(sockaddr_un, sun_path) + address_.size());
+  }
+
+  void SetSocketTimeout(int socket_, int timeout_ms_)
+  {
+    timeval timeout{};
+    timeout.tv_sec  = timeout_ms_ / 1000;
+    timeout.tv_usec = (timeout_ms_ % 1000) * 1000;
+    ::setsockopt(socket_, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    ::setsockopt(socket_, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+  }
+
+  const int request_timeout_ms = 100;
+
+  ////////////////////////////////////////
+  // CMemFdServer
+  ////////////////////////////////////////
+  // Hands out the file descriptors of the memfd files created by this process
+  // to local processes requesting them by name.
+  class CMemFdServer
+  {
+  public:
+    static CMemFdServer& Instance()
+    {
+      static CMemFdServer server;
+      return server;
+    }
+
+    CMemFdServer(const CMemFdServer&) = delete;
+    CMemFdServer& operator=(const CMemFdServer&) = delete;
+
+    bool Register(const std::string& name_, int fd_)
+    {
+      const std::lock_guard<std::mutex> lock(m_sync);
+      if (!Start()) return false;
+
+      const int fd = ::fcntl(fd_, F_DUPFD_CLOEXEC, 0);
+      if (fd == -1) return false;
+
+      auto iter = m_files.find(name_);
+      if (iter != m_files.end()) ::close(iter->second);
+      m_files[name_] = fd;
+      return true;
+    }
+
+    void Unregister(const std::string& name_)
+    {
+      const std::lock_guard<std::mutex> lock(m_sync);
+      auto iter = m_files.find(name_);
+      if (iter == m_files.end()) return;
+
+      ::close(iter->second);
+      m_files.erase(iter);
+    }
+
+  private:
+    CMemFdServer() = default;
+
+    ~CMemFdServer()
+    {
+      if (m_socket != -1)
+      {
+        // unblocks accept
+        ::shutdown(m_socket, SHUT_RDWR);
+        if (m_thread.joinable()) m_thread.join();
+        ::close(m_socket);
+      }
+      for (const auto& file : m_files) ::close(file.second);
+    }
+
+    bool Start()
+    {
+      if (m_socket != -1) return true;
+
+      const int sock = ::socket(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0);
+      if (sock == -1)
+      {
+        std::cerr << "socket failed (memfile::memfd): errno: " << strerror(errno) << std::endl;
+        return false;
+      }
+
+      sockaddr_un sock_addr{};
+      const socklen_t sock_addr_len = FillSocketAddress(BuildSocketAddress(static_cast<int>(::getpid())), sock_addr);
+      if ((::bind(sock, reinterpret_cast<sockaddr*>(&sock_addr), sock_addr_len) != 0) || (::listen(sock, SOMAXCONN) != 0))
+      {
+        std::cerr << "bind / listen failed (memfile::memfd): errno: " << strerror(errno) << std::endl;
+        ::close(sock);
+        return false;
+      }
+
+      m_socket = sock;
+      m_thread = eCAL::Threading::CreateThread(eCAL::Threading::eThreadClass::shm, [this]() { Serve(); });
+      return true;
+    }
+
+    void Serve()
+    {
+      for (;;)
+      {
+        const int conn = ::accept4(m_socket, nullptr, nullptr, SOCK_CLOEXEC);
+        if (conn == -1)
+        {
+          if (errno == EINTR || errno == ECONNABORTED) continue;
+          // socket has been shut down
+          break;
+        }
+
+        SetSocketTimeout(conn, request_timeout_ms);
+        HandleRequest(conn);
+        ::close(conn);
+      }
+    }
+
+    void HandleRequest(int conn_)
+    {
+      // request: memory file name
+      std::array<char, 256> request{};
+      const ssize_t request_len = ::recv(conn_, request.data(), request.size(), 0);
+      if (request_len <= 0) return;
+      const std::string name(request.data(), static_cast<size_t>(request_len));
+
+      // response: one status byte, the fd is attached as ancillary data
+      char status(0);
+      iovec iov{};
+      iov.iov_base = &status;
+      iov.iov_len  = sizeof(status);
+
+      msghdr msg{};
+      msg.msg_iov    = &iov;
+      msg.msg_iovlen = 1;
+
+      alignas(cmsghdr) char control[CMSG_SPACE(sizeof(int))] = {};
+
+      const std::lock_guard<std::mutex> lock(m_sync);
+      auto iter = m_files.find(name);
+      if (iter != m_files.end())
+      {
+        status = 1;
+        msg.msg_control    = control;
+        msg.msg_controllen = sizeof(control);
+
+        cmsghdr* cmsg   = CMSG_FIRSTHDR(&msg);
+        cmsg->cmsg_level = SOL_SOCKET;
+        cmsg->cmsg_type  = SCM_RIGHTS;
+        cmsg->cmsg_len   = CMSG_LEN(sizeof(int));
+        std::memcpy(CMSG_DATA(cmsg), &iter->second, sizeof(int));
+      }
+
+      ::sendmsg(conn_, &msg, MSG_NOSIGNAL);
+    }
+
+    std::mutex                 m_sync;
+    std::map<std::string, int> m_files;
+    int                        m_socket = -1;
+    std::thread                m_thread;
+  };
+}
+
+namespace eCAL
+{
+  namespace memfile
+  {
+    namespace memfd
+    {
+      int CreateFile(const std::string& name_)
+      {
+#ifdef MFD_CLOEXEC
+        const int fd = ::memfd_create(name_.c_str(), MFD_CLOEXEC | MFD_ALLOW_SEALING);
+        if (fd == -1)
+        {
+          std::cerr << "memfd_create failed (memfile::memfd::CreateFile): " << name_ << " errno: " << strerror(errno) << std::endl;
+        }
+        return fd;
+#else
+        std::cerr << "memfd_create not supported (memfile::memfd::CreateFile): " << name_ << std::endl;
+        return -1;
+#endif
+      }
+
+      bool RegisterFile(const std::string& name_, int fd_)
+      {
+        return CMemFdServer::Instance().Register(name_, fd_);
+      }
+
+      void UnregisterFile(const std::string& name_)
+      {
+        CMemFdServer::Instance().Unregister(name_);
+      }
+
+      int RequestFile(const std::string& name_, int process_id_)
+      {
+        const int sock = ::socket(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0);
+        if (sock == -1) return -1;
+        SetSocketTimeout(sock, request_timeout_ms);
+
+        int fd(-1);
+
+        sockaddr_un sock_addr{};
+        const socklen_t sock_addr_len = FillSocketAddress(BuildSocketAddress(process_id_), sock_addr);
+        if ((::connect(sock, reinterpret_cast<sockaddr*>(&sock_addr), sock_addr_len) == 0)
+          && (::send(sock, name_.data(), name_.size(), MSG_NOSIGNAL) == static_cast<ssize_t>(name_.size())))
+        {
+          char status(0);
+          iovec iov{};
+          iov.iov_base = &status;
+          iov.iov_len  = sizeof(status);
+
+          alignas(cmsghdr) char control[CMSG_SPACE(sizeof(int))] = {};
+          msghdr msg{};
+          msg.msg_iov        = &iov;
+          msg.msg_iovlen     = 1;
+          msg.msg_control    = control;
+          msg.msg_controllen = sizeof(control);
+
+          if ((::recvmsg(sock, &msg, MSG_CMSG_CLOEXEC) > 0) && (status != 0))
+          {
+            const cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+            if ((cmsg != nullptr) && (cmsg->cmsg_level == SOL_SOCKET) && (cmsg->cmsg_type == SCM_RIGHTS))
+            {
+              std::memcpy(&fd, CMSG_DATA(cmsg), sizeof(int));
+            }
+          }
+        }
+
+        ::close(sock);
+        return fd;
+      }
+
+      bool SealFile(int fd_)
+      {
+#ifdef F_ADD_SEALS
+        return ::fcntl(fd_, F_ADD_SEALS, F_SEAL_SHRINK) == 0;
+#else
+        (void)fd_;
+        return false;
+#endif
+      }
+    }
+  }
+}
+
+#else /* __linux__ */
+
+namespace eCAL
+{
+  namespace memfile
+  {
+    namespace memfd
+    {
+      int CreateFile(const std::string& name_)
+      {
+        std::cerr << "memfd not supported on this platform (memfile::memfd::CreateFile): " << name_ << std::endl;
+        return -1;
+      }
+
+      bool RegisterFile(const std::string& /*name_*/, int /*fd_*/) { return false; }
+      void UnregisterFile(const std::string& /*name_*/) {}
+      int  RequestFile(const std::string& /*name_*/, int /*process_id_*/) { return -1; }
+      bool SealFile(int /*fd_*/) { return false; }
+    }
+  }
+}
+
+#endif /* __linux__ */
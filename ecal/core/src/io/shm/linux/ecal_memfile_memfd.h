@@ -0,0 +1,67 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  memfd memory files, passed between processes via unix domain sockets
+**/
+
+#pragma once
+
+#include <string>
+
+namespace eCAL
+{
+  namespace memfile
+  {
+    namespace memfd
+    {
+      /**
+       * @brief Create an anonymous memory file.
+       *
+       * @return  The file descriptor or -1 if it fails.
+      **/
+      int CreateFile(const std::string& name_);
+
+      /**
+       * @brief Serve the file descriptor to local processes requesting it by name.
+       *        The fd is duplicated, so the caller keeps ownership of fd_.
+      **/
+      bool RegisterFile(const std::string& name_, int fd_);
+
+      /**
+       * @brief Stop serving the file descriptor. The memory is released by the
+       *        system when the last process closed / unmapped the file.
+      **/
+      void UnregisterFile(const std::string& name_);
+
+      /**
+       * @brief Request the file descriptor of a memory file from the creating process.
+       *
+       * @return  The file descriptor or -1 if it fails.
+      **/
+      int RequestFile(const std::string& name_, int process_id_);
+
+      /**
+       * @brief Prevent the file from being shrunk by other processes,
+       *        so mapping processes can not run into SIGBUS.
+      **/
+      bool SealFile(int fd_);
+    }
+  }
+}
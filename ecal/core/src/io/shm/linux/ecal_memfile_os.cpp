@@ -22,12 +22,15 @@
 **/
 
 #include "io/shm/ecal_memfile.h"
+#include "io/shm/ecal_memfile_naming.h"
+#include "io/shm/linux/ecal_memfile_memfd.h"
 
 #include <iostream>
 #include <string.h>
 
 #include <errno.h>
 #include <fcntl.h>
+#include <fstream>
 #include <string>
 #include <sys/mman.h>
 #include <sys/stat.h>
@@ -41,8 +44,81 @@ namespace eCAL
     namespace os
     {
 
+      namespace
+      {
+        size_t HugePageSize()
+        {
+          static const size_t huge_page_size = []() -> size_t
+          {
+            size_t size(0);
+            std::ifstream hpage_pmd_size("/sys/kernel/mm/transparent_hugepage/hpage_pmd_size");
+            if (!(hpage_pmd_size >> size) || (size == 0)) size = 2 * 1024 * 1024;
+            return size;
+          }();
+          return huge_page_size;
+        }
+
+        // touch every page for writing, so the first write of the publisher does not page fault
+        void PrefaultMapping(void* address_, size_t size_)
+        {
+#ifdef MADV_POPULATE_WRITE
+          if (::madvise(address_, size_, MADV_POPULATE_WRITE) == 0) return;
+#endif
+          const size_t page_size = static_cast<size_t>(sysconf(_SC_PAGE_SIZE));
+          volatile char* const mem = static_cast<volatile char*>(address_);
+          for (size_t offset = 0; offset < size_; offset += page_size)
+          {
+            mem[offset] = mem[offset];
+          }
+        }
+      }
+
+      // anonymous memory files, created by memfd_create and requested from the creating process by name
+      bool AllocMemFdFile(const std::string& name_, const bool create_, const int process_id_, SMemFileInfo& mem_file_info_)
+      {
+        mem_file_info_.name  = name_;
+        mem_file_info_.memfd = true;
+
+        int fd(-1);
+        if (create_)
+        {
+          fd = memfd::CreateFile(name_);
+          if ((fd != -1) && !memfd::RegisterFile(name_, fd))
+          {
+            ::close(fd);
+            fd = -1;
+          }
+        }
+        else
+        {
+          fd = memfd::RequestFile(name_, process_id_);
+          mem_file_info_.exists = true;
+        }
+
+        if (fd == -1)
+        {
+          std::cerr << "memfd failed to " << (create_ ? "CREATE" : "OPEN") << " memory file (memfile::os::AllocFile): " << name_ << std::endl;
+          mem_file_info_.memfile = 0;
+          mem_file_info_.name    = "";
+          mem_file_info_.exists  = false;
+          mem_file_info_.memfd   = false;
+          return(false);
+        }
+
+        mem_file_info_.memfile = fd;
+        mem_file_info_.size    = 0;
+
+        return(true);
+      }
+
       bool AllocFile(const std::string& name_, const bool create_, SMemFileInfo& mem_file_info_)
       {
+        int memfd_process_id(0);
+        if (ParseMemFdFileName(name_, memfd_process_id))
+        {
+          return AllocMemFdFile(name_, create_, memfd_process_id, mem_file_info_);
+        }
+
         int previous_umask = umask(000);  // set umask to nothing, so we can create files with all possible permission bits
         mem_file_info_.name = name_.size() ? ((name_[0] != '/') ? "/" + name_ : name_) : name_; // make memory file path compatible for all posix systems
         if(create_)
@@ -90,12 +166,20 @@ namespace eCAL
 
         mem_file_info_.name = "";
         mem_file_info_.size = 0;
+        mem_file_info_.memfd = false;
 
         return(true);
       }
 
       bool RemoveFile(const SMemFileInfo& mem_file_info_)
       {
+        if (mem_file_info_.memfd)
+        {
+          // no more processes will get the file, the memory is released with the last mapping
+          memfd::UnregisterFile(mem_file_info_.name);
+          return(true);
+        }
+
         ::shm_unlink(mem_file_info_.name.c_str());
         return(true);
       }
@@ -111,19 +195,40 @@ namespace eCAL
             {
               std::cerr << "ftruncate failed (memfile::os::MapFile): " << mem_file_info_.name << " errno: " << strerror(errno) << std::endl;
             }
+
+            // readers can not shrink a memfd file below the mapped size
+            if (mem_file_info_.memfd) memfd::SealFile(mem_file_info_.memfile);
           }
 
           // get address
           int         prot = PROT_READ;
           if (create_) prot |= PROT_WRITE;
 
-          mem_file_info_.mem_address = ::mmap(nullptr, mem_file_info_.size, prot, MAP_SHARED, mem_file_info_.memfile, 0);
+          // the huge page advice has to be given before the pages are faulted in
+          const bool huge_pages = create_ && mem_file_info_.map_options.huge_pages;
+          const bool prefault   = create_ && mem_file_info_.map_options.prefault;
+
+          int flags = MAP_SHARED;
+#ifdef MAP_POPULATE
+          if (prefault && !huge_pages) flags |= MAP_POPULATE;
+#endif
+
+          mem_file_info_.mem_address = ::mmap(nullptr, mem_file_info_.size, prot, flags, mem_file_info_.memfile, 0);
           if (mem_file_info_.mem_address == MAP_FAILED)
           {
             mem_file_info_.mem_address = nullptr;
             std::cerr << "mmap failed (memfile::os::MapFile): " << mem_file_info_.name << " errno: " << strerror(errno) << std::endl;
             return(false);
           }
+
+          if (huge_pages)
+          {
+#ifdef MADV_HUGEPAGE
+            // just an advice, if shmem huge pages are disabled the system keeps using normal pages
+            ::madvise(mem_file_info_.mem_address, mem_file_info_.size, MADV_HUGEPAGE);
+#endif
+            if (prefault) PrefaultMapping(mem_file_info_.mem_address, mem_file_info_.size);
+          }
         }
 
         return(true);
@@ -151,6 +256,13 @@ namespace eCAL
           len = sysconf(_SC_PAGE_SIZE);
         }
 
+        // files larger than a huge page are rounded up to full huge pages,
+        // otherwise the tail of the file would be backed by normal pages
+        if (create_ && mem_file_info_.map_options.huge_pages && (len >= HugePageSize()))
+        {
+          len = ((len + HugePageSize() - 1) / HugePageSize()) * HugePageSize();
+        }
+
         if (mem_file_info_.mem_address == nullptr)
         {
           // set file size
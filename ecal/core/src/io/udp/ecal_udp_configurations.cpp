@@ -148,6 +148,13 @@ namespace eCAL
       // v2
       else
       {
+        // a topic group pool maps every topic to one of the groups following the base group
+        const unsigned int pool_size = eCAL::GetConfiguration().transport_layer.udp.topic_group_pool_size;
+        if (pool_size > 0)
+        {
+          return UDP::V2::topic2mcast_pool(topic_name, Config::GetUdpMulticastGroup(), pool_size);
+        }
+
         // retrieve the corresponding multicast address based on the topic name using v2 implementation
         return  UDP::V2::topic2mcast(topic_name, Config::GetUdpMulticastGroup(), Config::GetUdpMulticastMask());
       }
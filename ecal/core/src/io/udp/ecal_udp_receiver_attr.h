@@ -37,6 +37,7 @@ namespace eCAL
       bool        broadcast = false;
       bool        loopback  = true;
       int         rcvbuf    = 1024 * 1024;
+      bool        joined_groups_only = false;  // receive datagrams of the groups joined by this socket only (linux only)
     };
 
     using HasSampleCallbackT   = std::function<bool(const std::string& sample_name_)>;
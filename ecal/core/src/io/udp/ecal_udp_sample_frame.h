@@ -0,0 +1,83 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  UDP sample frame, multiple serialized samples packed into one datagram
+ *
+ * A frame is sent as a regular sample with command type bct_set_sample_frame under
+ * the reserved sample name SampleFrameName. Its raw payload is a sequence of entries
+ *
+ *  4 Bytes size of the serialized sample (uint32_t, little endian)
+ *  n Bytes serialized sample (cmd_type bct_set_sample)
+**/
+
+#pragma once
+
+#include <ecal_utils/portable_endian.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace eCAL
+{
+  namespace UDP
+  {
+    // '#' is not part of valid topic names, so no topic can shadow the frame
+    constexpr const char* SampleFrameName = "#ecal_sample_frame#";
+
+    constexpr size_t SampleFrameEntryHeaderSize = sizeof(uint32_t);
+
+    inline void AppendToSampleFrame(std::vector<char>& frame_, const char* serialized_sample_data_, size_t serialized_sample_size_)
+    {
+      const uint32_t entry_size = htole32(static_cast<uint32_t>(serialized_sample_size_));
+      const size_t   offset     = frame_.size();
+      frame_.resize(offset + SampleFrameEntryHeaderSize + serialized_sample_size_);
+      std::memcpy(frame_.data() + offset, &entry_size, SampleFrameEntryHeaderSize);
+      std::memcpy(frame_.data() + offset + SampleFrameEntryHeaderSize, serialized_sample_data_, serialized_sample_size_);
+    }
+
+    /**
+     * @brief Call apply_(data, size) for every serialized sample of a frame payload.
+     *
+     * @return False if the frame is truncated, the entries before are applied anyway.
+    **/
+    template <typename ApplyT>
+    bool ForEachInSampleFrame(const char* frame_data_, size_t frame_size_, ApplyT&& apply_)
+    {
+      size_t offset = 0;
+      while (offset < frame_size_)
+      {
+        if (frame_size_ - offset < SampleFrameEntryHeaderSize) return false;
+
+        uint32_t entry_size = 0;
+        std::memcpy(&entry_size, frame_data_ + offset, SampleFrameEntryHeaderSize);
+        entry_size = le32toh(entry_size);
+        offset += SampleFrameEntryHeaderSize;
+
+        if (frame_size_ - offset < entry_size) return false;
+
+        apply_(frame_data_ + offset, static_cast<size_t>(entry_size));
+        offset += entry_size;
+      }
+      return true;
+    }
+  }
+}
@@ -23,12 +23,15 @@
 
 #include "ecal_udp_sample_receiver_asio.h"
 #include "io/udp/ecal_udp_configurations.h"
+#include "util/ecal_thread_factory.h"
 
 #ifdef __linux__
 #include "linux/socket_os.h"
 #endif
 
 #include <array>
+#include <cerrno>
+#include <cstring>
 #include <iostream>
 
 namespace eCAL
@@ -49,7 +52,7 @@ namespace eCAL
       JoinMultiCastGroup(attr_.address.c_str());
 
       // run the io context
-      m_io_thread = std::thread([this] { m_io_context->run(); });
+      m_io_thread = Threading::CreateThread(Threading::eThreadClass::udp, [this] { m_io_context->run(); });
 
       // start receiving
       Receive();
@@ -154,6 +157,19 @@ namespace eCAL
           std::cerr << "CSampleReceiverAsio: Unable to set receive buffer size: " << ec.message() << '\n';
         }
       }
+#ifdef __linux__
+      // by default linux delivers the datagrams of all multicast groups joined by any socket on this port,
+      // so they would be reassembled before they can be rejected by their sample name
+      if (attr_.joined_groups_only)
+      {
+        const int multicast_all = 0;
+        if (setsockopt(m_socket->native_handle(), IPPROTO_IP, IP_MULTICAST_ALL, &multicast_all, sizeof(multicast_all)) != 0)
+        {
+          std::cerr << "CSampleReceiverAsio: Unable to disable IP_MULTICAST_ALL: " << strerror(errno) << '\n';
+        }
+      }
+#endif
+
       // bind socket
       {
         asio::error_code ec;
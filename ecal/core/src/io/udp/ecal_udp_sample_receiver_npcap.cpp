@@ -23,6 +23,7 @@
 
 #include "ecal_udp_sample_receiver_npcap.h"
 #include "io/udp/ecal_udp_configurations.h"
+#include "util/ecal_thread_factory.h"
 
 #include <array>
 #include <iostream>
@@ -45,7 +46,7 @@ namespace eCAL
       JoinMultiCastGroup(attr_.address.c_str());
 
       // run the io context
-      m_io_thread = std::thread([this] { m_io_context->run(); });
+      m_io_thread = Threading::CreateThread(Threading::eThreadClass::udp, [this] { m_io_context->run(); });
 
       // start receiving
       Receive();
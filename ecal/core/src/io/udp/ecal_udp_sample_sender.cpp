@@ -109,6 +109,11 @@ namespace eCAL
     }
 
     size_t CSampleSender::Send(const std::string& sample_name_, const std::vector<char>& serialized_sample_)
+    {
+      return Send(sample_name_, serialized_sample_.data(), serialized_sample_.size());
+    }
+
+    size_t CSampleSender::Send(const std::string& sample_name_, const char* serialized_sample_data_, size_t serialized_sample_size_)
     {
       // ------------------------------------------------
       // emulate old protocol
@@ -121,10 +126,10 @@ namespace eCAL
       // s2 Bytes serialized sample
       // ------------------------------------------------
       const unsigned short s1 = static_cast<unsigned short>(sample_name_.size()) + 1 /*'\0'*/;
-      const size_t         s2 = serialized_sample_.size();
+      const size_t         s2 = serialized_sample_size_;
       const asio::const_buffer sample_name_size_asio_buffer(&s1, 2);
       const asio::const_buffer sample_name_asio_buffer(sample_name_.c_str(), s1); // we need to use c_str() here to guarantee  trailling \'0'
-      const asio::const_buffer serialized_sample_asio_buffer(serialized_sample_.data(), s2);
+      const asio::const_buffer serialized_sample_asio_buffer(serialized_sample_data_, s2);
 
       const asio::socket_base::message_flags flags(0);
       asio::error_code ec;
@@ -41,6 +41,7 @@ namespace eCAL
       virtual ~CSampleSender();
 
       size_t Send(const std::string& sample_name_, const std::vector<char>& serialized_sample_);
+      size_t Send(const std::string& sample_name_, const char* serialized_sample_data_, size_t serialized_sample_size_);
 
     private:
       void InitializeSocket(const SSenderAttr& attr_);
@@ -129,6 +129,52 @@ namespace eCAL
         return topic2mcast_hash(hash_v, mcast_base_, mcast_mask_);
       }
 
+      /**
+       * @brief 32 bit FNV-1a hash, in contrast to fnv_hash independent of the size of size_t.
+      **/
+      inline uint32_t fnv1a_hash32(const std::string& s_)
+      {
+        uint32_t result = 2166136261U;
+        for (const char c : s_)
+        {
+          result ^= static_cast<unsigned char>(c);
+          result *= 16777619U;
+        }
+        return result;
+      }
+
+      /**
+       * @brief Get the index of the pool group of a topic.
+       *
+       * @param  tname_      The topic name.
+       * @param  pool_size_  Number of groups in the pool (> 0).
+       *
+       * @return  The group index (0 .. pool_size_ - 1).
+      **/
+      inline uint32_t topic2pool_index(const std::string& tname_, uint32_t pool_size_)
+      {
+        return fnv1a_hash32(tname_) % pool_size_;
+      }
+
+      /**
+       * @brief Get multicast address of a topic from a pool of groups following the base address.
+       *
+       * The base address itself carries registration and logging, so the pool starts right after it.
+       * The pool wraps around within the first octet of the base address and never reaches the base again.
+       *
+       * @param  tname_       The topic name.
+       * @param  mcast_base_  Multicast group base address (e.g. 239.0.0.1).
+       * @param  pool_size_   Number of groups in the pool (> 0), limited to the 2^24 - 2 groups of the first octet.
+       *
+       * @return  The multicast address (e.g. "239.0.0.42").
+      **/
+      inline std::string topic2mcast_pool(const std::string& tname_, const std::string& mcast_base_, uint32_t pool_size_)
+      {
+        constexpr uint32_t max_pool_size = 0x00FFFFFE;
+        const uint32_t address_ip = parse_ipv4(mcast_base_);
+        const uint32_t offset     = 1 + topic2pool_index(tname_, (pool_size_ < max_pool_size) ? pool_size_ : max_pool_size);
+        return serialize_ipv4((address_ip & 0xFF000000) | ((address_ip + offset) & 0x00FFFFFF));
+      }
     }
 
     namespace V1
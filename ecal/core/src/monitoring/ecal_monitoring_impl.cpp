@@ -27,6 +27,7 @@
 #include "io/udp/ecal_udp_configurations.h"
 #include "ecal_monitoring_impl.h"
 #include "ecal_global_accessors.h"
+#include "ecal_descgate.h"
 
 #include "registration/ecal_registration_provider.h"
 #include "registration/ecal_registration_receiver.h"
@@ -188,11 +189,13 @@ namespace eCAL
         }
       std::string topic_datatype_encoding = sample_topic.datatype_information.encoding;
       std::string topic_datatype_name     = sample_topic.datatype_information.name;
-      std::string topic_datatype_desc     = sample_topic.datatype_information.descriptor;
+      const std::string& topic_datatype_desc = sample_topic.datatype_information.descriptor;
+      const uint64_t     topic_datatype_hash = sample_topic.descriptor_hash;
 
       // try to get topic info
       const auto& topic_map_key  = topic_id;
-      Monitoring::STopic& TopicInfo = (*pTopicMap->map)[topic_map_key];
+      STopicEntry& TopicEntry = (*pTopicMap->map)[topic_map_key];
+      Monitoring::STopic& TopicInfo = TopicEntry.topic;
 
       // set static content
       TopicInfo.host_name            = host_name;
@@ -208,7 +211,18 @@ namespace eCAL
       TopicInfo.registration_clock++;
       TopicInfo.datatype_information.encoding   = std::move(topic_datatype_encoding);
       TopicInfo.datatype_information.name       = std::move(topic_datatype_name);
-      TopicInfo.datatype_information.descriptor = std::move(topic_datatype_desc);
+
+      // share the descriptor instead of copying it with every registration, samples that
+      // omit it keep the known one as long as the announced hash did not change
+      if (topic_datatype_desc.empty())
+      {
+        if ((topic_datatype_hash == 0) || (topic_datatype_hash != TopicEntry.descriptor_hash)) TopicEntry.descriptor = nullptr;
+      }
+      else if (!TopicEntry.descriptor || (topic_datatype_hash != TopicEntry.descriptor_hash) || ((topic_datatype_hash == 0) && (*TopicEntry.descriptor != topic_datatype_desc)))
+      {
+        TopicEntry.descriptor = (g_descgate() != nullptr) ? g_descgate()->GetDescriptorStore().Intern(topic_datatype_desc) : std::make_shared<const std::string>(topic_datatype_desc);
+      }
+      TopicEntry.descriptor_hash = topic_datatype_hash;
 
       // layer
       TopicInfo.transport_layer.clear();
@@ -535,7 +549,7 @@ namespace eCAL
       // iterate map
       for (const auto& publisher : (*m_publisher_map.map))
       {
-        monitoring_.publishers.emplace_back(publisher.second);
+        AppendTopic(publisher.second, monitoring_.publishers);
       }
     }
 
@@ -552,7 +566,7 @@ namespace eCAL
       // iterate map
       for (const auto& subscriber : (*m_subscriber_map.map))
       {
-        monitoring_.subscribers.emplace_back(subscriber.second);
+        AppendTopic(subscriber.second, monitoring_.subscribers);
       }
     }
 
@@ -640,12 +654,18 @@ namespace eCAL
     {
       if (direction_ == "publisher")
       {
-        monitoring_.publishers.push_back(topic.second);
+        AppendTopic(topic.second, monitoring_.publishers);
       }
       if (direction_ == "subscriber")
       {
-        monitoring_.subscribers.push_back(topic.second);
+        AppendTopic(topic.second, monitoring_.subscribers);
       }
     }
   }
+
+  void CMonitoringImpl::AppendTopic(const STopicEntry& topic_entry_, std::vector<Monitoring::STopic>& topics_)
+  {
+    topics_.push_back(topic_entry_.topic);
+    if (topic_entry_.descriptor) topics_.back().datatype_information.descriptor = *topic_entry_.descriptor;
+  }
 }
@@ -26,6 +26,7 @@
 #include <ecal/types/monitoring.h>
 
 #include "ecal_def.h"
+#include "ecal_descriptor_store.h"
 
 #include "serialization/ecal_serialize_sample_registration.h"
 
@@ -34,6 +35,7 @@
 #include <mutex>
 #include <set>
 #include <string>
+#include <vector>
 
 namespace eCAL
 {
@@ -73,7 +75,15 @@ namespace eCAL
     bool RegisterTopic(const Registration::Sample& sample_, enum ePubSub pubsub_type_);
     bool UnregisterTopic(const Registration::Sample& sample_, enum ePubSub pubsub_type_);
 
-    using TopicMapT = std::map<EntityIdT, Monitoring::STopic>;
+    // the datatype descriptor is shared through the descriptor store and only copied into the topic on output
+    struct STopicEntry
+    {
+      Monitoring::STopic            topic;
+      CDescriptorStore::DescriptorT descriptor;
+      uint64_t                      descriptor_hash = 0;
+    };
+
+    using TopicMapT = std::map<EntityIdT, STopicEntry>;
     struct STopicMap
     {
       explicit STopicMap() :
@@ -123,6 +133,7 @@ namespace eCAL
     void MonitorServer(Monitoring::SMonitoring& monitoring_);
     void MonitorClients(Monitoring::SMonitoring& monitoring_);
     void MonitorTopics(STopicMap& map_, Monitoring::SMonitoring& monitoring_, const std::string& direction_);
+    static void AppendTopic(const STopicEntry& topic_entry_, std::vector<Monitoring::STopic>& topics_);
 
     bool                                         m_init;
 
@@ -33,7 +33,11 @@ namespace eCAL
 
     attributes.network_enabled            = config_.communication_mode == eCAL::eCommunicationMode::network;
     attributes.loopback                   = registration_config.loopback;
+    attributes.fast_discovery             = registration_config.fast_discovery;
+    attributes.descriptor_refresh         = registration_config.descriptor_refresh;
     attributes.drop_out_of_order_messages = subscriber_config.drop_out_of_order_messages;
+    attributes.max_frequency_mhz          = subscriber_config.max_frequency_mhz;
+    attributes.downsampling               = subscriber_config.downsampling;
     attributes.registration_timeout_ms    = registration_config.registration_timeout;
     attributes.topic_name                 = topic_name_;
     attributes.host_name                  = Process::GetHostName();
@@ -46,11 +50,14 @@ namespace eCAL
     attributes.udp.broadcast     = config_.communication_mode == eCAL::eCommunicationMode::local;
     attributes.udp.port          = transport_layer_config.udp.port;
     attributes.udp.receivebuffer = transport_layer_config.udp.receive_buffer;
+    attributes.udp.joined_groups_only = false;
     
     switch (config_.communication_mode)
     {
       case eCAL::eCommunicationMode::network:
         attributes.udp.group = transport_layer_config.udp.network.group;
+        // topics are sent to their own groups, so datagrams of groups joined by other sockets can be dropped by the kernel
+        attributes.udp.joined_groups_only = (transport_layer_config.udp.config_version == Types::UdpConfigVersion::V2) && (transport_layer_config.udp.topic_group_pool_size > 0);
         break;
       case eCAL::eCommunicationMode::local:
         attributes.udp.group = transport_layer_config.udp.local.group;
@@ -21,6 +21,8 @@
 #include "ecal/process.h"
 #include "ecal/config.h"
 
+#include "io/udp/ecal_udp_topic2mcast.h"
+
 namespace eCAL
 {
   eCALWriter::SAttributes BuildWriterAttributes(const std::string& topic_name_, const eCAL::Configuration& config_)
@@ -33,6 +35,8 @@ namespace eCAL
 
     attributes.network_enabled         = config_.communication_mode == eCAL::eCommunicationMode::network;
     attributes.loopback                = registration_config.loopback;
+    attributes.fast_discovery          = registration_config.fast_discovery;
+    attributes.descriptor_refresh      = registration_config.descriptor_refresh;
 
     attributes.layer_priority_local    = publisher_config.layer_priority_local;
     attributes.layer_priority_remote   = publisher_config.layer_priority_remote;
@@ -49,18 +53,30 @@ namespace eCAL
     attributes.shm.memfile_buffer_count    = publisher_config.layer.shm.memfile_buffer_count;
     attributes.shm.memfile_min_size_bytes  = publisher_config.layer.shm.memfile_min_size_bytes;
     attributes.shm.memfile_reserve_percent = publisher_config.layer.shm.memfile_reserve_percent;
+    attributes.shm.memfile_memfd           = publisher_config.layer.shm.memfile_memfd;
+    attributes.shm.memfile_huge_pages      = publisher_config.layer.shm.memfile_huge_pages;
+    attributes.shm.memfile_prefault        = publisher_config.layer.shm.memfile_prefault;
     attributes.shm.zero_copy_mode          = publisher_config.layer.shm.zero_copy_mode;
 
     attributes.udp.enable        = publisher_config.layer.udp.enable;
     attributes.udp.broadcast     = config_.communication_mode == eCAL::eCommunicationMode::local;
     attributes.udp.port          = transport_tlayer_config.udp.port;
     attributes.udp.send_buffer   = transport_tlayer_config.udp.send_buffer;
+
+    attributes.udp.coalescing_enable       = publisher_config.layer.udp.coalescing_enable;
+    attributes.udp.coalescing_max_delay_us = publisher_config.layer.udp.coalescing_max_delay_us;
+    attributes.udp.coalescing_max_size     = publisher_config.layer.udp.coalescing_max_size;
     
     switch (config_.communication_mode)
     {
     case eCAL::eCommunicationMode::network:
       attributes.udp.group         = transport_tlayer_config.udp.network.group;
       attributes.udp.ttl           = transport_tlayer_config.udp.network.ttl;
+      // with a topic group pool every topic is sent to its own group, so only the subscribing hosts receive it
+      if ((transport_tlayer_config.udp.config_version == Types::UdpConfigVersion::V2) && (transport_tlayer_config.udp.topic_group_pool_size > 0))
+      {
+        attributes.udp.group       = UDP::V2::topic2mcast_pool(topic_name_, transport_tlayer_config.udp.network.group, transport_tlayer_config.udp.topic_group_pool_size);
+      }
       break;
     case eCAL::eCommunicationMode::local:
       attributes.udp.group         = transport_tlayer_config.udp.local.group;
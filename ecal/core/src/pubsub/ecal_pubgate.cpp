@@ -24,6 +24,7 @@
 #include "ecal_pubgate.h"
 #include "ecal_globals.h"
 
+#include <algorithm>
 #include <atomic>
 #include <memory>
 #include <mutex>
@@ -130,6 +131,9 @@ namespace eCAL
       }
     }
 
+    // rate limit / downsampling requested by the subscriber
+    const SampleFilter sample_filter(static_cast<unsigned int>(std::max(ecal_topic.receive_max_frequency, 0)), static_cast<unsigned int>(std::max(ecal_topic.receive_downsampling, 0)));
+
     std::string reader_par;
 #if 0
     for (const auto& layer : ecal_sample.transport_layer())
@@ -146,7 +150,7 @@ namespace eCAL
     auto res = m_topic_name_publisher_map.equal_range(topic_name);
     for(TopicNamePublisherMapT::const_iterator iter = res.first; iter != res.second; ++iter)
     {
-      iter->second->ApplySubscriberRegistration(subscription_info, topic_information, layer_states, reader_par);
+      iter->second->ApplySubscriberRegistration(subscription_info, topic_information, layer_states, sample_filter, reader_par);
     }
   }
 
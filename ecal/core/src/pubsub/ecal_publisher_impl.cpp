@@ -33,6 +33,7 @@
 
 #include "ecal_publisher_impl.h"
 #include "ecal_global_accessors.h"
+#include "ecal_descriptor_store.h"
 
 #include "readwrite/ecal_writer_base.h"
 #include "readwrite/ecal_writer_buffer_payload.h"
@@ -119,6 +120,9 @@ namespace eCAL
     m_topic_id.topic_id.host_name = m_attributes.host_name;
     m_topic_id.topic_id.process_id = m_attributes.process_id;
 
+    // hash the descriptor once, it is sent with every registration
+    m_topic_info_hash = CDescriptorStore::Hash(m_topic_info.descriptor);
+
     // mark as created
     m_created = true;
   }
@@ -172,6 +176,17 @@ namespace eCAL
     allow_zero_copy &= !m_writer_tcp;
 #endif
 
+    // prepare counter and internal states
+    const size_t snd_hash = PrepareWrite(filter_id_, payload_buf_size);
+
+    // which layers need this sample, according to the rate limits / downsampling of the subscribers
+    SReceiverDemand demand;
+    if (!GetReceiverDemand(time_, demand))
+    {
+      // no subscriber needs this sample, so we do not even copy the payload
+      return false;
+    }
+
     // create a payload copy for all layer
     if (!allow_zero_copy)
     {
@@ -179,9 +194,6 @@ namespace eCAL
       payload_.WriteFull(m_payload_buffer.data(), m_payload_buffer.size());
     }
 
-    // prepare counter and internal states
-    const size_t snd_hash = PrepareWrite(filter_id_, payload_buf_size);
-
     // did we write anything
     bool written(false);
 
@@ -189,7 +201,7 @@ namespace eCAL
     // SHM
     ////////////////////////////////////////////////////////////////////////////
 #if ECAL_CORE_TRANSPORT_SHM
-    if (m_writer_shm)
+    if (m_writer_shm && demand.shm)
     {
 #ifndef NDEBUG
       Logging::Log(Logging::log_level_debug3, m_attributes.topic_name + "::CPublisherImpl::Write::SHM");
@@ -207,13 +219,14 @@ namespace eCAL
         wattr.time = time_;
         wattr.zero_copy = m_attributes.shm.zero_copy_mode;
         wattr.acknowledge_timeout_ms = m_attributes.shm.acknowledge_timeout_ms;
+        wattr.skip_processes = m_shm_skip_processes.empty() ? nullptr : &m_shm_skip_processes;
 
         // prepare send
         if (m_writer_shm->PrepareWrite(wattr))
         {
           // register new to update listening subscribers and rematch
+          // (connected subscribers are forwarded to the new memory file by the shm layer, so there is no need to wait for them)
           Register();
-          Process::SleepMS(5);
         }
 
         // we are the only active layer, and we support zero copy -> we do a zero copy write via payload
@@ -252,7 +265,7 @@ namespace eCAL
     // UDP (MC)
     ////////////////////////////////////////////////////////////////////////////
 #if ECAL_CORE_TRANSPORT_UDP
-    if (m_writer_udp)
+    if (m_writer_udp && demand.udp)
     {
 #ifndef NDEBUG
       Logging::Log(Logging::log_level_debug3, m_attributes.topic_name + "::CPublisherImpl::Write::udp");
@@ -301,7 +314,7 @@ namespace eCAL
     // TCP
     ////////////////////////////////////////////////////////////////////////////
 #if ECAL_CORE_TRANSPORT_TCP
-    if (m_writer_tcp)
+    if (m_writer_tcp && demand.tcp)
     {
 #ifndef NDEBUG
       Logging::Log(Logging::log_level_debug3, m_attributes.topic_name + "::CPublisherImpl::Send::TCP");
@@ -343,7 +356,9 @@ namespace eCAL
 
   bool CPublisherImpl::SetDataTypeInformation(const SDataTypeInformation& topic_info_)
   {
-    m_topic_info = topic_info_;
+    m_topic_info      = topic_info_;
+    m_topic_info_hash = CDescriptorStore::Hash(m_topic_info.descriptor);
+    m_descriptor_refresh_requested = true;
 
 #ifndef NDEBUG
     Logging::Log(Logging::log_level_debug2, m_attributes.topic_name + "::CPublisherImpl::SetDataTypeInformation");
@@ -438,7 +453,7 @@ namespace eCAL
     return true;
   }
 
-  void CPublisherImpl::ApplySubscriberRegistration(const SSubscriptionInfo& subscription_info_, const SDataTypeInformation& data_type_info_, const SLayerStates& sub_layer_states_, const std::string& reader_par_)
+  void CPublisherImpl::ApplySubscriberRegistration(const SSubscriptionInfo& subscription_info_, const SDataTypeInformation& data_type_info_, const SLayerStates& sub_layer_states_, const SampleFilter& sample_filter_, const std::string& reader_par_)
   {
     // collect layer states
     std::vector<eTLayerType> pub_layers;
@@ -495,7 +510,8 @@ namespace eCAL
 #endif
 
     // add key to connection map, including connection state
-    bool is_new_connection = false;
+    bool is_new_subscription = false;
+    bool is_new_connection   = false;
     {
       const std::lock_guard<std::mutex> lock(m_connection_map_mutex);
       auto subscription_info_iter = m_connection_map.find(subscription_info_);
@@ -503,7 +519,8 @@ namespace eCAL
       if (subscription_info_iter == m_connection_map.end())
       {
         // add subscriber to connection map, connection state false
-        m_connection_map[subscription_info_] = SConnection{ data_type_info_, sub_layer_states_, false };
+        m_connection_map[subscription_info_] = SConnection{ data_type_info_, sub_layer_states_, false, layer2activate, sample_filter_ };
+        is_new_subscription = true;
       }
       else
       {
@@ -518,11 +535,17 @@ namespace eCAL
         }
 
         // update the data type, the layer states and set the state active
-        connection = SConnection{ data_type_info_, sub_layer_states_, true };
+        // (the sample filter keeps its state, if the subscriber did not change its settings)
+        connection.data_type_info = data_type_info_;
+        connection.layer_states   = sub_layer_states_;
+        connection.state          = true;
+        connection.layer          = layer2activate;
+        connection.sample_filter.Reconfigure(sample_filter_);
       }
 
       // update connection count
       m_connection_count = GetConnectionCount();
+      m_has_filtered_connection = HasFilteredConnection();
     }
 
 
@@ -533,6 +556,19 @@ namespace eCAL
       FireConnectEvent(subscription_info_, data_type_info_);
     }
 
+    // a new subscriber may not know our descriptor yet
+    if (is_new_subscription)
+    {
+      m_descriptor_refresh_requested = true;
+    }
+
+    // answer a new subscriber immediately instead of waiting for the next registration
+    // refresh, so the subscriber sees our second registration within one exchange
+    if (m_attributes.fast_discovery && (is_new_subscription || is_new_connection))
+    {
+      Register();
+    }
+
 #ifndef NDEBUG
     Logging::Log(Logging::log_level_debug3, m_attributes.topic_name + "::CPublisherImpl::ApplySubscriberRegistration");
 #endif
@@ -559,6 +595,7 @@ namespace eCAL
 
       // update connection count
       m_connection_count = GetConnectionCount();
+      m_has_filtered_connection = HasFilteredConnection();
     }
 
     // fire disconnect event
@@ -621,10 +658,22 @@ namespace eCAL
 
   void CPublisherImpl::GetRegistration(Registration::Sample& sample)
   {
-    GetRegistrationSample(sample);
+    GetRegistrationSample(sample, IsDescriptorRefreshDue());
+  }
+
+  bool CPublisherImpl::IsDescriptorRefreshDue()
+  {
+    // the full descriptor is sent with the first registration, after a new subscriber showed up
+    // and with every n-th registration refresh, all other registrations only carry its hash
+    if (m_descriptor_refresh_requested.exchange(false) || (++m_descriptor_refresh_cycle >= m_attributes.descriptor_refresh))
+    {
+      m_descriptor_refresh_cycle = 0;
+      return true;
+    }
+    return false;
   }
 
-  void CPublisherImpl::GetRegistrationSample(Registration::Sample& ecal_reg_sample)
+  void CPublisherImpl::GetRegistrationSample(Registration::Sample& ecal_reg_sample, bool with_descriptor_)
   {
     ecal_reg_sample.cmd_type = bct_reg_publisher;
 
@@ -642,8 +691,9 @@ namespace eCAL
       auto& ecal_reg_sample_tdatatype = ecal_reg_sample_topic.datatype_information;
       ecal_reg_sample_tdatatype.encoding   = m_topic_info.encoding;
       ecal_reg_sample_tdatatype.name       = m_topic_info.name;
-      ecal_reg_sample_tdatatype.descriptor = m_topic_info.descriptor;
+      if (with_descriptor_) ecal_reg_sample_tdatatype.descriptor = m_topic_info.descriptor;
     }
+    ecal_reg_sample_topic.descriptor_hash = m_topic_info_hash;
     ecal_reg_sample_topic.topic_size = static_cast<int32_t>(m_topic_size);
 
 #if ECAL_CORE_TRANSPORT_UDP
@@ -791,6 +841,71 @@ namespace eCAL
     return count;
   }
 
+  bool CPublisherImpl::HasFilteredConnection()
+  {
+    // no need to lock map here for now, map locked by caller
+    for (const auto& sub : m_connection_map)
+    {
+      if (sub.second.sample_filter.IsActive()) return true;
+    }
+    return false;
+  }
+
+  bool CPublisherImpl::GetReceiverDemand(long long time_, SReceiverDemand& demand_)
+  {
+    demand_ = SReceiverDemand();
+    m_shm_skip_processes.clear();
+
+    // no subscriber limits its rate, everybody gets everything
+    if (!m_has_filtered_connection) return true;
+
+    demand_ = SReceiverDemand{ false, false, false };
+    m_shm_demand_processes.clear();
+    m_shm_idle_processes.clear();
+
+    {
+      const std::lock_guard<std::mutex> lock(m_connection_map_mutex);
+
+      // every filter has to see every sample to keep its state
+      for (auto& sub : m_connection_map)
+      {
+        const bool demand = sub.second.sample_filter.Accept(m_clock, time_);
+
+        switch (sub.second.layer)
+        {
+        case TransportLayer::eType::shm:
+          demand_.shm |= demand;
+          if (demand) m_shm_demand_processes.push_back(sub.first.process_id);
+          else        m_shm_idle_processes.push_back(sub.first.process_id);
+          break;
+        case TransportLayer::eType::udp_mc:
+          demand_.udp |= demand;
+          break;
+        case TransportLayer::eType::tcp:
+          demand_.tcp |= demand;
+          break;
+        default:
+          break;
+        }
+      }
+    }
+
+    // all shm subscribers of a process share one event, so a process
+    // can only be skipped if none of its subscribers needs the sample
+    for (const auto process_id : m_shm_idle_processes)
+    {
+      if (std::find(m_shm_demand_processes.begin(), m_shm_demand_processes.end(), process_id) != m_shm_demand_processes.end()) continue;
+
+      const std::string process_id_str = std::to_string(process_id);
+      if (std::find(m_shm_skip_processes.begin(), m_shm_skip_processes.end(), process_id_str) == m_shm_skip_processes.end())
+      {
+        m_shm_skip_processes.push_back(process_id_str);
+      }
+    }
+
+    return demand_.shm || demand_.udp || demand_.tcp;
+  }
+
   bool CPublisherImpl::StartUdpLayer()
   {
 #if ECAL_CORE_TRANSPORT_UDP
@@ -30,6 +30,7 @@
 
 #include "serialization/ecal_serialize_sample_registration.h"
 #include "util/frequency_calculator.h"
+#include "util/sample_filter.h"
 #include "readwrite/config/attributes/writer_attributes.h"
 
 #if ECAL_CORE_TRANSPORT_UDP
@@ -92,7 +93,7 @@ namespace eCAL
     bool SetAttribute(const std::string& attr_name_, const std::string& attr_value_);
     bool ClearAttribute(const std::string& attr_name_);
 
-    void ApplySubscriberRegistration(const SSubscriptionInfo& subscription_info_, const SDataTypeInformation& data_type_info_, const SLayerStates& sub_layer_states_, const std::string& reader_par_);
+    void ApplySubscriberRegistration(const SSubscriptionInfo& subscription_info_, const SDataTypeInformation& data_type_info_, const SLayerStates& sub_layer_states_, const SampleFilter& sample_filter_, const std::string& reader_par_);
     void ApplySubscriberUnregistration(const SSubscriptionInfo& subscription_info_, const SDataTypeInformation& data_type_info_);
 
     void GetRegistration(Registration::Sample& sample);
@@ -112,7 +113,8 @@ namespace eCAL
     void Register();
     void Unregister();
 
-    void GetRegistrationSample(Registration::Sample& sample);
+    void GetRegistrationSample(Registration::Sample& sample, bool with_descriptor_ = true);
+    bool IsDescriptorRefreshDue();
     void GetUnregistrationSample(Registration::Sample& sample);
 
     bool StartUdpLayer();
@@ -127,6 +129,15 @@ namespace eCAL
     void FireDisconnectEvent(const SSubscriptionInfo& subscription_info_, const SDataTypeInformation& data_type_info_);
 
     size_t GetConnectionCount();
+    bool   HasFilteredConnection();
+
+    struct SReceiverDemand
+    {
+      bool shm = true;
+      bool udp = true;
+      bool tcp = true;
+    };
+    bool GetReceiverDemand(long long time_, SReceiverDemand& demand_);
 
     size_t PrepareWrite(long long id_, size_t len_);
 
@@ -136,6 +147,9 @@ namespace eCAL
 
     EntityIdT                              m_publisher_id;
     SDataTypeInformation                   m_topic_info;
+    uint64_t                               m_topic_info_hash = 0;
+    std::atomic<bool>                      m_descriptor_refresh_requested{ true };
+    unsigned int                           m_descriptor_refresh_cycle = 0;
     size_t                                 m_topic_size = 0;
     eCAL::eCALWriter::SAttributes          m_attributes;
     STopicId                               m_topic_id;
@@ -144,14 +158,20 @@ namespace eCAL
 
     struct SConnection
     {
-      SDataTypeInformation data_type_info;
-      SLayerStates         layer_states;
-      bool                 state = false;
+      SDataTypeInformation  data_type_info;
+      SLayerStates          layer_states;
+      bool                  state = false;
+      TransportLayer::eType layer = TransportLayer::eType::none;  // layer the subscriber is served by
+      SampleFilter          sample_filter;                         // rate limit / downsampling requested by the subscriber
     };
     using SSubscriptionMapT = std::map<SSubscriptionInfo, SConnection>;
     mutable std::mutex                     m_connection_map_mutex;
     SSubscriptionMapT                      m_connection_map;
     std::atomic<size_t>                    m_connection_count{ 0 };
+    std::atomic<bool>                      m_has_filtered_connection{ false };
+    std::vector<int32_t>                   m_shm_demand_processes;
+    std::vector<int32_t>                   m_shm_idle_processes;
+    std::vector<std::string>               m_shm_skip_processes;
 
     using EventCallbackMapT = std::map<ePublisherEvent, v5::PubEventCallbackT>;
     std::mutex                             m_event_callback_map_mutex;
@@ -24,6 +24,8 @@
 #include "pubsub/ecal_subgate.h"
 #include "ecal_globals.h"
 
+#include "io/udp/ecal_udp_sample_frame.h"
+
 #include <algorithm>
 #include <atomic>
 #include <cstddef>
@@ -171,6 +173,17 @@ namespace eCAL
       }
     }
     break;
+    case bct_set_sample_frame:
+    {
+      // samples of multiple topics coalesced by the sender, apply them one by one
+      bool applied(false);
+      UDP::ForEachInSampleFrame(ecal_sample.content.payload.vec.data(), ecal_sample.content.payload.vec.size(),
+        [this, &applied, layer_](const char* sample_data_, size_t sample_size_)
+        {
+          if (ApplySample(sample_data_, sample_size_, layer_)) applied = true;
+        });
+      return applied;
+    }
     default:
       break;
     }
@@ -33,6 +33,7 @@
 
 #include "ecal_subscriber_impl.h"
 #include "ecal_global_accessors.h"
+#include "ecal_descriptor_store.h"
 
 #include "readwrite/ecal_reader_layer.h"
 #include "readwrite/ecal_transport_layer.h"
@@ -78,6 +79,12 @@ namespace eCAL
                  m_created(false),
                  m_attributes(attr_)
   {
+    // hash the descriptor once, it is sent with every registration
+    m_topic_info_hash = CDescriptorStore::Hash(m_topic_info.descriptor);
+
+    // rate limit / downsampling, announced to the publishers by registration
+    m_sample_filter = SampleFilter(m_attributes.max_frequency_mhz, m_attributes.downsampling);
+
 #ifndef NDEBUG
     // log it
     Logging::Log(Logging::log_level_debug1, m_attributes.topic_name + "::CSubscriberImpl::Constructor");
@@ -317,7 +324,8 @@ namespace eCAL
 #endif
 
     // add key to connection map, including connection state
-    bool is_new_connection = false;
+    bool is_new_publication = false;
+    bool is_new_connection  = false;
     {
       const std::lock_guard<std::mutex> lock(m_connection_map_mtx);
       auto publication_info_iter = m_connection_map.find(publication_info_);
@@ -326,6 +334,7 @@ namespace eCAL
       {
         // add publisher to connection map, connection state false
         m_connection_map[publication_info_] = SConnection{ data_type_info_, pub_layer_states_, false };
+        is_new_publication = true;
       }
       else
       {
@@ -354,6 +363,19 @@ namespace eCAL
       FireConnectEvent(publication_info_, data_type_info_);
     }
 
+    // a new publisher may not know our descriptor yet
+    if (is_new_publication)
+    {
+      m_descriptor_refresh_requested = true;
+    }
+
+    // answer a new publisher immediately instead of waiting for the next registration
+    // refresh, so the publisher sees our second registration within one exchange
+    if (m_attributes.fast_discovery && (is_new_publication || is_new_connection))
+    {
+      Register();
+    }
+
 #ifndef NDEBUG
     Logging::Log(Logging::log_level_debug3, m_attributes.topic_name + "::CSubscriberImpl::ApplyPublisherRegistration");
 #endif
@@ -371,6 +393,13 @@ namespace eCAL
       m_connection_count = GetConnectionCount();
     }
 
+    // forget the sample filter state of this publisher
+    if (m_sample_filter.IsActive())
+    {
+      const std::lock_guard<std::mutex> lock(m_receive_callback_mutex);
+      m_sample_filter_map.erase(publication_info_);
+    }
+
     // fire disconnect event
     FireDisconnectEvent(publication_info_, data_type_info_);
     
@@ -459,6 +488,12 @@ namespace eCAL
       return 0;
     }
 
+    // We drop samples exceeding our rate limit / downsampling, the publisher may have sent them for other subscribers
+    if (!ShouldApplySampleBasedOnFilter(publication_info, clock_, time_))
+    {
+      return size_;
+    }
+
     // store receive layer
     m_layers.udp.active |= layer_ == tl_ecal_udp;
     m_layers.shm.active |= layer_ == tl_ecal_shm;
@@ -472,7 +507,8 @@ namespace eCAL
     // increase read clock
     m_clock++;
 
-    TriggerMessageDropUdate(publication_info, clock_);
+    // the publisher skips samples on purpose for a filtering subscriber, these are no drops
+    if (!m_sample_filter.IsActive()) TriggerMessageDropUdate(publication_info, clock_);
     TriggerFrequencyUpdate();
 
     // reset timeout
@@ -568,7 +604,19 @@ namespace eCAL
   void CSubscriberImpl::GetRegistration(Registration::Sample& sample)
   {
     // return registration
-    return GetRegistrationSample(sample);
+    return GetRegistrationSample(sample, IsDescriptorRefreshDue());
+  }
+
+  bool CSubscriberImpl::IsDescriptorRefreshDue()
+  {
+    // the full descriptor is sent with the first registration, after a new publisher showed up
+    // and with every n-th registration refresh, all other registrations only carry its hash
+    if (m_descriptor_refresh_requested.exchange(false) || (++m_descriptor_refresh_cycle >= m_attributes.descriptor_refresh))
+    {
+      m_descriptor_refresh_cycle = 0;
+      return true;
+    }
+    return false;
   }
 
   bool CSubscriberImpl::IsPublished() const
@@ -581,7 +629,7 @@ namespace eCAL
     return m_connection_count;
   }
     
-  void CSubscriberImpl::GetRegistrationSample(Registration::Sample& ecal_reg_sample)
+  void CSubscriberImpl::GetRegistrationSample(Registration::Sample& ecal_reg_sample, bool with_descriptor_)
   {
     ecal_reg_sample.cmd_type = bct_reg_subscriber;
 
@@ -598,8 +646,9 @@ namespace eCAL
       auto& ecal_reg_sample_tdatatype      = ecal_reg_sample_topic.datatype_information;
       ecal_reg_sample_tdatatype.encoding   = m_topic_info.encoding;
       ecal_reg_sample_tdatatype.name       = m_topic_info.name;
-      ecal_reg_sample_tdatatype.descriptor = m_topic_info.descriptor;
+      if (with_descriptor_) ecal_reg_sample_tdatatype.descriptor = m_topic_info.descriptor;
     }
+    ecal_reg_sample_topic.descriptor_hash = m_topic_info_hash;
     ecal_reg_sample_topic.topic_size = static_cast<int32_t>(m_topic_size);
 
 #if ECAL_CORE_TRANSPORT_UDP
@@ -644,6 +693,10 @@ namespace eCAL
     ecal_reg_sample_topic.data_frequency = GetFrequency();
     ecal_reg_sample_topic.message_drops  = GetMessageDropsAndFireDroppedEvents();
 
+    // publishers skip the samples we do not need
+    ecal_reg_sample_topic.receive_max_frequency = static_cast<int32_t>(std::min<unsigned int>(m_sample_filter.GetMaxFrequency(), std::numeric_limits<int32_t>::max()));
+    ecal_reg_sample_topic.receive_downsampling  = static_cast<int32_t>(std::min<unsigned int>(m_sample_filter.GetDownsampling(), std::numeric_limits<int32_t>::max()));
+
     // we do not know the number of connections ..
     ecal_reg_sample_topic.connections_local = 0;
     ecal_reg_sample_topic.connections_external = 0;
@@ -865,6 +918,19 @@ namespace eCAL
     return true;
   }
 
+  bool CSubscriberImpl::ShouldApplySampleBasedOnFilter(const SPublicationInfo& publication_info_, long long clock_, long long time_)
+  {
+    if (!m_sample_filter.IsActive()) return true;
+
+    // every publisher gets its own filter state, the same one the publisher uses for this subscriber
+    auto iter = m_sample_filter_map.find(publication_info_);
+    if (iter == m_sample_filter_map.end())
+    {
+      iter = m_sample_filter_map.emplace(publication_info_, m_sample_filter).first;
+    }
+    return iter->second.Accept(clock_, time_);
+  }
+
   void CSubscriberImpl::TriggerFrequencyUpdate()
   {
     const auto receive_time = std::chrono::steady_clock::now();
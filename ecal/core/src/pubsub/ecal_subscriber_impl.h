@@ -31,6 +31,7 @@
 #include "util/frequency_calculator.h"
 #include "util/message_drop_calculator.h"
 #include "util/counter_cache.h"
+#include "util/sample_filter.h"
 #include "readwrite/config/attributes/reader_attributes.h"
 
 #include <atomic>
@@ -117,7 +118,8 @@ namespace eCAL
     void Register();
     void Unregister();
 
-    void GetRegistrationSample(Registration::Sample& sample);
+    void GetRegistrationSample(Registration::Sample& sample, bool with_descriptor_ = true);
+    bool IsDescriptorRefreshDue();
     void GetUnregistrationSample(Registration::Sample& sample);
 
     void StartTransportLayer();
@@ -136,6 +138,7 @@ namespace eCAL
     bool ShouldApplySampleBasedOnClock(const SPublicationInfo& publication_info_, long long clock_) const;
     bool ShouldApplySampleBasedOnLayer(eTLayerType layer_) const;
     bool ShouldApplySampleBasedOnId(long long id_) const;
+    bool ShouldApplySampleBasedOnFilter(const SPublicationInfo& publication_info_, long long clock_, long long time_);
 
     void TriggerFrequencyUpdate();
     void TriggerMessageDropUdate(const SPublicationInfo& publication_info_, uint64_t message_counter);
@@ -145,6 +148,9 @@ namespace eCAL
 
     EntityIdT                                 m_subscriber_id;
     SDataTypeInformation                      m_topic_info;
+    uint64_t                                  m_topic_info_hash = 0;
+    std::atomic<bool>                         m_descriptor_refresh_requested{ true };
+    unsigned int                              m_descriptor_refresh_cycle = 0;
     STopicId                                  m_topic_id;
     std::atomic<size_t>                       m_topic_size;
 
@@ -192,6 +198,10 @@ namespace eCAL
     
     std::set<long long>                       m_id_set;
 
+    // rate limit / downsampling, applied per publisher
+    SampleFilter                              m_sample_filter;
+    std::map<SPublicationInfo, SampleFilter>  m_sample_filter_map;
+
     SLayerStates                              m_layers;
     std::atomic<bool>                         m_created;
 
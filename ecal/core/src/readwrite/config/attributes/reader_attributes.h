@@ -34,6 +34,7 @@ namespace eCAL
       int         port;
       int         receivebuffer;
       std::string group;
+      bool        joined_groups_only;
     };
 
     struct STCPAttributes
@@ -52,7 +53,11 @@ namespace eCAL
     {
       bool         network_enabled;
       bool         drop_out_of_order_messages;
+      unsigned int max_frequency_mhz;
+      unsigned int downsampling;
       bool         loopback;
+      bool         fast_discovery;
+      unsigned int descriptor_refresh;
       unsigned int registration_timeout_ms;
 
       SUDPAttributes udp;
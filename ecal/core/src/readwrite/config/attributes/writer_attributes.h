@@ -32,12 +32,15 @@ namespace eCAL
   {
     struct SUDPAttributes
     {
-      bool        enable;
-      bool        broadcast;
-      int         port;
-      int         send_buffer;
-      std::string group;
-      int         ttl;
+      bool         enable;
+      bool         broadcast;
+      int          port;
+      int          send_buffer;
+      std::string  group;
+      int          ttl;
+      bool         coalescing_enable;
+      unsigned int coalescing_max_delay_us;
+      unsigned int coalescing_max_size;
     };
 
     struct STCPAttributes
@@ -54,6 +57,9 @@ namespace eCAL
       unsigned int memfile_buffer_count;
       unsigned int memfile_min_size_bytes;
       unsigned int memfile_reserve_percent;
+      bool         memfile_memfd;
+      bool         memfile_huge_pages;
+      bool         memfile_prefault;
     };
 
 
@@ -65,6 +71,8 @@ namespace eCAL
 
       bool                 network_enabled;
       bool                 loopback;
+      bool                 fast_discovery;
+      unsigned int         descriptor_refresh;
 
       std::string          host_name;
       std::string          shm_transport_domain;
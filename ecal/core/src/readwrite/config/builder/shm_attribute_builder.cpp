@@ -44,6 +44,9 @@ namespace eCAL
       attributes.memfile_buffer_count    = attr_.shm.memfile_buffer_count;
       attributes.memfile_reserve_percent = attr_.shm.memfile_reserve_percent;
       attributes.memfile_min_size_bytes  = attr_.shm.memfile_min_size_bytes;
+      attributes.memfile_memfd           = attr_.shm.memfile_memfd;
+      attributes.memfile_huge_pages      = attr_.shm.memfile_huge_pages;
+      attributes.memfile_prefault        = attr_.shm.memfile_prefault;
 
       attributes.topic_name = attr_.topic_name;
       attributes.host_name  = attr_.host_name;
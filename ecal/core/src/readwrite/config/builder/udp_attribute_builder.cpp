@@ -34,6 +34,7 @@ namespace eCAL
       attributes.port           = attr_.udp.port;
       attributes.broadcast      = attr_.udp.broadcast;
       attributes.address        = attr_.udp.group;
+      attributes.joined_groups_only = attr_.udp.joined_groups_only;
 
       return attributes;
     }    
@@ -55,6 +56,10 @@ namespace eCAL
       attributes.address     = attr_.udp.group;
       attributes.ttl         = attr_.udp.ttl;
 
+      attributes.coalescing_enable       = attr_.udp.coalescing_enable;
+      attributes.coalescing_max_delay_us = attr_.udp.coalescing_max_delay_us;
+      attributes.coalescing_max_size     = attr_.udp.coalescing_max_size;
+
 
       return attributes;
     }
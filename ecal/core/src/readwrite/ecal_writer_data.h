@@ -24,6 +24,8 @@
 #pragma once
 
 #include <cstddef>
+#include <string>
+#include <vector>
 
 namespace eCAL
 {
@@ -37,5 +39,8 @@ namespace eCAL
     bool         loopback               = false;
     bool         zero_copy              = false;
     long long    acknowledge_timeout_ms = 0;
+
+    // shm only: processes that are not signaled, because none of their subscribers needs this sample
+    const std::vector<std::string>* skip_processes = nullptr;
   };
 }
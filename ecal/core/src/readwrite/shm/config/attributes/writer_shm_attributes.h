@@ -33,6 +33,9 @@ namespace eCAL
         unsigned int memfile_buffer_count;
         unsigned int memfile_min_size_bytes;
         unsigned int memfile_reserve_percent;
+        bool         memfile_memfd;
+        bool         memfile_huge_pages;
+        bool         memfile_prefault;
 
         std::string host_name;
         std::string topic_name;
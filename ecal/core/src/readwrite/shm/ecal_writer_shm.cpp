@@ -177,6 +177,9 @@ namespace eCAL
     memory_file_attr.reserve         = m_attributes.memfile_reserve_percent;
     memory_file_attr.timeout_open_ms = PUB_MEMFILE_OPEN_TO;
     memory_file_attr.timeout_ack_ms  = m_attributes.acknowledge_timeout_ms;
+    memory_file_attr.memfd           = m_attributes.memfile_memfd;
+    memory_file_attr.huge_pages      = m_attributes.memfile_huge_pages;
+    memory_file_attr.prefault        = m_attributes.memfile_prefault;
 
     // retrieve the memory file size of existing files
     size_t memory_file_size(0);
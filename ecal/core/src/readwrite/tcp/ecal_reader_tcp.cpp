@@ -29,6 +29,7 @@
 #include "ecal_tcp_pubsub_logger.h"
 
 #include "pubsub/ecal_subgate.h"
+#include "util/ecal_thread_factory.h"
 
 #include "ecal_utils/portable_endian.h"
 
@@ -144,7 +145,11 @@ namespace eCAL
     m_initialized = true;
 
     const tcp_pubsub::logger::logger_t tcp_pubsub_logger = std::bind(TcpPubsubLogger, std::placeholders::_1, std::placeholders::_2);
-    m_executor = std::make_shared<tcp_pubsub::Executor>(m_attributes.thread_pool_size, tcp_pubsub_logger);
+    // the executor threads are created by tcp_pubsub, they inherit the policy of the creating thread
+    Threading::RunInThread(Threading::eThreadClass::tcp, [this, &tcp_pubsub_logger]()
+      {
+        m_executor = std::make_shared<tcp_pubsub::Executor>(m_attributes.thread_pool_size, tcp_pubsub_logger);
+      });
   }
 
   void CTCPReaderLayer::AddSubscription(const std::string& /*host_name_*/, const std::string& topic_name_, const EntityIdT& /*topic_id_*/)
@@ -28,6 +28,7 @@
 
 #include "ecal_writer_tcp.h"
 #include "ecal_tcp_pubsub_logger.h"
+#include "util/ecal_thread_factory.h"
 
 #include "ecal_utils/portable_endian.h"
 
@@ -45,13 +46,24 @@ namespace eCAL
       const std::lock_guard<std::mutex> lock(g_tcp_writer_executor_mtx);
       if (!g_tcp_writer_executor)
       {
-        g_tcp_writer_executor = std::make_shared<tcp_pubsub::Executor>(m_attributes.thread_pool_size, TcpPubsubLogger);
+        // the executor threads are created by tcp_pubsub, they inherit the policy of the creating thread
+        Threading::RunInThread(Threading::eThreadClass::tcp, [this]()
+          {
+            g_tcp_writer_executor = std::make_shared<tcp_pubsub::Executor>(m_attributes.thread_pool_size, TcpPubsubLogger);
+          });
       }
     }
 
     // create publisher
     m_publisher = std::make_shared<tcp_pubsub::Publisher>(g_tcp_writer_executor);
     m_port      = m_publisher->getPort();
+
+    // the topic information of the header never changes
+    auto& proto_header_topic = m_proto_header.topic_info;
+    proto_header_topic.topic_name = m_attributes.topic_name;
+    proto_header_topic.topic_id   = m_attributes.topic_id;
+
+    m_send_vec.reserve(2);
   }
 
   SWriterInfo CDataWriterTCP::GetInfo()
@@ -73,14 +85,8 @@ namespace eCAL
   {
     if (!m_publisher) return false;
 
-    // create new payload sample (header information only, no payload)
-    Payload::Sample proto_header;
-    auto& proto_header_topic = proto_header.topic_info;
-    proto_header_topic.topic_name = m_attributes.topic_name;
-    proto_header_topic.topic_id   = m_attributes.topic_id;
-
-    // set payload content (without payload)
-    auto& proto_header_content = proto_header.content;
+    // set payload content (without payload), the topic information is set once in the constructor
+    auto& proto_header_content = m_proto_header.content;
     proto_header_content.id    = attr_.id;
     proto_header_content.clock = attr_.clock;
     proto_header_content.time  = attr_.time;
@@ -89,18 +95,11 @@ namespace eCAL
 
     // Compute size of "ECAL" pre-header
     constexpr size_t ecal_magic_size(4 * sizeof(char));
+    constexpr size_t alignment_bytes = 8;
 
-    // Serialize payload sample
-    std::vector<char> serialized_proto_header;
-    SerializeToBuffer(proto_header, serialized_proto_header);
-
-    // Get size of un-altered proto header size
-    auto proto_header_size = static_cast<uint16_t>(serialized_proto_header.size());
-
-    // Compute needed padding for aligning the payload
-    constexpr size_t alignment_bytes     = 8;
-    const     size_t minimal_header_size = ecal_magic_size +  sizeof(uint16_t)    +  proto_header_size;
-    const     size_t padding_size        = (alignment_bytes - (minimal_header_size % alignment_bytes)) % alignment_bytes;
+    // Serialize payload sample with the padding of the last send, the header size
+    // only changes if the varint size of a content field changes
+    SerializeToBuffer(m_proto_header, m_serialized_proto_header);
 
     // Add more bytes to the protobuf message to blow it up to the alignment
     // Aligning the user payload this way should be 100% compatible with previous
@@ -108,12 +107,17 @@ namespace eCAL
     // in a future eCAL version.
     // 
     // TODO: REMOVE ME FOR ECAL6
-    proto_header.padding.resize(padding_size);
+    if ((ecal_magic_size + sizeof(uint16_t) + m_serialized_proto_header.size()) % alignment_bytes != 0)
+    {
+      // the padding field is always serialized, so its size only grows by the padding bytes
+      const size_t minimal_header_size = ecal_magic_size + sizeof(uint16_t) + m_serialized_proto_header.size() - m_proto_header.padding.size();
+      const size_t padding_size        = (alignment_bytes - (minimal_header_size % alignment_bytes)) % alignment_bytes;
+      m_proto_header.padding.resize(padding_size);
 
-    // Serialize payload sample again (now with padding) and reread size
-    serialized_proto_header.clear();
-    SerializeToBuffer(proto_header, serialized_proto_header);
-    proto_header_size = static_cast<uint16_t>(serialized_proto_header.size());
+      // Serialize payload sample again (now with padding)
+      SerializeToBuffer(m_proto_header, m_serialized_proto_header);
+    }
+    const auto proto_header_size = static_cast<uint16_t>(m_serialized_proto_header.size());
 
     // prepare the header buffer
     //                    'ECAL'           + proto header size field  + proto header
@@ -126,22 +130,22 @@ namespace eCAL
     m_header_buffer[3] = 'L';
 
     // set proto header size right after magic ecal header
-    *reinterpret_cast<uint16_t*>(&m_header_buffer[ecal_magic_size]) = htole16(proto_header_size);
+    const uint16_t proto_header_size_le = htole16(proto_header_size);
+    memcpy(m_header_buffer.data() + ecal_magic_size, &proto_header_size_le, sizeof(uint16_t));
 
     // copy serialized proto header right after sample size field
-    memcpy((void*)(m_header_buffer.data() + ecal_magic_size + sizeof(uint16_t)), serialized_proto_header.data(), serialized_proto_header.size());
+    memcpy(m_header_buffer.data() + ecal_magic_size + sizeof(uint16_t), m_serialized_proto_header.data(), m_serialized_proto_header.size());
 
     // create tcp send buffer
-    std::vector<std::pair<const char* const, const size_t>> send_vec;
-    send_vec.reserve(2);
+    m_send_vec.clear();
 
     // push header data
-    send_vec.emplace_back(m_header_buffer.data(), m_header_buffer.size());
+    m_send_vec.emplace_back(m_header_buffer.data(), m_header_buffer.size());
     // push payload data
-    send_vec.emplace_back(static_cast<const char*>(buf_), attr_.len);
+    m_send_vec.emplace_back(static_cast<const char*>(buf_), attr_.len);
 
     // send it
-    const bool success = m_publisher->send(send_vec);
+    const bool success = m_publisher->send(m_send_vec);
 
     // return success
     return success;
@@ -26,12 +26,14 @@
 #include "config/attributes/data_writer_tcp_attributes.h"
 
 #include "readwrite/ecal_writer_base.h"
+#include "serialization/ecal_struct_sample_payload.h"
 
 #include <tcp_pubsub/executor.h>
 #include <tcp_pubsub/publisher.h>
 
 #include <mutex>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace eCAL
@@ -51,7 +53,11 @@ namespace eCAL
   private:
     eCAL::eCALWriter::TCP::SAttributes           m_attributes;
 
+    // reused for every send, only the content fields change
+    Payload::Sample                              m_proto_header;
+    std::vector<char>                            m_serialized_proto_header;
     std::vector<char>                            m_header_buffer;
+    std::vector<std::pair<const char* const, const size_t>> m_send_vec;
 
     static std::mutex                            g_tcp_writer_executor_mtx;
     static std::shared_ptr<tcp_pubsub::Executor> g_tcp_writer_executor;
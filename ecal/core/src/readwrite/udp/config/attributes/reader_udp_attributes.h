@@ -34,6 +34,7 @@ namespace eCAL
         bool        broadcast;
         bool        loopback;
         int         receive_buffer;
+        bool        joined_groups_only;
       };
     }
   }
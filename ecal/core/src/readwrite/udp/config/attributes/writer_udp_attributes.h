@@ -30,16 +30,20 @@ namespace eCAL
     {
       struct SAttributes
       {
-        std::string address;
-        int         port;
-        int         ttl;
-        bool        broadcast;
-        bool        loopback;
-        int         send_buffer;
+        std::string  address;
+        int          port;
+        int          ttl;
+        bool         broadcast;
+        bool         loopback;
+        int          send_buffer;
 
-        std::string host_name;
-        std::string topic_name;
-        uint64_t    topic_id;
+        bool         coalescing_enable;
+        unsigned int coalescing_max_delay_us;
+        unsigned int coalescing_max_size;
+
+        std::string  host_name;
+        std::string  topic_name;
+        uint64_t     topic_id;
       };
     }
   }
@@ -34,6 +34,7 @@ namespace eCAL
         receiver_attr.rcvbuf    = attr_.receive_buffer;
         receiver_attr.port      = attr_.port;
         receiver_attr.address   = attr_.address;
+        receiver_attr.joined_groups_only = attr_.joined_groups_only;
 
         return receiver_attr;
       }
@@ -22,11 +22,13 @@
 **/
 
 #include <ecal/config.h>
+#include <ecal/log.h>
 
 #include "ecal_reader_udp.h"
 #include "ecal_global_accessors.h"
 
 #include "io/udp/ecal_udp_configurations.h"
+#include "io/udp/ecal_udp_sample_frame.h"
 #include "pubsub/ecal_subgate.h"
 #include "config/builder/udp_attribute_builder.h"
 
@@ -69,12 +71,21 @@ namespace eCAL
 
     // add topic name based multicast address
     const std::string mcast_address = UDP::GetTopicPayloadAddress(topic_name_);
-    if (m_topic_name_mcast_map.find(mcast_address) == m_topic_name_mcast_map.end())
+    auto group_iter = m_topic_name_mcast_map.find(mcast_address);
+    if (group_iter == m_topic_name_mcast_map.end())
     {
-      m_topic_name_mcast_map.emplace(std::pair<std::string, int>(mcast_address, 0));
+      group_iter = m_topic_name_mcast_map.emplace(mcast_address, std::map<std::string, int>()).first;
       m_payload_receiver->AddMultiCastGroup(mcast_address.c_str());
     }
-    m_topic_name_mcast_map[mcast_address]++;
+
+    auto& group_topics = group_iter->second;
+    if ((group_topics.find(topic_name_) == group_topics.end()) && !group_topics.empty())
+    {
+      // the samples of the other topics are received and dropped by their sample name,
+      // a larger topic group pool size avoids this
+      Logging::Log(Logging::log_level_debug1, "CUDPReaderLayer: Topic " + topic_name_ + " shares the multicast group " + mcast_address + " with " + std::to_string(group_topics.size()) + " other subscribed topic(s)");
+    }
+    group_topics[topic_name_]++;
   }
 
   void CUDPReaderLayer::RemSubscription(const std::string& /*host_name_*/, const std::string& topic_name_, const EntityIdT& /*topic_id_*/)
@@ -83,23 +94,40 @@ namespace eCAL
     if (m_attributes.broadcast) return;
 
     const std::string mcast_address = UDP::GetTopicPayloadAddress(topic_name_);
-    if (m_topic_name_mcast_map.find(mcast_address) == m_topic_name_mcast_map.end())
+    auto group_iter = m_topic_name_mcast_map.find(mcast_address);
+    if (group_iter == m_topic_name_mcast_map.end())
+    {
+      // this should never happen
+      return;
+    }
+
+    auto& group_topics = group_iter->second;
+    auto topic_iter = group_topics.find(topic_name_);
+    if (topic_iter == group_topics.end())
     {
       // this should never happen
+      return;
     }
-    else
+
+    if (--topic_iter->second == 0)
+    {
+      group_topics.erase(topic_iter);
+    }
+
+    if (group_topics.empty())
     {
-      m_topic_name_mcast_map[mcast_address]--;
-      if (m_topic_name_mcast_map[mcast_address] == 0)
-      {
-        m_payload_receiver->RemMultiCastGroup(mcast_address.c_str());
-        m_topic_name_mcast_map.erase(mcast_address);
-      }
+      m_payload_receiver->RemMultiCastGroup(mcast_address.c_str());
+      m_topic_name_mcast_map.erase(group_iter);
     }
   }
+
   bool CUDPReaderLayer::HasSample(const std::string& sample_name_)
   {
     if (g_subgate() == nullptr) return(false);
+
+    // frames may contain samples of any topic, the subgate picks the subscribed ones
+    if (sample_name_ == UDP::SampleFrameName) return(true);
+
     return(g_subgate()->HasSample(sample_name_));
   }
 
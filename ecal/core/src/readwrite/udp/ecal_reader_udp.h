@@ -56,7 +56,8 @@ namespace eCAL
 
     bool                                   m_started;
     std::shared_ptr<UDP::CSampleReceiver>  m_payload_receiver;
-    std::map<std::string, int>             m_topic_name_mcast_map;
+    // multicast group -> (topic name -> subscription count)
+    std::map<std::string, std::map<std::string, int>> m_topic_name_mcast_map;
 
     eCAL::eCALReader::UDP::SAttributes     m_attributes;
   };
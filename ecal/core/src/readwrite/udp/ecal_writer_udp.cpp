@@ -43,6 +43,16 @@ namespace eCAL
     // create udp/sample sender without activated loop-back
     m_attributes.loopback = false;
     m_sample_sender_no_loopback = std::make_shared<UDP::CSampleSender>(eCAL::eCALWriter::UDP::ConvertToIOUDPSenderAttributes(m_attributes));
+
+    // small samples are packed into frames shared with the other writers of this process
+    if (m_attributes.coalescing_enable)
+    {
+      m_attributes.loopback = true;
+      m_coalescer_loopback = CUDPSampleCoalescer::Get(m_attributes);
+
+      m_attributes.loopback = false;
+      m_coalescer_no_loopback = CUDPSampleCoalescer::Get(m_attributes);
+    }
   }
 
   SWriterInfo CDataWriterUdpMC::GetInfo()
@@ -86,19 +96,21 @@ namespace eCAL
     size_t sent = 0;
     if (SerializeToBuffer(ecal_sample, m_sample_buffer))
     {
-      if (attr_.loopback)
+      const auto& sample_sender = attr_.loopback ? m_sample_sender_loopback : m_sample_sender_no_loopback;
+      const auto& coalescer     = attr_.loopback ? m_coalescer_loopback     : m_coalescer_no_loopback;
+
+      if (coalescer)
       {
-        if (m_sample_sender_loopback)
-        {
-          sent = m_sample_sender_loopback->Send(ecal_sample.topic_info.topic_name, m_sample_buffer);
-        }
+        // queued for the next frame
+        if (coalescer->Add(ecal_sample.topic_info.topic_name, m_sample_buffer)) return true;
+
+        // too large for a frame, send the pending frame first to keep the order of our samples
+        coalescer->Flush();
       }
-      else
+
+      if (sample_sender)
       {
-        if (m_sample_sender_no_loopback)
-        {
-          sent = m_sample_sender_no_loopback->Send(ecal_sample.topic_info.topic_name, m_sample_buffer);
-        }
+        sent = sample_sender->Send(ecal_sample.topic_info.topic_name, m_sample_buffer);
       }
     }
 
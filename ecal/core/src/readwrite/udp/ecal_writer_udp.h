@@ -24,6 +24,7 @@
 #pragma once
 
 #include "io/udp/ecal_udp_sample_sender.h"
+#include "ecal_writer_udp_coalescer.h"
 #include "readwrite/ecal_writer_base.h"
 #include "config/attributes/writer_udp_attributes.h"
 
@@ -43,10 +44,12 @@ namespace eCAL
     bool Write(const void* buf_, const SWriterAttr& attr_) override;
 
   protected:
-    std::vector<char>                   m_sample_buffer;
-    std::shared_ptr<UDP::CSampleSender> m_sample_sender_loopback;
-    std::shared_ptr<UDP::CSampleSender> m_sample_sender_no_loopback;
+    std::vector<char>                    m_sample_buffer;
+    std::shared_ptr<UDP::CSampleSender>  m_sample_sender_loopback;
+    std::shared_ptr<UDP::CSampleSender>  m_sample_sender_no_loopback;
+    std::shared_ptr<CUDPSampleCoalescer> m_coalescer_loopback;
+    std::shared_ptr<CUDPSampleCoalescer> m_coalescer_no_loopback;
 
-    eCALWriter::UDP::SAttributes        m_attributes;
+    eCALWriter::UDP::SAttributes         m_attributes;
   };
 }
@@ -0,0 +1,180 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  udp sample coalescer
+**/
+
+#include <ecal/log.h>
+
+#include "ecal_writer_udp_coalescer.h"
+#include "io/udp/ecal_udp_sample_frame.h"
+#include "serialization/ecal_serialize_sample_payload.h"
+#include "util/ecal_thread_factory.h"
+
+#include "config/builder/udp_attribute_builder.h"
+
+#include <cstddef>
+
+namespace eCAL
+{
+  std::mutex                                                 CUDPSampleCoalescer::g_coalescer_map_mtx;
+  std::map<std::string, std::weak_ptr<CUDPSampleCoalescer>> CUDPSampleCoalescer::g_coalescer_map;
+
+  CUDPSampleCoalescer::CUDPSampleCoalescer(const eCALWriter::UDP::SAttributes& attr_) :
+    m_sample_sender(std::make_unique<UDP::CSampleSender>(eCAL::eCALWriter::UDP::ConvertToIOUDPSenderAttributes(attr_))),
+    m_max_delay(attr_.coalescing_max_delay_us),
+    m_max_size(attr_.coalescing_max_size)
+  {
+    m_frame_entries.reserve(m_max_size);
+    m_flush_thread = Threading::CreateThread(Threading::eThreadClass::udp, [this]() { FlushThread(); });
+  }
+
+  CUDPSampleCoalescer::~CUDPSampleCoalescer()
+  {
+    {
+      const std::lock_guard<std::mutex> lock(m_frame_mtx);
+      m_stop = true;
+    }
+    m_frame_cv.notify_one();
+
+    // the flush thread sends the pending frame before it returns
+    if (m_flush_thread.joinable()) m_flush_thread.join();
+  }
+
+  std::shared_ptr<CUDPSampleCoalescer> CUDPSampleCoalescer::Get(const eCALWriter::UDP::SAttributes& attr_)
+  {
+    const std::string key = attr_.address
+      + ":" + std::to_string(attr_.port)
+      + ":" + std::to_string(attr_.ttl)
+      + ":" + std::to_string(static_cast<int>(attr_.broadcast))
+      + ":" + std::to_string(static_cast<int>(attr_.loopback))
+      + ":" + std::to_string(attr_.send_buffer)
+      + ":" + std::to_string(attr_.coalescing_max_delay_us)
+      + ":" + std::to_string(attr_.coalescing_max_size);
+
+    const std::lock_guard<std::mutex> lock(g_coalescer_map_mtx);
+
+    auto& entry = g_coalescer_map[key];
+    std::shared_ptr<CUDPSampleCoalescer> coalescer = entry.lock();
+    if (!coalescer)
+    {
+      coalescer = std::make_shared<CUDPSampleCoalescer>(attr_);
+      entry = coalescer;
+    }
+
+    // remove the entries of coalescers no writer uses anymore
+    for (auto iter = g_coalescer_map.begin(); iter != g_coalescer_map.end();)
+    {
+      if (iter->second.expired()) iter = g_coalescer_map.erase(iter);
+      else                        ++iter;
+    }
+
+    return coalescer;
+  }
+
+  bool CUDPSampleCoalescer::Add(const std::string& topic_name_, const std::vector<char>& serialized_sample_)
+  {
+    const size_t entry_size = UDP::SampleFrameEntryHeaderSize + serialized_sample_.size();
+    if (entry_size > m_max_size) return false;
+
+    bool first_entry(false);
+    {
+      const std::lock_guard<std::mutex> lock(m_frame_mtx);
+
+      if (m_frame_entries.size() + entry_size > m_max_size) FlushLocked();
+
+      if (m_frame_entry_count == 0)
+      {
+        m_frame_first_topic_name = topic_name_;
+        m_frame_deadline         = std::chrono::steady_clock::now() + m_max_delay;
+        first_entry              = true;
+      }
+
+      UDP::AppendToSampleFrame(m_frame_entries, serialized_sample_.data(), serialized_sample_.size());
+      ++m_frame_entry_count;
+    }
+
+    // wake up the flush thread to wait for the deadline of the new frame
+    if (first_entry) m_frame_cv.notify_one();
+
+    return true;
+  }
+
+  void CUDPSampleCoalescer::Flush()
+  {
+    const std::lock_guard<std::mutex> lock(m_frame_mtx);
+    FlushLocked();
+  }
+
+  void CUDPSampleCoalescer::FlushLocked()
+  {
+    if (m_frame_entry_count == 0) return;
+
+    size_t sent = 0;
+    if (m_frame_entry_count == 1)
+    {
+      // a single sample does not need a frame, this keeps it readable for every subscriber
+      sent = m_sample_sender->Send(m_frame_first_topic_name, m_frame_entries.data() + UDP::SampleFrameEntryHeaderSize, m_frame_entries.size() - UDP::SampleFrameEntryHeaderSize);
+    }
+    else
+    {
+      Payload::Sample frame_sample;
+      frame_sample.cmd_type                      = eCmdType::bct_set_sample_frame;
+      frame_sample.topic_info.topic_name         = UDP::SampleFrameName;
+      frame_sample.content.payload.type          = Payload::pl_raw;
+      frame_sample.content.payload.raw_addr      = m_frame_entries.data();
+      frame_sample.content.payload.raw_size      = m_frame_entries.size();
+
+      if (SerializeToBuffer(frame_sample, m_frame_buffer))
+      {
+        sent = m_sample_sender->Send(UDP::SampleFrameName, m_frame_buffer);
+      }
+    }
+
+    m_frame_entries.clear();
+    m_frame_entry_count = 0;
+
+    if (sent == 0)
+    {
+      Logging::Log(Logging::log_level_fatal, "CUDPSampleCoalescer::Flush failed to send message frame !");
+    }
+  }
+
+  void CUDPSampleCoalescer::FlushThread()
+  {
+    std::unique_lock<std::mutex> lock(m_frame_mtx);
+    while (!m_stop)
+    {
+      if (m_frame_entry_count == 0)
+      {
+        m_frame_cv.wait(lock);
+      }
+      else if (std::chrono::steady_clock::now() >= m_frame_deadline)
+      {
+        FlushLocked();
+      }
+      else
+      {
+        m_frame_cv.wait_until(lock, m_frame_deadline);
+      }
+    }
+    FlushLocked();
+  }
+}
@@ -0,0 +1,95 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  udp sample coalescer
+**/
+
+#pragma once
+
+#include "io/udp/ecal_udp_sample_sender.h"
+#include "config/attributes/writer_udp_attributes.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace eCAL
+{
+  /**
+   * @brief Packs small samples of the udp data writers of this process into multi-sample frames.
+   *
+   * All writers sending to the same destination share one coalescer. A frame is sent when the
+   * next sample would exceed the maximum frame size, or when its first sample has been held back
+   * for the maximum delay. A frame containing a single sample is sent as a plain sample.
+  **/
+  class CUDPSampleCoalescer
+  {
+  public:
+    CUDPSampleCoalescer(const eCALWriter::UDP::SAttributes& attr_);
+    ~CUDPSampleCoalescer();
+
+    CUDPSampleCoalescer(const CUDPSampleCoalescer&) = delete;
+    CUDPSampleCoalescer& operator=(const CUDPSampleCoalescer&) = delete;
+
+    /**
+     * @brief Get the coalescer shared by all writers with the same destination and coalescing settings.
+    **/
+    static std::shared_ptr<CUDPSampleCoalescer> Get(const eCALWriter::UDP::SAttributes& attr_);
+
+    /**
+     * @brief Add a serialized sample to the current frame.
+     *
+     * @return False if the sample is too large for a frame, it has to be sent on its own then.
+    **/
+    bool Add(const std::string& topic_name_, const std::vector<char>& serialized_sample_);
+
+    /**
+     * @brief Send the current frame immediately.
+    **/
+    void Flush();
+
+  private:
+    void FlushLocked();
+    void FlushThread();
+
+    std::unique_ptr<UDP::CSampleSender>           m_sample_sender;
+    const std::chrono::microseconds               m_max_delay;
+    const size_t                                  m_max_size;
+
+    std::mutex                                    m_frame_mtx;
+    std::condition_variable                       m_frame_cv;
+    std::vector<char>                             m_frame_entries;
+    size_t                                        m_frame_entry_count = 0;
+    std::string                                   m_frame_first_topic_name;
+    std::chrono::steady_clock::time_point         m_frame_deadline;
+    std::vector<char>                             m_frame_buffer;
+    bool                                          m_stop = false;
+
+    std::thread                                   m_flush_thread;
+
+    static std::mutex                                                 g_coalescer_map_mtx;
+    static std::map<std::string, std::weak_ptr<CUDPSampleCoalescer>> g_coalescer_map;
+  };
+}
@@ -83,7 +83,7 @@ namespace eCAL
     }
 
     // start cyclic registration thread
-    m_reg_sample_snd_thread = std::make_shared<CCallbackThread>(std::bind(&CRegistrationProvider::RegisterSendThread, this));
+    m_reg_sample_snd_thread = std::make_shared<CCallbackThread>(std::bind(&CRegistrationProvider::RegisterSendThread, this), Threading::eThreadClass::registration);
     m_reg_sample_snd_thread->start(std::chrono::milliseconds(m_attributes.refresh));
 
     m_created = true;
@@ -90,7 +90,7 @@ namespace eCAL
       {
         m_timeout_provider->ApplySample(sample_);
       });
-    m_timeout_provider_thread = std::make_unique<CCallbackThread>([this]() {m_timeout_provider->CheckForTimeouts(); });
+    m_timeout_provider_thread = std::make_unique<CCallbackThread>([this]() {m_timeout_provider->CheckForTimeouts(); }, Threading::eThreadClass::registration);
     m_timeout_provider_thread->start(std::chrono::milliseconds(100));
 
 #if ECAL_CORE_REGISTRATION_SHM
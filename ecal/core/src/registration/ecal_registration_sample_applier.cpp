@@ -19,6 +19,9 @@
 
 #include "registration/ecal_registration_sample_applier.h"
 
+#include "ecal_descgate.h"
+#include "ecal_global_accessors.h"
+
 namespace eCAL
 {
   namespace Registration
@@ -39,17 +42,40 @@ namespace eCAL
         return false;
       }
 
-      // forward all registration samples to outside "customer" (e.g. monitoring, descgate, pub/subgate/client/service gates)
+      // the sender omitted its datatype descriptor and only announced the hash,
+      // complete the sample from the shared descriptor store if anyone holds it
+      if (IsDescriptorOmitted(sample_) && (g_descgate() != nullptr))
       {
-        const std::lock_guard<std::mutex> lock(m_callback_custom_apply_sample_map_mtx);
-        for (const auto& iter : m_callback_custom_apply_sample_map)
+        auto descriptor = g_descgate()->GetDescriptorStore().Find(sample_.topic.descriptor_hash);
+        if (descriptor)
         {
-          iter.second(sample_);
+          Registration::Sample completed_sample(sample_);
+          completed_sample.topic.datatype_information.descriptor = *descriptor;
+          ForwardSample(completed_sample);
+          return true;
         }
       }
+
+      ForwardSample(sample_);
       return true;
     }
 
+    bool CSampleApplier::IsDescriptorOmitted(const Registration::Sample& sample_)
+    {
+      if ((sample_.cmd_type != bct_reg_publisher) && (sample_.cmd_type != bct_reg_subscriber)) return false;
+      return (sample_.topic.descriptor_hash != 0) && sample_.topic.datatype_information.descriptor.empty();
+    }
+
+    void CSampleApplier::ForwardSample(const Registration::Sample& sample_)
+    {
+      // forward all registration samples to outside "customer" (e.g. monitoring, descgate, pub/subgate/client/service gates)
+      const std::lock_guard<std::mutex> lock(m_callback_custom_apply_sample_map_mtx);
+      for (const auto& iter : m_callback_custom_apply_sample_map)
+      {
+        iter.second(sample_);
+      }
+    }
+
     bool CSampleApplier::IsShmTransportDomainMember(const Registration::Sample& sample_) const
     {
       // When are we in the same domain?
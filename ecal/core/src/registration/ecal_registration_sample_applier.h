@@ -60,6 +60,9 @@ namespace eCAL
 
       bool AcceptRegistrationSample(const Registration::Sample& sample_);
 
+      static bool IsDescriptorOmitted(const Registration::Sample& sample_);
+      void ForwardSample(const Registration::Sample& sample_);
+
       SampleApplier::SAttributes                  m_attributes;
 
       std::mutex                                  m_callback_custom_apply_sample_map_mtx;
@@ -51,7 +51,7 @@ namespace eCAL
     // This is a bit unclean to take the raw adress of the reader here.
     m_memfile_broadcast_reader->Bind(m_memfile_broadcast.get());
 
-    m_memfile_broadcast_reader_thread = std::make_unique<CCallbackThread>(std::bind(&CRegistrationReceiverSHM::Receive, this));
+    m_memfile_broadcast_reader_thread = std::make_unique<CCallbackThread>(std::bind(&CRegistrationReceiverSHM::Receive, this), Threading::eThreadClass::registration);
     m_memfile_broadcast_reader_thread->start(std::chrono::milliseconds(Config::GetRegistrationRefreshMs() / 2));
   }
 
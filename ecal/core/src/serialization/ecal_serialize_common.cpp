@@ -25,6 +25,7 @@
 #include "nanopb/ecal/core/pb/ecal.npb.h"
 #include "nanopb/pb_decode.h"
 #include "nanopb/pb_encode.h"
+#include <array>
 #include <cstddef>
 #include <map>
 #include <string>
@@ -85,9 +86,17 @@ namespace eCAL
       if (!pb_encode_tag_for_field(stream, field))
         return false;
 
+      // convert on the stack, std::to_string allocates for most 64 bit ids
       auto* int_value = static_cast<uint64_t*>(*arg);
-      auto integer_value_as_string = std::to_string(*int_value);
-      return pb_encode_string(stream, (pb_byte_t*)(integer_value_as_string.data()), integer_value_as_string.size()); // NOLINT(*-pro-type-cstyle-cast)
+      std::array<char, 20> digits{};
+      size_t   pos   = digits.size();
+      uint64_t value = *int_value;
+      do
+      {
+        digits[--pos] = static_cast<char>('0' + (value % 10));
+        value /= 10;
+      } while (value != 0);
+      return pb_encode_string(stream, (pb_byte_t*)(digits.data() + pos), digits.size() - pos); // NOLINT(*-pro-type-cstyle-cast)
     }
 
     void encode_int_to_string(pb_callback_t& pb_callback, const uint64_t& int_argument)
@@ -176,6 +176,8 @@ namespace
     eCAL::nanopb::encode_string(pb_topic_.datatype_information.encoding, registration_topic_.datatype_information.encoding);
     // datatype_information.descriptor
     eCAL::nanopb::encode_string(pb_topic_.datatype_information.descriptor_information, registration_topic_.datatype_information.descriptor);
+    // datatype_information.descriptor_hash
+    pb_topic_.datatype_information.descriptor_hash = registration_topic_.descriptor_hash;
     // topic_size
     pb_topic_.topic_size = registration_topic_.topic_size;
     // connections_local
@@ -190,6 +192,10 @@ namespace
     pb_topic_.data_clock = registration_topic_.data_clock;
     // data_frequency
     pb_topic_.data_frequency = registration_topic_.data_frequency;
+    // receive_max_frequency
+    pb_topic_.receive_max_frequency = registration_topic_.receive_max_frequency;
+    // receive_downsampling
+    pb_topic_.receive_downsampling = registration_topic_.receive_downsampling;
     // transport_layer
     eCAL::nanopb::encode_registration_layer(pb_topic_.transport_layer, registration_topic_.transport_layer);
   }
@@ -462,6 +468,12 @@ namespace
       registration_.topic.data_clock = pb_sample_.topic.data_clock;
       // data_frequency
       registration_.topic.data_frequency = pb_sample_.topic.data_frequency;
+      // receive_max_frequency
+      registration_.topic.receive_max_frequency = pb_sample_.topic.receive_max_frequency;
+      // receive_downsampling
+      registration_.topic.receive_downsampling = pb_sample_.topic.receive_downsampling;
+      // datatype_information.descriptor_hash
+      registration_.topic.descriptor_hash = pb_sample_.topic.datatype_information.descriptor_hash;
       break;
     default:
     break;
@@ -39,7 +39,9 @@ namespace eCAL
     bct_unreg_subscriber = 13,
     bct_unreg_process    = 14,
     bct_unreg_service    = 15, // TODO: should be named server!
-    bct_unreg_client     = 16
+    bct_unreg_client     = 16,
+
+    bct_set_sample_frame = 20  // multiple set sample contents packed into one frame
   };
 
   enum eTLayerType
@@ -266,6 +266,7 @@ namespace eCAL
       std::string                         topic_name;                   // topic name
       std::string                         direction;                    // direction (publisher, subscriber)
       SDataTypeInformation                datatype_information;         // topic datatype information (encoding & type & description)
+      uint64_t                            descriptor_hash = 0;          // content hash of the datatype descriptor (descriptor may be omitted if it is set)
 
       Util::CExpandingVector<TLayer>      transport_layer;              // active topic transport layers and its specific parameter
       int32_t                             topic_size = 0;               // topic size
@@ -278,6 +279,8 @@ namespace eCAL
       int64_t                             data_clock = 0;               // data clock (send / receive action)
       int32_t                             data_frequency  = 0;                   // data frequency (send / receive registrations per second) [mHz]
 
+      int32_t                             receive_max_frequency = 0;    // maximum receive rate requested by a subscriber [mHz], 0 = no limit
+      int32_t                             receive_downsampling  = 0;    // subscriber receives every n-th sample only, 0 or 1 = every sample
 
       bool operator==(const Topic& other) const {
         return registration_clock == other.registration_clock &&
@@ -287,6 +290,7 @@ namespace eCAL
           topic_name == other.topic_name &&
           direction == other.direction &&
           datatype_information == other.datatype_information &&
+          descriptor_hash == other.descriptor_hash &&
           transport_layer == other.transport_layer &&
           topic_size == other.topic_size &&
           connections_local == other.connections_local &&
@@ -294,7 +298,9 @@ namespace eCAL
           message_drops == other.message_drops &&
           data_id == other.data_id &&
           data_clock == other.data_clock &&
-          data_frequency == other.data_frequency;
+          data_frequency == other.data_frequency &&
+          receive_max_frequency == other.receive_max_frequency &&
+          receive_downsampling == other.receive_downsampling;
       }
 
       void clear()
@@ -306,6 +312,7 @@ namespace eCAL
         topic_name.clear();
         direction.clear();
         datatype_information.clear();
+        descriptor_hash = 0;
 
         transport_layer.clear();
         topic_size = 0;
@@ -317,6 +324,9 @@ namespace eCAL
         data_id = 0;
         data_clock = 0;
         data_frequency = 0;
+
+        receive_max_frequency = 0;
+        receive_downsampling = 0;
       }
     };
 
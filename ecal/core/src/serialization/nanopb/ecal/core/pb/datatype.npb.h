@@ -14,6 +14,7 @@ typedef struct _eCAL_pb_DataTypeInformation {
     pb_callback_t name; /* name of the datatype */
     pb_callback_t encoding; /* encoding of the datatype (e.g. protobuf, flatbuffers, capnproto) */
     pb_callback_t descriptor_information; /* descriptor information of the datatype (necessary for reflection) */
+    uint64_t descriptor_hash; /* content hash of the descriptor information, which may be omitted if the receiver knows it already */
 } eCAL_pb_DataTypeInformation;
 
 
@@ -22,19 +23,21 @@ extern "C" {
 #endif
 
 /* Initializer values for message structs */
-#define eCAL_pb_DataTypeInformation_init_default {{{NULL}, NULL}, {{NULL}, NULL}, {{NULL}, NULL}}
-#define eCAL_pb_DataTypeInformation_init_zero    {{{NULL}, NULL}, {{NULL}, NULL}, {{NULL}, NULL}}
+#define eCAL_pb_DataTypeInformation_init_default {{{NULL}, NULL}, {{NULL}, NULL}, {{NULL}, NULL}, 0}
+#define eCAL_pb_DataTypeInformation_init_zero    {{{NULL}, NULL}, {{NULL}, NULL}, {{NULL}, NULL}, 0}
 
 /* Field tags (for use in manual encoding/decoding) */
 #define eCAL_pb_DataTypeInformation_name_tag     1
 #define eCAL_pb_DataTypeInformation_encoding_tag 2
 #define eCAL_pb_DataTypeInformation_descriptor_information_tag 3
+#define eCAL_pb_DataTypeInformation_descriptor_hash_tag 4
 
 /* Struct field encoding specification for nanopb */
 #define eCAL_pb_DataTypeInformation_FIELDLIST(X, a) \
 X(a, CALLBACK, SINGULAR, STRING,   name,              1) \
 X(a, CALLBACK, SINGULAR, STRING,   encoding,          2) \
-X(a, CALLBACK, SINGULAR, BYTES,    descriptor_information,   3)
+X(a, CALLBACK, SINGULAR, BYTES,    descriptor_information,   3) \
+X(a, STATIC,   SINGULAR, FIXED64,  descriptor_hash,   4)
 #define eCAL_pb_DataTypeInformation_CALLBACK pb_default_field_callback
 #define eCAL_pb_DataTypeInformation_DEFAULT NULL
 
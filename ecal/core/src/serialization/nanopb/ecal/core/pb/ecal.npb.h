@@ -27,7 +27,8 @@ typedef enum _eCAL_pb_eCmdType { /* Reserved fields in enums are not supported i
     eCAL_pb_eCmdType_bct_unreg_subscriber = 13, /* unregister subscriber */
     eCAL_pb_eCmdType_bct_unreg_process = 14, /* unregister process */
     eCAL_pb_eCmdType_bct_unreg_service = 15, /* unregister service */
-    eCAL_pb_eCmdType_bct_unreg_client = 16 /* unregister client */
+    eCAL_pb_eCmdType_bct_unreg_client = 16, /* unregister client */
+    eCAL_pb_eCmdType_bct_set_sample_frame = 20 /* multiple set sample contents packed into one frame */
 } eCAL_pb_eCmdType;
 
 /* Struct definitions */
@@ -69,8 +70,8 @@ extern "C" {
 
 /* Helper constants for enums */
 #define _eCAL_pb_eCmdType_MIN eCAL_pb_eCmdType_bct_none
-#define _eCAL_pb_eCmdType_MAX eCAL_pb_eCmdType_bct_unreg_client
-#define _eCAL_pb_eCmdType_ARRAYSIZE ((eCAL_pb_eCmdType)(eCAL_pb_eCmdType_bct_unreg_client+1))
+#define _eCAL_pb_eCmdType_MAX eCAL_pb_eCmdType_bct_set_sample_frame
+#define _eCAL_pb_eCmdType_ARRAYSIZE ((eCAL_pb_eCmdType)(eCAL_pb_eCmdType_bct_set_sample_frame+1))
 
 
 #define eCAL_pb_Sample_cmd_type_ENUMTYPE eCAL_pb_eCmdType
@@ -35,6 +35,8 @@ typedef struct _eCAL_pb_Topic { /* Reserved fields in enums are not supported in
  10 = topic description (protocol descriptor) (deprecated) */
     bool has_datatype_information;
     eCAL_pb_DataTypeInformation datatype_information; /* topic datatype information (encoding & type & description) */
+    int32_t receive_max_frequency; /* maximum receive rate requested by a subscriber [mHz], 0 = no limit */
+    int32_t receive_downsampling; /* subscriber receives every n-th sample only, 0 or 1 = every sample */
 } eCAL_pb_Topic;
 
 
@@ -43,8 +45,8 @@ extern "C" {
 #endif
 
 /* Initializer values for message structs */
-#define eCAL_pb_Topic_init_default               {0, {{NULL}, NULL}, 0, {{NULL}, NULL}, {{NULL}, NULL}, {{NULL}, NULL}, {{NULL}, NULL}, {{NULL}, NULL}, {{NULL}, NULL}, 0, 0, 0, 0, 0, 0, 0, {{NULL}, NULL}, false, eCAL_pb_DataTypeInformation_init_default}
-#define eCAL_pb_Topic_init_zero                  {0, {{NULL}, NULL}, 0, {{NULL}, NULL}, {{NULL}, NULL}, {{NULL}, NULL}, {{NULL}, NULL}, {{NULL}, NULL}, {{NULL}, NULL}, 0, 0, 0, 0, 0, 0, 0, {{NULL}, NULL}, false, eCAL_pb_DataTypeInformation_init_zero}
+#define eCAL_pb_Topic_init_default               {0, {{NULL}, NULL}, 0, {{NULL}, NULL}, {{NULL}, NULL}, {{NULL}, NULL}, {{NULL}, NULL}, {{NULL}, NULL}, {{NULL}, NULL}, 0, 0, 0, 0, 0, 0, 0, {{NULL}, NULL}, false, eCAL_pb_DataTypeInformation_init_default, 0, 0}
+#define eCAL_pb_Topic_init_zero                  {0, {{NULL}, NULL}, 0, {{NULL}, NULL}, {{NULL}, NULL}, {{NULL}, NULL}, {{NULL}, NULL}, {{NULL}, NULL}, {{NULL}, NULL}, 0, 0, 0, 0, 0, 0, 0, {{NULL}, NULL}, false, eCAL_pb_DataTypeInformation_init_zero, 0, 0}
 
 /* Field tags (for use in manual encoding/decoding) */
 #define eCAL_pb_Topic_registration_clock_tag     1
@@ -65,6 +67,8 @@ extern "C" {
 #define eCAL_pb_Topic_data_frequency_tag         21
 #define eCAL_pb_Topic_shm_transport_domain_tag   28
 #define eCAL_pb_Topic_datatype_information_tag   30
+#define eCAL_pb_Topic_receive_max_frequency_tag  31
+#define eCAL_pb_Topic_receive_downsampling_tag   32
 
 /* Struct field encoding specification for nanopb */
 #define eCAL_pb_Topic_FIELDLIST(X, a) \
@@ -85,7 +89,9 @@ X(a, STATIC,   SINGULAR, INT64,    data_id,          19) \
 X(a, STATIC,   SINGULAR, INT64,    data_clock,       20) \
 X(a, STATIC,   SINGULAR, INT32,    data_frequency,   21) \
 X(a, CALLBACK, SINGULAR, STRING,   shm_transport_domain,  28) \
-X(a, STATIC,   OPTIONAL, MESSAGE,  datatype_information,  30)
+X(a, STATIC,   OPTIONAL, MESSAGE,  datatype_information,  30) \
+X(a, STATIC,   SINGULAR, INT32,    receive_max_frequency,  31) \
+X(a, STATIC,   SINGULAR, INT32,    receive_downsampling,  32)
 #define eCAL_pb_Topic_CALLBACK pb_default_field_callback
 #define eCAL_pb_Topic_DEFAULT NULL
 #define eCAL_pb_Topic_transport_layer_MSGTYPE eCAL_pb_TransportLayer
@@ -18,6 +18,7 @@
 */
 
 #include "ecal_service_singleton_manager.h"
+#include "util/ecal_thread_factory.h"
 
 #include <cstddef>
 #include <ecal/log.h>
@@ -110,7 +111,7 @@ namespace eCAL
         {
           for (size_t i = 0; i < num_io_threads; i++)
           {
-            m_io_threads.emplace_back(std::make_unique<std::thread>([this]() { m_io_context->run(); }));
+            m_io_threads.emplace_back(std::make_unique<std::thread>(Threading::CreateThread(Threading::eThreadClass::service, [this]() { m_io_context->run(); })));
           }
         }
         
@@ -147,7 +148,7 @@ namespace eCAL
         {
           for (size_t i = 0; i < num_io_threads; i++)
           {
-            m_io_threads.emplace_back(std::make_unique<std::thread>([this]() { m_io_context->run(); }));
+            m_io_threads.emplace_back(std::make_unique<std::thread>(Threading::CreateThread(Threading::eThreadClass::service, [this]() { m_io_context->run(); })));
           }
         }
         
@@ -23,6 +23,8 @@
 
 #include <ecal/ecal.h>
 
+#include "util/ecal_thread_factory.h"
+
 #include <atomic>
 #include <cassert>
 #include <chrono>
@@ -50,7 +52,7 @@ namespace eCAL
       if(m_running)    return(false);
       if(timeout_ < 0) return(false);
       m_stop = false;
-      m_thread = std::thread(&CTimerImpl::Thread, this, callback_, timeout_, delay_);
+      m_thread = Threading::CreateThread(Threading::eThreadClass::timer, [this, callback_, timeout_, delay_]() { Thread(callback_, timeout_, delay_); });
       m_running = true;
       return(true);
     }
@@ -27,6 +27,8 @@
 #include <mutex>
 #include <thread>
 
+#include "ecal_thread_factory.h"
+
 #pragma once
 
 namespace eCAL
@@ -39,10 +41,11 @@ namespace eCAL
   public:
     /**
      * @brief Constructor for the CallbackThread class.
-     * @param callback A callback function to be executed in the CallbackThread thread.
+     * @param callback     A callback function to be executed in the CallbackThread thread.
+     * @param thread_class The thread class, whose policy is applied to the thread.
      */
-    CCallbackThread(std::function<void()> callback)
-      : callback_(callback) {}
+    CCallbackThread(std::function<void()> callback, Threading::eThreadClass thread_class)
+      : callback_(callback), threadClass_(thread_class) {}
 
     ~CCallbackThread()
     {
@@ -61,7 +64,7 @@ namespace eCAL
     template <typename DurationType>
     void start(DurationType timeout)
     {
-      callbackThread_ = std::thread(&CCallbackThread::callbackFunction<DurationType>, this, timeout);
+      callbackThread_ = Threading::CreateThread(threadClass_, [this, timeout]() { callbackFunction<DurationType>(timeout); });
     }
 
     /**
@@ -102,6 +105,7 @@ namespace eCAL
   private:
     std::thread callbackThread_;      /**< The callback thread object. */
     std::function<void()> callback_;  /**< The callback function to be executed in the callback thread. */
+    Threading::eThreadClass threadClass_; /**< The thread class, whose policy is applied to the callback thread. */
     std::mutex mtx_;                  /**< Mutex for thread synchronization. */
     std::condition_variable cv_;      /**< Condition variable for signaling between threads. */
     bool stopThread_{ false };          /**< Flag to indicate whether the callback thread should stop. */
@@ -0,0 +1,155 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  eCAL thread factory, applies the configured thread policies
+**/
+
+#include "ecal_thread_factory.h"
+
+#include <ecal/config.h>
+#include <ecal/log.h>
+#include <ecal/os.h>
+
+#include <cstring>
+#include <string>
+
+#ifdef ECAL_OS_WINDOWS
+#include "ecal_win_main.h"
+#endif
+
+#ifdef ECAL_OS_LINUX
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace
+{
+  const eCAL::Threading::Policy& GetPolicy(eCAL::Threading::eThreadClass thread_class_)
+  {
+    const auto& threading = eCAL::GetConfiguration().threading;
+    switch (thread_class_)
+    {
+    case eCAL::Threading::eThreadClass::registration: return threading.registration;
+    case eCAL::Threading::eThreadClass::shm:          return threading.shm;
+    case eCAL::Threading::eThreadClass::udp:          return threading.udp;
+    case eCAL::Threading::eThreadClass::tcp:          return threading.tcp;
+    case eCAL::Threading::eThreadClass::service:      return threading.service;
+    case eCAL::Threading::eThreadClass::timer:        return threading.timer;
+    default:                                          return threading.registration;
+    }
+  }
+
+  void LogFailure(const eCAL::Threading::Policy& policy_, const std::string& setting_, int error_)
+  {
+    eCAL::Logging::Log(eCAL::Logging::log_level_warning, "Threading: Unable to set the " + setting_ + " of thread \"" + policy_.name + "\" (error " + std::to_string(error_) + ")");
+  }
+
+#ifdef ECAL_OS_WINDOWS
+  void ApplyName(const eCAL::Threading::Policy& policy_)
+  {
+    // SetThreadDescription is available since Windows 10 1607 only, so it is looked up at runtime
+    using SetThreadDescriptionT = HRESULT (WINAPI*)(HANDLE, PCWSTR);
+    static const auto set_thread_description = reinterpret_cast<SetThreadDescriptionT>(reinterpret_cast<void*>(GetProcAddress(GetModuleHandleW(L"kernel32.dll"), "SetThreadDescription")));
+    if (set_thread_description == nullptr) return;
+
+    const std::wstring name(policy_.name.begin(), policy_.name.end());
+    set_thread_description(GetCurrentThread(), name.c_str());
+  }
+
+  void ApplyCpuSet(const eCAL::Threading::Policy& policy_)
+  {
+    DWORD_PTR mask(0);
+    for (const unsigned int cpu : policy_.cpu_set)
+    {
+      if (cpu < sizeof(DWORD_PTR) * 8) mask |= (static_cast<DWORD_PTR>(1) << cpu);
+    }
+    if (mask == 0 || SetThreadAffinityMask(GetCurrentThread(), mask) == 0)
+    {
+      LogFailure(policy_, "CPU set", static_cast<int>(GetLastError()));
+    }
+  }
+
+  void ApplyPriority(const eCAL::Threading::Policy& policy_)
+  {
+    // SCHED_FIFO priorities have no Windows counterpart
+    LogFailure(policy_, "priority", 0);
+  }
+#endif
+
+#ifdef ECAL_OS_LINUX
+  void ApplyName(const eCAL::Threading::Policy& policy_)
+  {
+#if defined(__linux__)
+    // Linux thread names are limited to 15 characters
+    const std::string name = policy_.name.substr(0, 15);
+    pthread_setname_np(pthread_self(), name.c_str());
+#elif defined(__APPLE__)
+    pthread_setname_np(policy_.name.c_str());
+#else
+    (void)policy_;
+#endif
+  }
+
+  void ApplyCpuSet(const eCAL::Threading::Policy& policy_)
+  {
+#if defined(__linux__)
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    for (const unsigned int cpu : policy_.cpu_set)
+    {
+      if (cpu < CPU_SETSIZE) CPU_SET(cpu, &cpu_set);
+    }
+    const int error = pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set);
+    if (error != 0) LogFailure(policy_, "CPU set", error);
+#else
+    LogFailure(policy_, "CPU set", 0);
+#endif
+  }
+
+  void ApplyPriority(const eCAL::Threading::Policy& policy_)
+  {
+#if defined(__linux__)
+    sched_param param;
+    std::memset(&param, 0, sizeof(param));
+    param.sched_priority = static_cast<int>(policy_.priority);
+    const int error = pthread_setschedparam(pthread_self(), SCHED_FIFO, &param);
+    if (error != 0) LogFailure(policy_, "SCHED_FIFO priority", error);
+#else
+    // realtime priorities are supported on Linux only
+    LogFailure(policy_, "priority", 0);
+#endif
+  }
+#endif
+}
+
+namespace eCAL
+{
+  namespace Threading
+  {
+    void ApplyPolicy(eThreadClass thread_class_)
+    {
+      const Policy& policy = GetPolicy(thread_class_);
+
+      if (!policy.name.empty())    ApplyName(policy);
+      if (!policy.cpu_set.empty()) ApplyCpuSet(policy);
+      if (policy.priority > 0)     ApplyPriority(policy);
+    }
+  }
+}
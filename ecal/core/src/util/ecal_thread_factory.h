@@ -0,0 +1,76 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  eCAL thread factory, applies the configured thread policies
+**/
+
+#pragma once
+
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+namespace eCAL
+{
+  namespace Threading
+  {
+    /**
+     * @brief The classes of eCAL internal threads, each one has its own policy in eCAL::Threading::Configuration.
+     */
+    enum class eThreadClass
+    {
+      registration,
+      shm,
+      udp,
+      tcp,
+      service,
+      timer,
+    };
+
+    /**
+     * @brief Applies the configured policy (name, CPU set, priority) of the thread class to the calling thread.
+     *        Settings that can not be applied are logged, the thread keeps running with its current settings.
+     */
+    void ApplyPolicy(eThreadClass thread_class_);
+
+    /**
+     * @brief Creates a thread that applies the policy of its thread class before running function_.
+     *        All eCAL internal threads should be created by this function.
+     */
+    template <typename Function>
+    std::thread CreateThread(eThreadClass thread_class_, Function&& function_)
+    {
+      using FunctionT = typename std::decay<Function>::type;
+      return std::thread([thread_class_](FunctionT function) { ApplyPolicy(thread_class_); function(); }, std::forward<Function>(function_));
+    }
+
+    /**
+     * @brief Runs function_ in a thread with the policy of the thread class and waits for it.
+     *        Threads created by function_ inherit name, CPU set and priority on Linux, this is
+     *        used for threads of libraries that do not offer a hook for their thread creation.
+     */
+    template <typename Function>
+    void RunInThread(eThreadClass thread_class_, Function&& function_)
+    {
+      std::thread thread = CreateThread(thread_class_, std::forward<Function>(function_));
+      thread.join();
+    }
+  }
+}
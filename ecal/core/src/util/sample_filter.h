@@ -0,0 +1,93 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#pragma once
+
+#include <cstdint>
+
+namespace eCAL
+{
+  /*
+  * Decides which samples of one publisher a rate limited or downsampling
+  * subscriber receives.
+  *
+  * The decision only depends on the publisher clock and the send time of a
+  * sample. So the publisher, that skips samples for the subscriber, and the
+  * subscriber, that drops samples it got anyway (e.g. because another
+  * subscriber on the same multicast group needs them), select the same samples.
+  *
+  * There is no "latest only" mode: whether a sample is superseded depends on
+  * how fast the subscriber consumes, which the publisher does not know when it
+  * sends. Over SHM a busy subscriber reads the current memory file content
+  * when it gets to it and so skips superseded samples anyway, UDP and TCP
+  * deliver every sample handed to the socket in order.
+  *
+  * Not thread-safe
+  */
+  class SampleFilter
+  {
+  public:
+    SampleFilter() = default;
+
+    // max_frequency_mhz_: maximum rate in mHz, 0 = no limit
+    // downsampling_:      accept every n-th sample only, 0 or 1 = every sample
+    SampleFilter(unsigned int max_frequency_mhz_, unsigned int downsampling_)
+      : max_frequency_mhz(max_frequency_mhz_)
+      , downsampling(downsampling_ > 1 ? downsampling_ : 1)
+      , period_us(max_frequency_mhz_ > 0 ? 1000000000LL / max_frequency_mhz_ : 0)
+    {}
+
+    bool IsActive() const { return (downsampling > 1) || (period_us > 0); }
+
+    unsigned int GetMaxFrequency() const { return max_frequency_mhz; }
+    unsigned int GetDownsampling() const { return downsampling; }
+
+    // Takes over the settings of other_, the state is kept if the settings did not change
+    void Reconfigure(const SampleFilter& other_)
+    {
+      if ((other_.max_frequency_mhz == max_frequency_mhz) && (other_.downsampling == downsampling)) return;
+      *this = other_;
+    }
+
+    // clock_: publisher send clock
+    // time_:  send time of the sample [us]
+    bool Accept(long long clock_, long long time_)
+    {
+      if ((downsampling > 1) && (static_cast<uint64_t>(clock_) % downsampling != 0)) return false;
+
+      if (period_us > 0)
+      {
+        // a send time running backwards (e.g. a restarted replay) restarts the rate limit
+        if (has_last_time && (time_ >= last_time) && (time_ - last_time < period_us)) return false;
+        last_time     = time_;
+        has_last_time = true;
+      }
+
+      return true;
+    }
+
+  private:
+    unsigned int max_frequency_mhz = 0;
+    unsigned int downsampling      = 1;
+    long long    period_us         = 0;
+
+    long long    last_time         = 0;
+    bool         has_last_time     = false;
+  };
+}
@@ -44,6 +44,8 @@ TEST(core_cpp_config_yaml /*unused*/, yaml_processing_comparison /*unused*/)
     config.registration.registration_refresh = 500;
     config.registration.registration_timeout = 2000;
     config.registration.loopback = false;
+    config.registration.fast_discovery = true;
+    config.registration.descriptor_refresh = 10;
     config.registration.shm_transport_domain = "shm_transport_domain";
     config.registration.local.transport_type = eCAL::Registration::Local::eTransportType::shm;
     config.registration.local.shm.domain = "ecal_don";
@@ -60,6 +62,7 @@ TEST(core_cpp_config_yaml /*unused*/, yaml_processing_comparison /*unused*/)
     config.transport_layer.udp.receive_buffer = 6242881;
     config.transport_layer.udp.join_all_interfaces = true;
     config.transport_layer.udp.npcap_enabled = true;
+    config.transport_layer.udp.topic_group_pool_size = 256;
     config.transport_layer.udp.local.group = "129.255.255.254";
     config.transport_layer.udp.local.ttl = 7;
     config.transport_layer.udp.network.group = "238.1.2.3";
@@ -74,7 +77,13 @@ TEST(core_cpp_config_yaml /*unused*/, yaml_processing_comparison /*unused*/)
     config.publisher.layer.shm.memfile_buffer_count = 13;
     config.publisher.layer.shm.memfile_min_size_bytes = 8192;
     config.publisher.layer.shm.memfile_reserve_percent = 14;
+    config.publisher.layer.shm.memfile_memfd = true;
+    config.publisher.layer.shm.memfile_huge_pages = true;
+    config.publisher.layer.shm.memfile_prefault = true;
     config.publisher.layer.udp.enable = false;
+    config.publisher.layer.udp.coalescing_enable = true;
+    config.publisher.layer.udp.coalescing_max_delay_us = 500;
+    config.publisher.layer.udp.coalescing_max_size = 8000;
     config.publisher.layer.tcp.enable = false;
     config.publisher.layer_priority_local = {eCAL::TransportLayer::eType::tcp, eCAL::TransportLayer::eType::shm, eCAL::TransportLayer::eType::udp_mc};
     config.publisher.layer_priority_remote = {eCAL::TransportLayer::eType::tcp, eCAL::TransportLayer::eType::udp_mc};
@@ -83,6 +92,8 @@ TEST(core_cpp_config_yaml /*unused*/, yaml_processing_comparison /*unused*/)
     config.subscriber.layer.udp.enable = false;
     config.subscriber.layer.tcp.enable = true;
     config.subscriber.drop_out_of_order_messages = false;
+    config.subscriber.max_frequency_mhz = 2500;
+    config.subscriber.downsampling = 4;
 
     config.timesync.timesync_module_replay = "my_replay";
     config.timesync.timesync_module_rt = "my_rt";
@@ -101,6 +112,12 @@ TEST(core_cpp_config_yaml /*unused*/, yaml_processing_comparison /*unused*/)
     config.logging.receiver.enable = true;
     config.logging.receiver.udp_config.port = 19000;
 
+    config.threading.registration.name = "reg_thread";
+    config.threading.registration.cpu_set = { 0, 1 };
+    config.threading.shm.priority = 42;
+    config.threading.udp.name = "";
+    config.threading.timer.cpu_set = { 7 };
+
     const auto yaml_string = eCAL::Config::getConfigAsYamlSS(config);
     eCAL::Configuration config_from_yaml;
     eCAL::Config::YamlStringToConfig(yaml_string.str(), config_from_yaml);
@@ -109,6 +126,8 @@ TEST(core_cpp_config_yaml /*unused*/, yaml_processing_comparison /*unused*/)
     EXPECT_EQ(config.registration.registration_refresh, config_from_yaml.registration.registration_refresh);
     EXPECT_EQ(config.registration.registration_timeout, config_from_yaml.registration.registration_timeout);
     EXPECT_EQ(config.registration.loopback, config_from_yaml.registration.loopback);
+    EXPECT_EQ(config.registration.fast_discovery, config_from_yaml.registration.fast_discovery);
+    EXPECT_EQ(config.registration.descriptor_refresh, config_from_yaml.registration.descriptor_refresh);
     EXPECT_EQ(config.registration.shm_transport_domain, config_from_yaml.registration.shm_transport_domain);
     EXPECT_EQ(config.registration.local.transport_type, config_from_yaml.registration.local.transport_type);
     EXPECT_EQ(config.registration.local.shm.domain, config_from_yaml.registration.local.shm.domain);
@@ -123,6 +142,7 @@ TEST(core_cpp_config_yaml /*unused*/, yaml_processing_comparison /*unused*/)
     EXPECT_EQ(config.transport_layer.udp.receive_buffer, config_from_yaml.transport_layer.udp.receive_buffer);
     EXPECT_EQ(config.transport_layer.udp.join_all_interfaces, config_from_yaml.transport_layer.udp.join_all_interfaces);
     EXPECT_EQ(config.transport_layer.udp.npcap_enabled, config_from_yaml.transport_layer.udp.npcap_enabled);
+    EXPECT_EQ(config.transport_layer.udp.topic_group_pool_size, config_from_yaml.transport_layer.udp.topic_group_pool_size);
     EXPECT_EQ(config.transport_layer.udp.local.group, config_from_yaml.transport_layer.udp.local.group);
     EXPECT_EQ(config.transport_layer.udp.local.ttl, config_from_yaml.transport_layer.udp.local.ttl);
     EXPECT_EQ(config.transport_layer.udp.network.group, config_from_yaml.transport_layer.udp.network.group);
@@ -136,7 +156,13 @@ TEST(core_cpp_config_yaml /*unused*/, yaml_processing_comparison /*unused*/)
     EXPECT_EQ(config.publisher.layer.shm.memfile_buffer_count, config_from_yaml.publisher.layer.shm.memfile_buffer_count);
     EXPECT_EQ(config.publisher.layer.shm.memfile_min_size_bytes, config_from_yaml.publisher.layer.shm.memfile_min_size_bytes);
     EXPECT_EQ(config.publisher.layer.shm.memfile_reserve_percent, config_from_yaml.publisher.layer.shm.memfile_reserve_percent);
+    EXPECT_EQ(config.publisher.layer.shm.memfile_memfd, config_from_yaml.publisher.layer.shm.memfile_memfd);
+    EXPECT_EQ(config.publisher.layer.shm.memfile_huge_pages, config_from_yaml.publisher.layer.shm.memfile_huge_pages);
+    EXPECT_EQ(config.publisher.layer.shm.memfile_prefault, config_from_yaml.publisher.layer.shm.memfile_prefault);
     EXPECT_EQ(config.publisher.layer.udp.enable, config_from_yaml.publisher.layer.udp.enable);
+    EXPECT_EQ(config.publisher.layer.udp.coalescing_enable, config_from_yaml.publisher.layer.udp.coalescing_enable);
+    EXPECT_EQ(config.publisher.layer.udp.coalescing_max_delay_us, config_from_yaml.publisher.layer.udp.coalescing_max_delay_us);
+    EXPECT_EQ(config.publisher.layer.udp.coalescing_max_size, config_from_yaml.publisher.layer.udp.coalescing_max_size);
     EXPECT_EQ(config.publisher.layer.tcp.enable, config_from_yaml.publisher.layer.tcp.enable);
     EXPECT_EQ(config.publisher.layer_priority_local, config_from_yaml.publisher.layer_priority_local);
     EXPECT_EQ(config.publisher.layer_priority_remote, config_from_yaml.publisher.layer_priority_remote);
@@ -144,6 +170,8 @@ TEST(core_cpp_config_yaml /*unused*/, yaml_processing_comparison /*unused*/)
     EXPECT_EQ(config.subscriber.layer.udp.enable, config_from_yaml.subscriber.layer.udp.enable);
     EXPECT_EQ(config.subscriber.layer.tcp.enable, config_from_yaml.subscriber.layer.tcp.enable);
     EXPECT_EQ(config.subscriber.drop_out_of_order_messages, config_from_yaml.subscriber.drop_out_of_order_messages);
+    EXPECT_EQ(config.subscriber.max_frequency_mhz, config_from_yaml.subscriber.max_frequency_mhz);
+    EXPECT_EQ(config.subscriber.downsampling, config_from_yaml.subscriber.downsampling);
     EXPECT_EQ(config.timesync.timesync_module_replay, config_from_yaml.timesync.timesync_module_replay);
     EXPECT_EQ(config.timesync.timesync_module_rt, config_from_yaml.timesync.timesync_module_rt);
     EXPECT_EQ(config.application.startup.terminal_emulator, config_from_yaml.application.startup.terminal_emulator);
@@ -158,6 +186,11 @@ TEST(core_cpp_config_yaml /*unused*/, yaml_processing_comparison /*unused*/)
     EXPECT_EQ(config.logging.provider.udp_config.port, config_from_yaml.logging.provider.udp_config.port);
     EXPECT_EQ(config.logging.receiver.enable, config_from_yaml.logging.receiver.enable);
     EXPECT_EQ(config.logging.receiver.udp_config.port, config_from_yaml.logging.receiver.udp_config.port);
+    EXPECT_EQ(config.threading.registration.name, config_from_yaml.threading.registration.name);
+    EXPECT_EQ(config.threading.registration.cpu_set, config_from_yaml.threading.registration.cpu_set);
+    EXPECT_EQ(config.threading.shm.priority, config_from_yaml.threading.shm.priority);
+    EXPECT_EQ(config.threading.udp.name, config_from_yaml.threading.udp.name);
+    EXPECT_EQ(config.threading.timer.cpu_set, config_from_yaml.threading.timer.cpu_set);
 }
 
 TEST(core_cpp_config /*unused*/, read_write_file_test /*unused*/)
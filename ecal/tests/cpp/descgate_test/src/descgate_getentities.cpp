@@ -192,6 +192,59 @@ TEST(core_cpp_descgate, ManyPublisher)
   EXPECT_EQ(0, desc_gate.GetPublisherIDs().size());
 }
 
+TEST(core_cpp_descgate, PublisherDescriptorInterning)
+{
+  eCAL::CDescGate desc_gate;
+
+  // two publishers with the same (large) descriptor
+  const std::string descriptor(64 * 1024, 'd');
+  const uint64_t    descriptor_hash = eCAL::CDescriptorStore::Hash(descriptor);
+  for (std::uint64_t id = 1; id <= 2; ++id)
+  {
+    auto reg_sample = CreatePublisher("pub", id);
+    reg_sample.topic.datatype_information.descriptor = descriptor;
+    reg_sample.topic.descriptor_hash                 = descriptor_hash;
+    desc_gate.ApplySample(reg_sample, eCAL::tl_none);
+  }
+
+  // the descriptor is stored only once
+  EXPECT_EQ(1, desc_gate.GetDescriptorStore().Size());
+  EXPECT_NE(nullptr, desc_gate.GetDescriptorStore().Find(descriptor_hash));
+
+  // a registration that only carries the hash keeps the known descriptor
+  {
+    auto reg_sample = CreatePublisher("pub", 1);
+    reg_sample.topic.datatype_information.descriptor.clear();
+    reg_sample.topic.descriptor_hash = descriptor_hash;
+    desc_gate.ApplySample(reg_sample, eCAL::tl_none);
+  }
+
+  for (const auto& id : desc_gate.GetPublisherIDs())
+  {
+    eCAL::SDataTypeInformation topic_info;
+    EXPECT_TRUE(desc_gate.GetPublisherInfo(id, topic_info));
+    EXPECT_EQ(descriptor, topic_info.descriptor);
+  }
+
+  // a changed hash without descriptor drops the outdated descriptor
+  {
+    auto reg_sample = CreatePublisher("pub", 1);
+    reg_sample.topic.datatype_information.descriptor.clear();
+    reg_sample.topic.descriptor_hash = descriptor_hash + 1;
+    desc_gate.ApplySample(reg_sample, eCAL::tl_none);
+
+    eCAL::SDataTypeInformation topic_info;
+    EXPECT_TRUE(desc_gate.GetPublisherInfo(eCAL::STopicId{ { 1, 0, "" }, "pub" }, topic_info));
+    EXPECT_TRUE(topic_info.descriptor.empty());
+  }
+
+  // the descriptor is released with its last holder
+  desc_gate.ApplySample(DestroyPublisher("pub", 1), eCAL::tl_none);
+  desc_gate.ApplySample(DestroyPublisher("pub", 2), eCAL::tl_none);
+  EXPECT_EQ(0, desc_gate.GetDescriptorStore().Size());
+  EXPECT_EQ(nullptr, desc_gate.GetDescriptorStore().Find(descriptor_hash));
+}
+
 TEST(core_cpp_descgate, SubscriberExpiration)
 {
   eCAL::CDescGate desc_gate;
@@ -34,3 +34,18 @@ TEST(core_cpp_core, MemFile_MemfileNaming)
   EXPECT_LE(memfile_name_1.size(), 13);
   EXPECT_NE(memfile_name_1, memfile_name_2);
 }
+
+TEST(core_cpp_core, MemFile_MemFdNaming)
+{
+  int process_id(0);
+
+  const std::string memfd_name{ eCAL::memfile::BuildRandomMemFdFileName("test_", 4711) };
+  EXPECT_TRUE(eCAL::memfile::ParseMemFdFileName(memfd_name, process_id));
+  EXPECT_EQ(process_id, 4711);
+  EXPECT_TRUE(eCAL::memfile::ParseMemFdFileName("/" + memfd_name, process_id));
+  EXPECT_EQ(process_id, 4711);
+
+  EXPECT_FALSE(eCAL::memfile::ParseMemFdFileName(eCAL::memfile::BuildRandomMemFileName("test_"), process_id));
+  EXPECT_FALSE(eCAL::memfile::ParseMemFdFileName("test_memfd_1234", process_id));
+  EXPECT_FALSE(eCAL::memfile::ParseMemFdFileName("test_memfd12a4_1234", process_id));
+}
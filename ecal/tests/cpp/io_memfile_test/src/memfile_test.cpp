@@ -19,6 +19,7 @@
 
 #include "io/shm/ecal_memfile.h"
 #include "io/shm/ecal_memfile_db.h"
+#include "io/shm/ecal_memfile_naming.h"
 #include <cstddef>
 #include <ecal/ecal.h>
 
@@ -31,6 +32,12 @@
 #include <gtest/gtest.h>
 #include <vector>
 
+#ifdef __linux__
+#include "io/shm/linux/ecal_memfile_memfd.h"
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
 namespace eCAL
 {
   CMemFileMap* g_memfile_map()
@@ -299,3 +306,47 @@ TEST(core_cpp_core, MemFile_Concurrency)
   // destroy memory file
   EXPECT_EQ(true, mem_file.Destroy(true));
 }
+
+#ifdef __linux__
+TEST(core_cpp_core, MemFile_MemFd)
+{
+  const std::string memfile_name = eCAL::memfile::BuildRandomMemFdFileName("my_memory_file_", static_cast<int>(getpid()));
+  const size_t      memfile_size = 4096;
+
+  // create and serve the memory file
+  const int fd = eCAL::memfile::memfd::CreateFile(memfile_name);
+  ASSERT_NE(-1, fd);
+  EXPECT_EQ(0, ftruncate(fd, memfile_size));
+  EXPECT_TRUE(eCAL::memfile::memfd::SealFile(fd));
+  EXPECT_TRUE(eCAL::memfile::memfd::RegisterFile(memfile_name, fd));
+
+  // request it like a reader process does
+  const int requested_fd = eCAL::memfile::memfd::RequestFile(memfile_name, static_cast<int>(getpid()));
+  ASSERT_NE(-1, requested_fd);
+  EXPECT_NE(fd, requested_fd);
+  EXPECT_EQ(-1, eCAL::memfile::memfd::RequestFile(memfile_name + "_unknown", static_cast<int>(getpid())));
+
+  // the sealed file can not be shrunk by the reader
+  EXPECT_NE(0, ftruncate(requested_fd, 0));
+
+  // both sides see the same memory
+  void* write_address = mmap(nullptr, memfile_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  void* read_address  = mmap(nullptr, memfile_size, PROT_READ, MAP_SHARED, requested_fd, 0);
+  ASSERT_NE(MAP_FAILED, write_address);
+  ASSERT_NE(MAP_FAILED, read_address);
+
+  const std::string send_s = "Hello World";
+  std::copy(send_s.begin(), send_s.end(), static_cast<char*>(write_address));
+  EXPECT_EQ(send_s, std::string(static_cast<const char*>(read_address), send_s.size()));
+
+  munmap(write_address, memfile_size);
+  munmap(read_address, memfile_size);
+
+  // unregistered files can not be requested anymore
+  eCAL::memfile::memfd::UnregisterFile(memfile_name);
+  EXPECT_EQ(-1, eCAL::memfile::memfd::RequestFile(memfile_name, static_cast<int>(getpid())));
+
+  close(requested_fd);
+  close(fd);
+}
+#endif
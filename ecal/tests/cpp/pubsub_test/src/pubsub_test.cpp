@@ -284,6 +284,51 @@ TEST(core_cpp_pubsub, DynamicSizeCB)
   eCAL::Finalize();
 }
 
+TEST(core_cpp_pubsub, DynamicGrowthCB)
+{
+  const size_t send_count = 10;
+
+  // initialize eCAL API
+  eCAL::Initialize("pubsub_test");
+
+  // create subscriber for topic "foo"
+  auto sub = std::make_shared<eCAL::CSubscriber>("foo");
+
+  // create publisher for topic "foo"
+  auto pub = std::make_shared<eCAL::CPublisher>("foo");
+
+  // add callback
+  sub->SetReceiveCallback(std::bind(OnReceive, std::placeholders::_3));
+
+  // let's match them
+  eCAL::Process::SleepMS(2 * CMN_REGISTRATION_REFRESH_MS);
+
+  // send a continuously growing payload, the memory file is recreated multiple
+  // times and the subscriber has to follow without waiting for the registration layer
+  g_callback_received_bytes = 0;
+  g_callback_received_count = 0;
+  size_t send_bytes(0);
+  for (size_t i = 0; i < send_count; ++i)
+  {
+    const std::string send_s = CreatePayLoad(PAYLOAD_SIZE_BYTE << i);
+    EXPECT_TRUE(pub->Send(send_s));
+    send_bytes += send_s.size();
+
+    // let the data flow
+    eCAL::Process::SleepMS(DATA_FLOW_TIME_MS);
+  }
+
+  // check callback receive
+  EXPECT_EQ(send_count, g_callback_received_count);
+  EXPECT_EQ(send_bytes, g_callback_received_bytes);
+
+  // destroy subscriber
+  sub.reset();
+
+  // finalize eCAL API
+  eCAL::Finalize();
+}
+
 TEST(core_cpp_pubsub, DynamicCreate)
 { 
   // default send string
@@ -24,6 +24,7 @@
 
 #include <atomic>
 #include <functional>
+#include <memory>
 #include <string>
 
 #include <gtest/gtest.h>
@@ -136,3 +137,69 @@ TEST(core_cpp_pubsub, MultipleSendsUDP)
   // finalize eCAL API
   eCAL::Finalize();
 }
+
+TEST(core_cpp_pubsub, CoalescedSendsUDP)
+{
+  const std::vector<std::string> topic_names{ "A", "B", "C", "D" };
+  const int send_loops = 10;
+
+  // initialize eCAL API
+  eCAL::Initialize("pubsub_test");
+
+  // create publisher config
+  eCAL::Publisher::Configuration pub_config;
+  // set transport layer
+  pub_config.layer.shm.enable = false;
+  pub_config.layer.udp.enable = true;
+  pub_config.layer.tcp.enable = false;
+  // pack the samples of all topics into frames
+  pub_config.layer.udp.coalescing_enable       = true;
+  pub_config.layer.udp.coalescing_max_delay_us = 10000;
+  pub_config.layer.udp.coalescing_max_size     = 1400;
+
+  // create subscribers and publishers
+  std::vector<std::unique_ptr<eCAL::CSubscriber>> subs;
+  std::vector<std::unique_ptr<eCAL::CPublisher>>  pubs;
+  std::vector<std::vector<std::string>>           received(topic_names.size());
+  for (size_t i = 0; i < topic_names.size(); ++i)
+  {
+    subs.emplace_back(std::make_unique<eCAL::CSubscriber>(topic_names[i]));
+    subs.back()->SetReceiveCallback([&received, i](const eCAL::STopicId& /*topic_id_*/, const eCAL::SDataTypeInformation& /*data_type_info_*/, const eCAL::SReceiveCallbackData& data_)
+      {
+        received[i].emplace_back(static_cast<const char*>(data_.buffer), data_.buffer_size);
+      });
+    pubs.emplace_back(std::make_unique<eCAL::CPublisher>(topic_names[i], eCAL::SDataTypeInformation(), pub_config));
+  }
+
+  // let's match them
+  eCAL::Process::SleepMS(2 * CMN_REGISTRATION_REFRESH_MS);
+
+  // small samples of all topics, every 5th sample of topic "A" is too large for a frame
+  for (int loop = 0; loop < send_loops; ++loop)
+  {
+    for (size_t i = 0; i < pubs.size(); ++i)
+    {
+      std::string payload = topic_names[i] + std::to_string(loop);
+      if ((i == 0) && (loop % 5 == 0)) payload.resize(4000, 'x');
+      EXPECT_TRUE(pubs[i]->Send(payload));
+    }
+  }
+  eCAL::Process::SleepMS(DATA_FLOW_TIME_MS + 10);
+
+  // every sample arrived, in send order per topic
+  for (size_t i = 0; i < topic_names.size(); ++i)
+  {
+    ASSERT_EQ(send_loops, received[i].size()) << "topic " << topic_names[i];
+    for (int loop = 0; loop < send_loops; ++loop)
+    {
+      EXPECT_EQ(0, received[i][loop].find(topic_names[i] + std::to_string(loop)));
+    }
+  }
+
+  // destroy subscribers before the received samples
+  subs.clear();
+  pubs.clear();
+
+  // finalize eCAL API
+  eCAL::Finalize();
+}
@@ -110,6 +110,7 @@ namespace eCAL
       topic.topic_name           = GenerateString(8);
       topic.direction            = GenerateString(5);
       topic.datatype_information = GenerateDataTypeInformation();
+      topic.descriptor_hash      = (static_cast<uint64_t>(rand()) << 32) | static_cast<uint64_t>(rand());
       topic.transport_layer.push_back(GenerateTLayer());
       topic.transport_layer.push_back(GenerateTLayer());
       topic.topic_size           = rand() % 1000;
@@ -119,6 +120,8 @@ namespace eCAL
       topic.data_id              = rand();
       topic.data_clock           = rand();
       topic.data_frequency       = rand() % 100;
+      topic.receive_max_frequency = rand() % 100;
+      topic.receive_downsampling  = rand() % 10;
       return topic;
     }
 
@@ -163,3 +163,43 @@ TEST(core_cpp_core, Topic2Mcast_LegacyBehavior)
     EXPECT_EQ(eCAL::UDP::V1::topic2mcast_hash(object.hash, object.ip, object.mask), object.result);
   }
 }
+
+TEST(core_cpp_core, Topic2Mcast_Fnv1aHash32)
+{
+  // reference values of the 32 bit FNV-1a hash, they must never change
+  EXPECT_EQ(eCAL::UDP::V2::fnv1a_hash32(""),       0x811C9DC5U);
+  EXPECT_EQ(eCAL::UDP::V2::fnv1a_hash32("a"),      0xE40C292CU);
+  EXPECT_EQ(eCAL::UDP::V2::fnv1a_hash32("foobar"), 0xBF9CF968U);
+}
+
+TEST(core_cpp_core, Topic2Mcast_Pool)
+{
+  // all topics of a pool of one group share the group right after the base
+  EXPECT_EQ(eCAL::UDP::V2::topic2mcast_pool("foo", "239.0.0.1", 1), "239.0.0.2");
+  EXPECT_EQ(eCAL::UDP::V2::topic2mcast_pool("bar", "239.0.0.1", 1), "239.0.0.2");
+
+  // hash("foobar") % 256 = 0x68 = 104, the pool starts at base + 1
+  EXPECT_EQ(eCAL::UDP::V2::topic2mcast_pool("foobar", "239.0.0.1", 256), "239.0.0.106");
+
+  // the pool wraps within the first octet
+  EXPECT_EQ(eCAL::UDP::V2::topic2mcast_pool("foo", "239.255.255.255", 1), "239.0.0.0");
+
+  // all pool groups are used, but never the base address
+  const uint32_t pool_size = 64;
+  std::vector<int> group_use(pool_size, 0);
+  for (int i = 0; i < 64 * 64; ++i)
+  {
+    const std::string topic_name = "topic_" + std::to_string(i);
+    const std::string address    = eCAL::UDP::V2::topic2mcast_pool(topic_name, "239.0.0.1", pool_size);
+    EXPECT_NE(address, "239.0.0.1");
+
+    const uint32_t index = eCAL::UDP::V2::parse_ipv4(address) - eCAL::UDP::V2::parse_ipv4("239.0.0.2");
+    ASSERT_LT(index, pool_size);
+    EXPECT_EQ(index, eCAL::UDP::V2::topic2pool_index(topic_name, pool_size));
+    group_use[index]++;
+  }
+  for (const int use : group_use)
+  {
+    EXPECT_GT(use, 0);
+  }
+}
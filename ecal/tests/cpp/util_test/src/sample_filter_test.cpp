@@ -0,0 +1,94 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include "util/sample_filter.h"
+#include <gtest/gtest.h>
+
+using namespace eCAL;
+
+TEST(SampleFilterTest, InactiveAcceptsEverything) {
+  SampleFilter filter;
+  EXPECT_FALSE(filter.IsActive());
+  for (long long clock = 1; clock < 100; ++clock) {
+    EXPECT_TRUE(filter.Accept(clock, clock));
+  }
+
+  // downsampling 0 and 1 mean every sample
+  EXPECT_FALSE(SampleFilter(0, 0).IsActive());
+  EXPECT_FALSE(SampleFilter(0, 1).IsActive());
+}
+
+TEST(SampleFilterTest, Downsampling) {
+  SampleFilter filter(0, 4);
+  EXPECT_TRUE(filter.IsActive());
+
+  int accepted = 0;
+  for (long long clock = 1; clock <= 100; ++clock) {
+    const bool accept = filter.Accept(clock, clock * 1000);
+    EXPECT_EQ(accept, clock % 4 == 0);
+    if (accept) accepted++;
+  }
+  EXPECT_EQ(accepted, 25);
+}
+
+TEST(SampleFilterTest, MaxFrequency) {
+  // 10 Hz -> 100 ms period, samples every 30 ms
+  SampleFilter filter(10000, 1);
+  EXPECT_TRUE(filter.IsActive());
+
+  EXPECT_TRUE (filter.Accept(1,   0));
+  EXPECT_FALSE(filter.Accept(2,  30000));
+  EXPECT_FALSE(filter.Accept(3,  60000));
+  EXPECT_FALSE(filter.Accept(4,  90000));
+  EXPECT_TRUE (filter.Accept(5, 120000));
+  EXPECT_FALSE(filter.Accept(6, 150000));
+  EXPECT_TRUE (filter.Accept(7, 220000));
+
+  // send time jumped back (e.g. replay restarted)
+  EXPECT_TRUE (filter.Accept(8,  10000));
+  EXPECT_FALSE(filter.Accept(9,  40000));
+}
+
+TEST(SampleFilterTest, SubsetGivesSameSelection) {
+  // the subscriber side filter sees only the samples the publisher side filter accepted,
+  // or a superset of them, and must accept the same samples
+  SampleFilter pub_filter(25000, 2);
+  SampleFilter sub_filter(25000, 2);
+
+  for (long long clock = 1; clock <= 1000; ++clock) {
+    const long long time = clock * 7000;
+    if (pub_filter.Accept(clock, time)) {
+      EXPECT_TRUE(sub_filter.Accept(clock, time));
+    }
+  }
+}
+
+TEST(SampleFilterTest, ReconfigureKeepsState) {
+  SampleFilter filter(10000, 1);
+  EXPECT_TRUE (filter.Accept(1, 0));
+
+  // unchanged settings keep the last accepted time
+  filter.Reconfigure(SampleFilter(10000, 1));
+  EXPECT_FALSE(filter.Accept(2, 50000));
+
+  // changed settings start over
+  filter.Reconfigure(SampleFilter(20000, 1));
+  EXPECT_EQ(filter.GetMaxFrequency(), 20000u);
+  EXPECT_TRUE (filter.Accept(3, 60000));
+}
@@ -0,0 +1,63 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include "util/ecal_thread_factory.h"
+
+#include <ecal/ecal.h>
+#include <gtest/gtest.h>
+
+#include <string>
+
+#ifdef __linux__
+#include <pthread.h>
+
+namespace
+{
+  std::string GetThreadName()
+  {
+    char name[16] = { 0 };
+    pthread_getname_np(pthread_self(), name, sizeof(name));
+    return name;
+  }
+
+  std::string GetNameOfCreatedThread(eCAL::Threading::eThreadClass thread_class_)
+  {
+    std::string name;
+    std::thread thread = eCAL::Threading::CreateThread(thread_class_, [&name]() { name = GetThreadName(); });
+    thread.join();
+    return name;
+  }
+}
+
+TEST(ThreadFactoryTest, CreateThreadAppliesName) {
+  eCAL::Configuration config;
+  config.threading.timer.name = "ecal-test-timer";
+  config.threading.udp.name   = "ecal-test-udp-receive";  // longer than the 15 characters Linux allows
+  config.threading.shm.name   = "";                        // keep the default name
+  ASSERT_TRUE(eCAL::Initialize(config, "thread_factory_test", eCAL::Init::None));
+
+  EXPECT_EQ(GetNameOfCreatedThread(eCAL::Threading::eThreadClass::timer), "ecal-test-timer");
+  EXPECT_EQ(GetNameOfCreatedThread(eCAL::Threading::eThreadClass::udp),   "ecal-test-udp-r");
+
+  // without a name the thread keeps the name it inherits from the creating thread
+  EXPECT_EQ(GetNameOfCreatedThread(eCAL::Threading::eThreadClass::shm),   GetThreadName());
+
+  EXPECT_TRUE(eCAL::Finalize());
+}
+#endif
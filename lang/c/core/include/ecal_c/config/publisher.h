@@ -102,12 +102,19 @@ struct eCAL_Publisher_Layer_SHM_Configuration
                                             The publisher send call is blocked on this event with this timeout (0 == no handshake).*/
   unsigned int memfile_buffer_count; /*!< Maximum number of used buffers (needs to be greater than 1, default = 1) */
   unsigned int memfile_min_size_bytes; //!< Default memory file size for new publisher (Default: 4096)
-  unsigned int memfile_reserve_percent; //!< Dynamic file size reserve before recreating memory file if topic size changes (Default: 50)
+  unsigned int memfile_reserve_percent; //!< Minimal dynamic file size reserve before recreating memory file if topic size changes, continuously growing topics get a larger reserve (Default: 50)
+  int memfile_memfd; //!< Linux only: Create anonymous memory files (memfd) and pass them to local subscribers via a Unix socket instead of named files in /dev/shm (Default: false)
+  int memfile_huge_pages; //!< Linux only: Back memory files larger than a huge page by transparent huge pages, if enabled for shared memory by the system (Default: false)
+  int memfile_prefault; //!< Linux only: Populate memory files on creation, so the first send of a large payload does not page fault (Default: false)
 };
 
 struct eCAL_Publisher_Layer_UDP_Configuration
 {
   int enable; //!< enable layer
+
+  int coalescing_enable; //!< Pack small samples of different topics of this process into one multi-sample frame, requires subscribers with sample frame support (Default: false)
+  unsigned int coalescing_max_delay_us; //!< Maximum time a sample is held back before its frame is sent in microseconds (Default: 200)
+  unsigned int coalescing_max_size; //!< Maximum frame size in bytes, larger samples are sent on their own (Default: 1400)
 };
 
 struct eCAL_Publisher_Layer_TCP_Configuration
@@ -72,6 +72,8 @@ struct eCAL_Registration_Configuration
   unsigned int registration_timeout; //!< Timeout for topic registration in ms (internal) (Default: 10000)
   unsigned int registration_refresh; //!< Topic registration refresh cycle (has to be smaller than registration timeout!) (Default: 1000)
   int loopback; //!< Enable to receive UDP messages on the same local machine (Default: true)
+  int fast_discovery; //!< Re-register immediately when a new matching entity is detected, instead of waiting for the next refresh cycle (Default: false)
+  unsigned int descriptor_refresh; //!< Send the full datatype descriptor only with every n-th registration refresh, all other registrations carry the descriptor hash only (Default: 1)
   const char* shm_transport_domain; //!< Common shm transport domain that enables interprocess mechanisms across (virtual) host borders (e.g., Docker); by default equivalent to local host name (Default: "")
   struct eCAL_Registration_Local_Configuration local;
   struct eCAL_Registration_Network_Configuration network;
@@ -52,6 +52,8 @@ struct eCAL_Subscriber_Configuration
   struct eCAL_Subscriber_Layer_Configuration layer;
 
   int drop_out_of_order_messages;  //!< Enable dropping of payload messages that arrive out of order (Default: true)
+  unsigned int max_frequency_mhz;  //!< Maximum rate at which samples of a publisher are received in mHz, 0 = no limit (Default: 0)
+  unsigned int downsampling;       //!< Receive only every n-th sample of a publisher, 0 or 1 = every sample (Default: 1)
 };
 
 #endif /* ecal_c_config_subscriber_h_included */
\ No newline at end of file
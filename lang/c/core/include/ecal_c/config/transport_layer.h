@@ -52,6 +52,7 @@ struct eCAL_TransportLayer_UDP_Configuration
   unsigned int receive_buffer; //!< UDP receive buffer in bytes (Default: 5242880)
   int join_all_interfaces; //!< Linux specific setting to enable joining multicast groups on all network interfaces
   int npcap_enabled; //!< Enable to receive UDP traffic with the Npcap based receiver (Default: false)
+  unsigned int topic_group_pool_size; //!< v2, network mode only: Number of multicast groups topic payloads are spread over, 0 sends all topics to the group base (Default: 0)
   struct eCAL_TransportLayer_UDP_MulticastConfiguration network; //!< default: "239.0.0.1", 3U
   struct eCAL_TransportLayer_UDP_MulticastConfiguration local; //!< default: "127.255.255.255", 1U
 };
@@ -142,8 +142,14 @@ void Assign_Publisher_Configuration(struct eCAL_Publisher_Configuration* configu
   configuration_c_->layer.shm.memfile_buffer_count = configuration_.layer.shm.memfile_buffer_count;
   configuration_c_->layer.shm.memfile_min_size_bytes = configuration_.layer.shm.memfile_min_size_bytes;
   configuration_c_->layer.shm.memfile_reserve_percent = configuration_.layer.shm.memfile_reserve_percent;
+  configuration_c_->layer.shm.memfile_memfd = configuration_.layer.shm.memfile_memfd;
+  configuration_c_->layer.shm.memfile_huge_pages = configuration_.layer.shm.memfile_huge_pages;
+  configuration_c_->layer.shm.memfile_prefault = configuration_.layer.shm.memfile_prefault;
 
   configuration_c_->layer.udp.enable = configuration_.layer.udp.enable;
+  configuration_c_->layer.udp.coalescing_enable = configuration_.layer.udp.coalescing_enable;
+  configuration_c_->layer.udp.coalescing_max_delay_us = configuration_.layer.udp.coalescing_max_delay_us;
+  configuration_c_->layer.udp.coalescing_max_size = configuration_.layer.udp.coalescing_max_size;
   configuration_c_->layer.tcp.enable = configuration_.layer.tcp.enable;
 
   // Assign layer_priority_local
@@ -167,6 +173,8 @@ void Assign_Registration_Configuration(struct eCAL_Registration_Configuration* c
   configuration_c_->registration_timeout = configuration_.registration_timeout;
   configuration_c_->registration_refresh = configuration_.registration_refresh;
   configuration_c_->loopback = configuration_.loopback;
+  configuration_c_->fast_discovery = configuration_.fast_discovery;
+  configuration_c_->descriptor_refresh = configuration_.descriptor_refresh;
   configuration_c_->shm_transport_domain = configuration_.shm_transport_domain.c_str();
 
   // Assign Local::Configuration
@@ -192,6 +200,8 @@ void Assign_Subscriber_Configuration(struct eCAL_Subscriber_Configuration* confi
 
   // Assign Subscriber configuration
   configuration_c_->drop_out_of_order_messages = configuration_.drop_out_of_order_messages;
+  configuration_c_->max_frequency_mhz = configuration_.max_frequency_mhz;
+  configuration_c_->downsampling = configuration_.downsampling;
 }
 
 void Assign_Time_Configuration(struct eCAL_Time_Configuration* configuration_c_, const eCAL::Time::Configuration& configuration_)
@@ -211,6 +221,7 @@ void Assign_TransportLayer_Configuration(struct eCAL_TransportLayer_Configuratio
   configuration_c_->udp.receive_buffer = configuration_.udp.receive_buffer;
   configuration_c_->udp.join_all_interfaces = configuration_.udp.join_all_interfaces;
   configuration_c_->udp.npcap_enabled = configuration_.udp.npcap_enabled;
+  configuration_c_->udp.topic_group_pool_size = configuration_.udp.topic_group_pool_size;
 
   strncpy(configuration_c_->udp.network.group, configuration_.udp.network.group.Get().c_str(), sizeof(configuration_c_->udp.network.group));
   configuration_c_->udp.network.ttl = configuration_.udp.network.ttl;
@@ -368,8 +379,14 @@ void Assign_Publisher_Configuration(eCAL::Publisher::Configuration& configuratio
   configuration_.layer.shm.memfile_buffer_count = configuration_c_->layer.shm.memfile_buffer_count;
   configuration_.layer.shm.memfile_min_size_bytes = configuration_c_->layer.shm.memfile_min_size_bytes;
   configuration_.layer.shm.memfile_reserve_percent = configuration_c_->layer.shm.memfile_reserve_percent;
+  configuration_.layer.shm.memfile_memfd = static_cast<bool>(configuration_c_->layer.shm.memfile_memfd);
+  configuration_.layer.shm.memfile_huge_pages = static_cast<bool>(configuration_c_->layer.shm.memfile_huge_pages);
+  configuration_.layer.shm.memfile_prefault = static_cast<bool>(configuration_c_->layer.shm.memfile_prefault);
 
   configuration_.layer.udp.enable = static_cast<bool>(configuration_c_->layer.udp.enable);
+  configuration_.layer.udp.coalescing_enable = static_cast<bool>(configuration_c_->layer.udp.coalescing_enable);
+  configuration_.layer.udp.coalescing_max_delay_us = configuration_c_->layer.udp.coalescing_max_delay_us;
+  configuration_.layer.udp.coalescing_max_size = configuration_c_->layer.udp.coalescing_max_size;
   configuration_.layer.tcp.enable = static_cast<bool>(configuration_c_->layer.tcp.enable);
 
   // Assign layer_priority_local
@@ -393,6 +410,8 @@ void Assign_Registration_Configuration(eCAL::Registration::Configuration& config
   configuration_.registration_timeout = configuration_c_->registration_timeout;
   configuration_.registration_refresh = configuration_c_->registration_refresh;
   configuration_.loopback = static_cast<bool>(configuration_c_->loopback);
+  configuration_.fast_discovery = static_cast<bool>(configuration_c_->fast_discovery);
+  configuration_.descriptor_refresh = configuration_c_->descriptor_refresh;
   configuration_.shm_transport_domain = configuration_c_->shm_transport_domain != NULL ? configuration_c_->shm_transport_domain : "";
 
   // Assign Local::Configuration
@@ -415,6 +434,8 @@ void Assign_Subscriber_Configuration(eCAL::Subscriber::Configuration& configurat
 
   // Assign Subscriber configuration
   configuration_.drop_out_of_order_messages = static_cast<bool>(configuration_c_->drop_out_of_order_messages);
+  configuration_.max_frequency_mhz = configuration_c_->max_frequency_mhz;
+  configuration_.downsampling = configuration_c_->downsampling;
 }
 
 void Assign_Time_Configuration(eCAL::Time::Configuration& configuration_, const struct eCAL_Time_Configuration* configuration_c_)
@@ -434,6 +455,7 @@ void Assign_TransportLayer_Configuration(eCAL::TransportLayer::Configuration& co
   configuration_.udp.receive_buffer = configuration_c_->udp.receive_buffer;
   configuration_.udp.join_all_interfaces = static_cast<bool>(configuration_c_->udp.join_all_interfaces);
   configuration_.udp.npcap_enabled = static_cast<bool>(configuration_c_->udp.npcap_enabled);
+  configuration_.udp.topic_group_pool_size = configuration_c_->udp.topic_group_pool_size;
 
   configuration_.udp.network.group = configuration_c_->udp.network.group;
   configuration_.udp.network.ttl = configuration_c_->udp.network.ttl;
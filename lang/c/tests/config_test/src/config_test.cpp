@@ -68,6 +68,8 @@ TEST_F(config_test_c, Registration)
 
     EXPECT_EQ(configuration0->registration.local.udp.port, eCAL_GetConfiguration()->registration.local.udp.port);
     EXPECT_EQ(configuration0->registration.loopback, eCAL_GetConfiguration()->registration.loopback);
+    EXPECT_EQ(configuration0->registration.fast_discovery, eCAL_GetConfiguration()->registration.fast_discovery);
+    EXPECT_EQ(configuration0->registration.descriptor_refresh, eCAL_GetConfiguration()->registration.descriptor_refresh);
     EXPECT_EQ(configuration0->registration.network.transport_type, eCAL_GetConfiguration()->registration.network.transport_type);
     EXPECT_EQ(configuration0->registration.network.udp.port, eCAL_GetConfiguration()->registration.network.udp.port);
     EXPECT_STREQ(configuration0->registration.shm_transport_domain, eCAL_GetConfiguration()->registration.shm_transport_domain);
@@ -93,6 +95,7 @@ TEST_F(config_test_c, TransportLayer)
     EXPECT_EQ(configuration0->transport_layer.udp.join_all_interfaces, eCAL_GetConfiguration()->transport_layer.udp.join_all_interfaces);
     EXPECT_EQ(configuration0->transport_layer.udp.npcap_enabled, eCAL_Config_IsNpcapEnabled());
     EXPECT_EQ(configuration0->transport_layer.udp.npcap_enabled, eCAL_GetConfiguration()->transport_layer.udp.npcap_enabled);
+    EXPECT_EQ(configuration0->transport_layer.udp.topic_group_pool_size, eCAL_GetConfiguration()->transport_layer.udp.topic_group_pool_size);
 
     EXPECT_STREQ(configuration0->transport_layer.udp.local.group, eCAL_GetConfiguration()->transport_layer.udp.local.group);
     EXPECT_EQ(configuration0->transport_layer.udp.local.ttl, eCAL_GetConfiguration()->transport_layer.udp.local.ttl);
@@ -115,6 +118,8 @@ TEST_F(config_test_c, Subscriber)
     EXPECT_EQ(configuration0->subscriber.layer.tcp.enable, eCAL_GetConfiguration()->subscriber.layer.tcp.enable);
     EXPECT_EQ(configuration0->subscriber.drop_out_of_order_messages, eCAL_Config_GetDropOutOfOrderMessages());
     EXPECT_EQ(configuration0->subscriber.drop_out_of_order_messages, eCAL_GetConfiguration()->subscriber.drop_out_of_order_messages);
+    EXPECT_EQ(configuration0->subscriber.max_frequency_mhz, eCAL_GetConfiguration()->subscriber.max_frequency_mhz);
+    EXPECT_EQ(configuration0->subscriber.downsampling, eCAL_GetConfiguration()->subscriber.downsampling);
 }
 
 TEST_F(config_test_c, Time)
@@ -154,9 +159,15 @@ TEST_F(config_test_c, Publisher)
     EXPECT_EQ(configuration0->publisher.layer.shm.memfile_buffer_count, eCAL_GetConfiguration()->publisher.layer.shm.memfile_buffer_count);
     EXPECT_EQ(configuration0->publisher.layer.shm.memfile_min_size_bytes, eCAL_GetConfiguration()->publisher.layer.shm.memfile_min_size_bytes);
     EXPECT_EQ(configuration0->publisher.layer.shm.memfile_reserve_percent, eCAL_GetConfiguration()->publisher.layer.shm.memfile_reserve_percent);
+    EXPECT_EQ(configuration0->publisher.layer.shm.memfile_memfd, eCAL_GetConfiguration()->publisher.layer.shm.memfile_memfd);
+    EXPECT_EQ(configuration0->publisher.layer.shm.memfile_huge_pages, eCAL_GetConfiguration()->publisher.layer.shm.memfile_huge_pages);
+    EXPECT_EQ(configuration0->publisher.layer.shm.memfile_prefault, eCAL_GetConfiguration()->publisher.layer.shm.memfile_prefault);
     EXPECT_EQ(configuration0->publisher.layer.shm.zero_copy_mode, eCAL_GetConfiguration()->publisher.layer.shm.zero_copy_mode);
     EXPECT_EQ(configuration0->publisher.layer.tcp.enable, eCAL_GetConfiguration()->publisher.layer.tcp.enable);
     EXPECT_EQ(configuration0->publisher.layer.udp.enable, eCAL_GetConfiguration()->publisher.layer.udp.enable);
+    EXPECT_EQ(configuration0->publisher.layer.udp.coalescing_enable, eCAL_GetConfiguration()->publisher.layer.udp.coalescing_enable);
+    EXPECT_EQ(configuration0->publisher.layer.udp.coalescing_max_delay_us, eCAL_GetConfiguration()->publisher.layer.udp.coalescing_max_delay_us);
+    EXPECT_EQ(configuration0->publisher.layer.udp.coalescing_max_size, eCAL_GetConfiguration()->publisher.layer.udp.coalescing_max_size);
 
     EXPECT_EQ(configuration0->publisher.layer_priority_local_length, eCAL_GetConfiguration()->publisher.layer_priority_local_length);
     EXPECT_EQ(configuration0->publisher.layer_priority_remote_length, eCAL_GetConfiguration()->publisher.layer_priority_remote_length);
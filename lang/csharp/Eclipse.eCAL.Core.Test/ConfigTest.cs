@@ -81,6 +81,9 @@ public class ConfigTest
     config.Publisher.Layer.SHM.MemfileMinSizeBytes = 8192;
     config.Publisher.Layer.SHM.MemfileReservePercent = 14;
     config.Publisher.Layer.UDP.Enable = false;
+    config.Publisher.Layer.UDP.CoalescingEnable = true;
+    config.Publisher.Layer.UDP.CoalescingMaxDelayUs = 500;
+    config.Publisher.Layer.UDP.CoalescingMaxSize = 8000;
     config.Publisher.Layer.TCP.Enable = false;
     config.Publisher.LayerPriorityLocal.Clear();
     config.Publisher.LayerPriorityLocal.AddRange(new eTransportLayerType[] { eTransportLayerType.Tcp, eTransportLayerType.Shm, eTransportLayerType.UdpMc });
@@ -92,6 +95,8 @@ public class ConfigTest
     config.Subscriber.Layer.UDP.Enable = false;
     config.Subscriber.Layer.TCP.Enable = true;
     config.Subscriber.DropOutOfOrderMessages = false;
+    config.Subscriber.MaxFrequencyMhz = 2500;
+    config.Subscriber.Downsampling = 4;
 
     // TimeSync
     config.TimeSync.TimeSyncModuleReplay = "my_replay";
@@ -156,6 +161,9 @@ public class ConfigTest
     Assert.AreEqual(config.Publisher.Layer.SHM.MemfileMinSizeBytes, ecalConfig.Publisher.Layer.SHM.MemfileMinSizeBytes, "Publisher.Layer.SHM.MemfileMinSizeBytes mismatch");
     Assert.AreEqual(config.Publisher.Layer.SHM.MemfileReservePercent, ecalConfig.Publisher.Layer.SHM.MemfileReservePercent, "Publisher.Layer.SHM.MemfileReservePercent mismatch");
     Assert.AreEqual(config.Publisher.Layer.UDP.Enable, ecalConfig.Publisher.Layer.UDP.Enable, "Publisher.Layer.UDP.Enable mismatch");
+    Assert.AreEqual(config.Publisher.Layer.UDP.CoalescingEnable, ecalConfig.Publisher.Layer.UDP.CoalescingEnable, "Publisher.Layer.UDP.CoalescingEnable mismatch");
+    Assert.AreEqual(config.Publisher.Layer.UDP.CoalescingMaxDelayUs, ecalConfig.Publisher.Layer.UDP.CoalescingMaxDelayUs, "Publisher.Layer.UDP.CoalescingMaxDelayUs mismatch");
+    Assert.AreEqual(config.Publisher.Layer.UDP.CoalescingMaxSize, ecalConfig.Publisher.Layer.UDP.CoalescingMaxSize, "Publisher.Layer.UDP.CoalescingMaxSize mismatch");
     Assert.AreEqual(config.Publisher.Layer.TCP.Enable, ecalConfig.Publisher.Layer.TCP.Enable, "Publisher.Layer.TCP.Enable mismatch");
     CollectionAssert.AreEqual(config.Publisher.LayerPriorityLocal, ecalConfig.Publisher.LayerPriorityLocal, "Publisher.LayerPriorityLocal mismatch");
     CollectionAssert.AreEqual(config.Publisher.LayerPriorityRemote, ecalConfig.Publisher.LayerPriorityRemote, "Publisher.LayerPriorityRemote mismatch");
@@ -165,6 +173,8 @@ public class ConfigTest
     Assert.AreEqual(config.Subscriber.Layer.UDP.Enable, ecalConfig.Subscriber.Layer.UDP.Enable, "Subscriber.Layer.UDP.Enable mismatch");
     Assert.AreEqual(config.Subscriber.Layer.TCP.Enable, ecalConfig.Subscriber.Layer.TCP.Enable, "Subscriber.Layer.TCP.Enable mismatch");
     Assert.AreEqual(config.Subscriber.DropOutOfOrderMessages, ecalConfig.Subscriber.DropOutOfOrderMessages, "Subscriber.DropOutOfOrderMessages mismatch");
+    Assert.AreEqual(config.Subscriber.MaxFrequencyMhz, ecalConfig.Subscriber.MaxFrequencyMhz, "Subscriber.MaxFrequencyMhz mismatch");
+    Assert.AreEqual(config.Subscriber.Downsampling, ecalConfig.Subscriber.Downsampling, "Subscriber.Downsampling mismatch");
 
     // TimeSync
     Assert.AreEqual(config.TimeSync.TimeSyncModuleReplay, ecalConfig.TimeSync.TimeSyncModuleReplay, "TimeSync.TimeSyncModuleReplay mismatch");
@@ -43,6 +43,9 @@ namespace Eclipse {
           property unsigned int MemfileBufferCount;
           property unsigned int MemfileMinSizeBytes;
           property unsigned int MemfileReservePercent;
+          property bool MemfileMemfd;
+          property bool MemfileHugePages;
+          property bool MemfilePrefault;
 
           PublisherLayerSHMConfiguration() {
             ::eCAL::Publisher::Layer::SHM::Configuration native_config;
@@ -52,6 +55,9 @@ namespace Eclipse {
             MemfileBufferCount = native_config.memfile_buffer_count;
             MemfileMinSizeBytes = native_config.memfile_min_size_bytes;
             MemfileReservePercent = native_config.memfile_reserve_percent;
+            MemfileMemfd = native_config.memfile_memfd;
+            MemfileHugePages = native_config.memfile_huge_pages;
+            MemfilePrefault = native_config.memfile_prefault;
           }
 
           // Native struct constructor
@@ -62,6 +68,9 @@ namespace Eclipse {
             MemfileBufferCount = native_config.memfile_buffer_count;
             MemfileMinSizeBytes = native_config.memfile_min_size_bytes;
             MemfileReservePercent = native_config.memfile_reserve_percent;
+            MemfileMemfd = native_config.memfile_memfd;
+            MemfileHugePages = native_config.memfile_huge_pages;
+            MemfilePrefault = native_config.memfile_prefault;
           }
 
           ::eCAL::Publisher::Layer::SHM::Configuration ToNative() {
@@ -72,6 +81,9 @@ namespace Eclipse {
             native_config.memfile_buffer_count = MemfileBufferCount;
             native_config.memfile_min_size_bytes = MemfileMinSizeBytes;
             native_config.memfile_reserve_percent = MemfileReservePercent;
+            native_config.memfile_memfd = MemfileMemfd;
+            native_config.memfile_huge_pages = MemfileHugePages;
+            native_config.memfile_prefault = MemfilePrefault;
             return native_config;
           }
         };
@@ -82,20 +94,32 @@ namespace Eclipse {
         public ref class PublisherLayerUDPConfiguration {
         public:
           property bool Enable;
+          property bool CoalescingEnable;
+          property unsigned int CoalescingMaxDelayUs;
+          property unsigned int CoalescingMaxSize;
 
           PublisherLayerUDPConfiguration() {
             ::eCAL::Publisher::Layer::UDP::Configuration native_config;
             Enable = native_config.enable;
+            CoalescingEnable = native_config.coalescing_enable;
+            CoalescingMaxDelayUs = native_config.coalescing_max_delay_us;
+            CoalescingMaxSize = native_config.coalescing_max_size;
           }
 
           // Native struct constructor
           PublisherLayerUDPConfiguration(const ::eCAL::Publisher::Layer::UDP::Configuration& native_config) {
             Enable = native_config.enable;
+            CoalescingEnable = native_config.coalescing_enable;
+            CoalescingMaxDelayUs = native_config.coalescing_max_delay_us;
+            CoalescingMaxSize = native_config.coalescing_max_size;
           }
 
           ::eCAL::Publisher::Layer::UDP::Configuration ToNative() {
             ::eCAL::Publisher::Layer::UDP::Configuration native_config;
             native_config.enable = Enable;
+            native_config.coalescing_enable = CoalescingEnable;
+            native_config.coalescing_max_delay_us = CoalescingMaxDelayUs;
+            native_config.coalescing_max_size = CoalescingMaxSize;
             return native_config;
           }
         };
@@ -224,6 +224,8 @@ namespace Eclipse {
           property unsigned int RegistrationTimeout;
           property unsigned int RegistrationRefresh;
           property bool Loopback;
+          property bool FastDiscovery;
+          property unsigned int DescriptorRefresh;
           property System::String^ ShmTransportDomain;
           property RegistrationLocalConfiguration^ Local;
           property RegistrationNetworkConfiguration^ Network;
@@ -233,6 +235,8 @@ namespace Eclipse {
             RegistrationTimeout = native_config.registration_timeout;
             RegistrationRefresh = native_config.registration_refresh;
             Loopback = native_config.loopback;
+            FastDiscovery = native_config.fast_discovery;
+            DescriptorRefresh = native_config.descriptor_refresh;
             ShmTransportDomain = Internal::StlStringToString(native_config.shm_transport_domain);
             Local = gcnew RegistrationLocalConfiguration(native_config.local);
             Network = gcnew RegistrationNetworkConfiguration(native_config.network);
@@ -243,6 +247,8 @@ namespace Eclipse {
             RegistrationTimeout = native_config.registration_timeout;
             RegistrationRefresh = native_config.registration_refresh;
             Loopback = native_config.loopback;
+            FastDiscovery = native_config.fast_discovery;
+            DescriptorRefresh = native_config.descriptor_refresh;
             ShmTransportDomain = Internal::StlStringToString(native_config.shm_transport_domain);
             Local = gcnew RegistrationLocalConfiguration(native_config.local);
             Network = gcnew RegistrationNetworkConfiguration(native_config.network);
@@ -253,6 +259,8 @@ namespace Eclipse {
             native_config.registration_timeout = RegistrationTimeout;
             native_config.registration_refresh = RegistrationRefresh;
             native_config.loopback = Loopback;
+            native_config.fast_discovery = FastDiscovery;
+            native_config.descriptor_refresh = DescriptorRefresh;
             native_config.shm_transport_domain = Internal::StringToStlString(ShmTransportDomain);
             native_config.local = Local->ToNative();
             native_config.network = Network->ToNative();
@@ -140,23 +140,31 @@ namespace Eclipse {
         public:
           property SubscriberLayerConfiguration^ Layer;
           property bool DropOutOfOrderMessages;
+          property unsigned int MaxFrequencyMhz;
+          property unsigned int Downsampling;
 
           SubscriberConfiguration() {
             ::eCAL::Subscriber::Configuration native_config;
             Layer = gcnew SubscriberLayerConfiguration(native_config.layer);
             DropOutOfOrderMessages = native_config.drop_out_of_order_messages;
+            MaxFrequencyMhz = native_config.max_frequency_mhz;
+            Downsampling = native_config.downsampling;
           }
 
           // Native struct constructor
           SubscriberConfiguration(const ::eCAL::Subscriber::Configuration& native_config) {
             Layer = gcnew SubscriberLayerConfiguration(native_config.layer);
             DropOutOfOrderMessages = native_config.drop_out_of_order_messages;
+            MaxFrequencyMhz = native_config.max_frequency_mhz;
+            Downsampling = native_config.downsampling;
           }
 
           ::eCAL::Subscriber::Configuration ToNative() {
             ::eCAL::Subscriber::Configuration native_config;
             native_config.layer = Layer->ToNative();
             native_config.drop_out_of_order_messages = DropOutOfOrderMessages;
+            native_config.max_frequency_mhz = MaxFrequencyMhz;
+            native_config.downsampling = Downsampling;
             return native_config;
           }
         };
@@ -98,6 +98,7 @@ namespace Eclipse {
           property unsigned int ReceiveBuffer;
           property bool JoinAllInterfaces;
           property bool NpcapEnabled;
+          property unsigned int TopicGroupPoolSize;
           property TransportLayerUdpMulticastConfiguration^ Network;
           property TransportLayerUdpMulticastConfiguration^ Local;
 
@@ -110,6 +111,7 @@ namespace Eclipse {
             ReceiveBuffer = native_config.receive_buffer;
             JoinAllInterfaces = native_config.join_all_interfaces;
             NpcapEnabled = native_config.npcap_enabled;
+            TopicGroupPoolSize = native_config.topic_group_pool_size;
             Network = gcnew TransportLayerUdpMulticastConfiguration(native_config.network);
             Local = gcnew TransportLayerUdpMulticastConfiguration(native_config.local);
           }
@@ -123,6 +125,7 @@ namespace Eclipse {
             ReceiveBuffer = native_config.receive_buffer;
             JoinAllInterfaces = native_config.join_all_interfaces;
             NpcapEnabled = native_config.npcap_enabled;
+            TopicGroupPoolSize = native_config.topic_group_pool_size;
             Network = gcnew TransportLayerUdpMulticastConfiguration(native_config.network);
             Local = gcnew TransportLayerUdpMulticastConfiguration(native_config.local);
           }
@@ -136,6 +139,7 @@ namespace Eclipse {
             native_config.receive_buffer = ReceiveBuffer;
             native_config.join_all_interfaces = JoinAllInterfaces;
             native_config.npcap_enabled = NpcapEnabled;
+            native_config.topic_group_pool_size = TopicGroupPoolSize;
             native_config.network = Network->ToNative();
             native_config.local = Local->ToNative();
             return native_config;
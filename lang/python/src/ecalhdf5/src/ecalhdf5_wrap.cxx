@@ -388,16 +388,27 @@ static PyObject* Meas_GetEntryData(Meas *self, PyObject *args)
   if (!PyArg_ParseTuple(args, "L", &entry_id))
     return nullptr;
 
+  // Uncompressed payloads are copied directly from the memory mapped file
+  eCAL::eh5::SEntryDataView data_view;
+  if (self->hdf5_meas->GetEntryDataView(entry_id, data_view))
+  {
+    return PyBytes_FromStringAndSize(static_cast<const char*>(data_view.data), (Py_ssize_t)data_view.size);
+  }
+
+  // Otherwise, the payload is read into the bytes object without an intermediate buffer
   size_t data_size = 0;
   self->hdf5_meas->GetEntryDataSize(entry_id, data_size);
-  auto data = calloc(data_size, sizeof(char));
-  self->hdf5_meas->GetEntryData(entry_id, data);
 
-  PyObject* py_data;
+  PyObject* py_data = PyBytes_FromStringAndSize(nullptr, (Py_ssize_t)data_size);
+  if (py_data == nullptr)
+    return nullptr;
 
-  py_data = Py_BuildValue("y#", data, (Py_ssize_t)data_size);
+  if ((data_size > 0) && !self->hdf5_meas->GetEntryData(entry_id, PyBytes_AS_STRING(py_data)))
+  {
+    // Keep the former behavior of returning zeroed data for unreadable entries
+    memset(PyBytes_AS_STRING(py_data), 0, data_size);
+  }
 
-  free(data);
   return py_data;
 }
 
@@ -38,12 +38,24 @@ void AddConfigPublisher(nanobind::module_& module)
     .def_rw("memfile_min_size_bytes", &Layer::SHM::Configuration::memfile_min_size_bytes,
       "Default memory file size for new publishers")
     .def_rw("memfile_reserve_percent", &Layer::SHM::Configuration::memfile_reserve_percent,
-      "Dynamic memory file size reserve before recreation");
+      "Dynamic memory file size reserve before recreation")
+    .def_rw("memfile_memfd", &Layer::SHM::Configuration::memfile_memfd,
+      "Linux only: Pass anonymous memory files (memfd) to local subscribers via a Unix socket")
+    .def_rw("memfile_huge_pages", &Layer::SHM::Configuration::memfile_huge_pages,
+      "Linux only: Back large memory files by transparent huge pages if available")
+    .def_rw("memfile_prefault", &Layer::SHM::Configuration::memfile_prefault,
+      "Linux only: Populate memory files on creation to avoid page faults on the first send");
 
   // Bind Publisher::Layer::UDP::Configuration struct
   nb::class_<Layer::UDP::Configuration>(module, "PublisherLayerUDPConfiguration")
     .def(nb::init<>()) // Default constructor
-    .def_rw("enable", &Layer::UDP::Configuration::enable, "Enable UDP layer");
+    .def_rw("enable", &Layer::UDP::Configuration::enable, "Enable UDP layer")
+    .def_rw("coalescing_enable", &Layer::UDP::Configuration::coalescing_enable,
+      "Pack small samples of different topics into one multi-sample frame")
+    .def_rw("coalescing_max_delay_us", &Layer::UDP::Configuration::coalescing_max_delay_us,
+      "Maximum time a sample is held back before its frame is sent in microseconds")
+    .def_rw("coalescing_max_size", &Layer::UDP::Configuration::coalescing_max_size,
+      "Maximum frame size in bytes, larger samples are sent on their own");
 
   // Bind Publisher::Layer::TCP::Configuration struct
   nb::class_<Layer::TCP::Configuration>(module, "PublisherLayerTCPConfiguration")
@@ -71,6 +71,8 @@ void AddConfigRegistration(nanobind::module_& module)
     .def_rw("registration_timeout", &eCAL::Registration::Configuration::registration_timeout)
     .def_rw("registration_refresh", &eCAL::Registration::Configuration::registration_refresh)
     .def_rw("loopback", &eCAL::Registration::Configuration::loopback)
+    .def_rw("fast_discovery", &eCAL::Registration::Configuration::fast_discovery)
+    .def_rw("descriptor_refresh", &eCAL::Registration::Configuration::descriptor_refresh)
     .def_rw("shm_transport_domain", &eCAL::Registration::Configuration::shm_transport_domain)
     .def_rw("local", &eCAL::Registration::Configuration::local)
     .def_rw("network", &eCAL::Registration::Configuration::network);
@@ -52,5 +52,9 @@ void AddConfigSubscriber(nanobind::module_& module)
     .def(nb::init<>()) // Default constructor
     .def_rw("layer", &Configuration::layer, "Layer configuration for subscriber")
     .def_rw("drop_out_of_order_messages", &Configuration::drop_out_of_order_messages,
-      "Enable dropping of out-of-order messages (Default: true)");
+      "Enable dropping of out-of-order messages (Default: true)")
+    .def_rw("max_frequency_mhz", &Configuration::max_frequency_mhz,
+      "Maximum rate at which samples of a publisher are received in mHz, 0 = no limit (Default: 0)")
+    .def_rw("downsampling", &Configuration::downsampling,
+      "Receive only every n-th sample of a publisher, 0 or 1 = every sample (Default: 1)");
 }
@@ -51,6 +51,8 @@ void AddConfigTransportLayer(nanobind::module_& module)
       "Enable joining multicast groups on all network interfaces (Linux-specific)")
     .def_rw("npcap_enabled", &UDP::Configuration::npcap_enabled,
       "Enable UDP traffic reception with Npcap-based receiver")
+    .def_rw("topic_group_pool_size", &UDP::Configuration::topic_group_pool_size,
+      "Number of multicast groups topic payloads are spread over in network mode (0 = all topics on the group base)")
     .def_rw("network", &UDP::Configuration::network, "Network multicast configuration")
     .def_rw("local", &UDP::Configuration::local, "Local multicast configuration");
 
@@ -18,6 +18,7 @@
 */
 
 #include <core/pubsub/py_publisher.h>
+#include <ecal/pubsub/payload_writer.h>
 #include <ecal/pubsub/publisher.h>
 
 // Nanobind includes to map stl types to python types
@@ -25,10 +26,101 @@
 #include <nanobind/stl/string.h>
 
 #include <exception>
+#include <iostream>
 
 namespace nb = nanobind;
 using namespace eCAL;
 
+namespace
+{
+  /**
+   * @brief Exports a contiguous buffer of a Python object (bytes, bytearray, memoryview, numpy array ...).
+   *
+   * Must be created and destroyed while holding the GIL. While the buffer is exported,
+   * the object cannot be resized, so the memory can be read with the GIL released.
+   */
+  class CPythonBuffer
+  {
+  public:
+    explicit CPythonBuffer(const nb::object& object_)
+    {
+      if (PyObject_GetBuffer(object_.ptr(), &m_view, PyBUF_C_CONTIGUOUS) != 0)
+      {
+        throw nb::python_error();
+      }
+    }
+
+    ~CPythonBuffer()
+    {
+      PyBuffer_Release(&m_view);
+    }
+
+    CPythonBuffer(const CPythonBuffer&) = delete;
+    CPythonBuffer& operator=(const CPythonBuffer&) = delete;
+
+    const void* Data() const { return m_view.buf; }
+    size_t      Size() const { return static_cast<size_t>(m_view.len); }
+
+  private:
+    Py_buffer m_view{};
+  };
+
+  /**
+   * @brief Payload writer, that lets a Python callback fill the transport buffer (e.g. the SHM memfile) directly.
+   *
+   * The callback gets a writable memoryview of the buffer, that is released when the callback returns.
+   */
+  class CPythonPayloadWriter : public CPayloadWriter
+  {
+  public:
+    CPythonPayloadWriter(const nb::callable& fill_callback_, size_t size_)
+      : m_fill_callback(fill_callback_)
+      , m_size(size_)
+    {}
+
+    bool WriteFull(void* buf_, size_t len_) override
+    {
+      if (len_ < m_size) return false;
+
+      nb::gil_scoped_acquire acquire;
+      PyObject* raw_view = PyMemoryView_FromMemory(static_cast<char*>(buf_), static_cast<Py_ssize_t>(m_size), PyBUF_WRITE);
+      if (raw_view == nullptr)
+      {
+        PyErr_Clear();
+        return false;
+      }
+      const nb::object view = nb::steal(raw_view);
+
+      bool written = true;
+      try
+      {
+        m_fill_callback(view);
+      }
+      catch (const std::exception& e)
+      {
+        std::cout << "Error invoking payload callback: " << e.what() << std::endl;
+        written = false;
+      }
+
+      try
+      {
+        view.attr("release")();
+      }
+      catch (const nb::python_error&)
+      {
+        // still exported, the error is discarded
+      }
+      return written;
+    }
+
+    size_t GetSize() override { return m_size; }
+
+  private:
+    const nb::callable& m_fill_callback;
+    size_t              m_size;
+  };
+}
+
 void AddPubsubPublisher(nanobind::module_& module)
 {
   // Define CPublisher class
@@ -67,6 +159,31 @@ void AddPubsubPublisher(nanobind::module_& module)
       nb::arg("payload"), 
       nb::arg("time") = CPublisher::DEFAULT_TIME_ARGUMENT,
       "Send a message as raw bytes.")
+    // Send function for any object supporting the buffer protocol (bytearray, memoryview, numpy array ...)
+    .def("send", [](CPublisher& pub, nb::object payload, long long time) {
+        // the buffer is exported without a copy and written directly into the transport buffer
+        const CPythonBuffer buffer(payload);
+        bool sent = false;
+        {
+          nb::gil_scoped_release release_gil;
+          sent = pub.Send(buffer.Data(), buffer.Size(), time);
+        }
+        return sent;
+      },
+      nb::arg("payload"),
+      nb::arg("time") = CPublisher::DEFAULT_TIME_ARGUMENT,
+      "Send a message from any C-contiguous object supporting the buffer protocol (e.g. bytearray, memoryview, numpy array) without converting it to bytes.")
+    .def("send_with_writer", [](CPublisher& pub, size_t size, const nb::callable& fill_callback, long long time) {
+        CPythonPayloadWriter payload_writer(fill_callback, size);
+        // we need to release the GIL, the payload writer acquires it again to call the callback
+        nb::gil_scoped_release release_gil;
+        return pub.Send(payload_writer, time);
+      },
+      nb::arg("size"),
+      nb::arg("fill_callback"),
+      nb::arg("time") = CPublisher::DEFAULT_TIME_ARGUMENT,
+      "Send a message of the given size, that is written by fill_callback(view) directly into the transport buffer (e.g. the shared memory file).\n"
+      "The writable memoryview is only valid during the callback, e.g. numpy.frombuffer(view, dtype) can be used to fill it.")
     .def("get_subscriber_count", &CPublisher::GetSubscriberCount,
       "Get the number of connected subscribers.")
     .def("get_topic_name", &CPublisher::GetTopicName,
@@ -24,12 +24,187 @@
 #include <nanobind/stl/string.h>
 
 #include <helper/make_gil_safe_shared.h>
+#include <helper/receive_buffer_view.h>
 
+#include <condition_variable>
+#include <deque>
 #include <exception>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 namespace nb = nanobind;
 using namespace eCAL;
 
+namespace
+{
+  /**
+   * @brief Queues received samples and hands them to Python in batches.
+   *
+   * The transport thread only copies the sample into the queue, it never waits for the GIL.
+   * A worker thread acquires the GIL once per batch and calls the Python callback with
+   * a list of all queued samples. Payload buffers are reused for later samples, so the
+   * buffer of the passed data is invalidated when the callback returns.
+   */
+  class CBatchedReceiveDispatcher
+  {
+  public:
+    CBatchedReceiveDispatcher(std::shared_ptr<nb::callable> callback_, size_t max_batch_size_, size_t max_queue_size_)
+      : m_callback(std::move(callback_))
+      , m_max_batch_size(max_batch_size_)
+      , m_max_queue_size(max_queue_size_)
+    {
+      m_thread = std::thread(&CBatchedReceiveDispatcher::Run, this);
+    }
+
+    ~CBatchedReceiveDispatcher()
+    {
+      {
+        const std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+      }
+      m_cv.notify_all();
+
+      // the worker needs the GIL to finish its current batch
+      if (PyGILState_Check() != 0)
+      {
+        nb::gil_scoped_release release;
+        m_thread.join();
+      }
+      else
+      {
+        m_thread.join();
+      }
+    }
+
+    CBatchedReceiveDispatcher(const CBatchedReceiveDispatcher&) = delete;
+    CBatchedReceiveDispatcher& operator=(const CBatchedReceiveDispatcher&) = delete;
+
+    void Push(const STopicId& publisher_id_, const SDataTypeInformation& datatype_info_, const SReceiveCallbackData& data_)
+    {
+      {
+        const std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_stop) return;
+
+        if ((m_max_queue_size > 0) && (m_queue.size() >= m_max_queue_size))
+        {
+          m_free_payloads.push_back(std::move(m_queue.front().payload));
+          m_queue.pop_front();
+        }
+
+        SSample sample;
+        sample.publisher_id   = publisher_id_;
+        sample.send_timestamp = data_.send_timestamp;
+        sample.send_clock     = data_.send_clock;
+
+        // the datatype information rarely changes, so it is shared between the queued samples
+        if (!m_datatype_info || !(*m_datatype_info == datatype_info_))
+        {
+          m_datatype_info = std::make_shared<const SDataTypeInformation>(datatype_info_);
+        }
+        sample.datatype_info = m_datatype_info;
+
+        if (!m_free_payloads.empty())
+        {
+          sample.payload = std::move(m_free_payloads.back());
+          m_free_payloads.pop_back();
+        }
+        const char* buffer = static_cast<const char*>(data_.buffer);
+        sample.payload.assign(buffer, buffer + data_.buffer_size);
+
+        m_queue.push_back(std::move(sample));
+      }
+      m_cv.notify_one();
+    }
+
+  private:
+    struct SSample
+    {
+      STopicId                                    publisher_id;
+      std::shared_ptr<const SDataTypeInformation> datatype_info;
+      std::vector<char>                           payload;
+      long long                                   send_timestamp = 0;
+      long long                                   send_clock     = 0;
+    };
+
+    void Run()
+    {
+      std::deque<SSample> batch;
+      for (;;)
+      {
+        {
+          std::unique_lock<std::mutex> lock(m_mutex);
+          m_cv.wait(lock, [this]() { return m_stop || !m_queue.empty(); });
+          if (m_stop) return;
+
+          if ((m_max_batch_size == 0) || (m_queue.size() <= m_max_batch_size))
+          {
+            batch.swap(m_queue);
+          }
+          else
+          {
+            for (size_t i = 0; i < m_max_batch_size; ++i)
+            {
+              batch.push_back(std::move(m_queue.front()));
+              m_queue.pop_front();
+            }
+          }
+        }
+
+        try
+        {
+          nb::gil_scoped_acquire acquire;
+          // memoryviews and data of the queued payloads are invalidated when the callback returns
+          const CReceiveBufferViewScope view_scope;
+
+          nb::list samples;
+          for (const auto& sample : batch)
+          {
+            SReceiveCallbackData data;
+            data.buffer         = sample.payload.data();
+            data.buffer_size    = sample.payload.size();
+            data.send_timestamp = sample.send_timestamp;
+            data.send_clock     = sample.send_clock;
+            samples.append(nb::make_tuple(sample.publisher_id, *sample.datatype_info, CReceiveBufferViewScope::CreateCallbackData(data)));
+          }
+          (*m_callback)(samples);
+        }
+        catch (const std::exception& e)
+        {
+          std::cout << "Error invoking batched callback: " << e.what() << std::endl;
+        }
+
+        {
+          // keep a few payload buffers for the next samples
+          const std::lock_guard<std::mutex> lock(m_mutex);
+          for (auto& sample : batch)
+          {
+            if (m_free_payloads.size() >= max_free_payloads) break;
+            m_free_payloads.push_back(std::move(sample.payload));
+          }
+        }
+        batch.clear();
+      }
+    }
+
+    static constexpr size_t max_free_payloads = 4;
+
+    std::shared_ptr<nb::callable>               m_callback;
+    const size_t                                m_max_batch_size;
+    const size_t                                m_max_queue_size;
+
+    std::mutex                                  m_mutex;
+    std::condition_variable                     m_cv;
+    bool                                        m_stop = false;
+    std::deque<SSample>                         m_queue;
+    std::vector<std::vector<char>>              m_free_payloads;
+    std::shared_ptr<const SDataTypeInformation> m_datatype_info;
+    std::thread                                 m_thread;
+  };
+}
+
 void AddPubsubSubscriber(nanobind::module_& module)
 {
     // Define Subscriber class
@@ -66,11 +241,13 @@ void AddPubsubSubscriber(nanobind::module_& module)
         // increased when we set the callback. Because we cannot hold the GIL when we set the callback, du to potential deadlocks
         // also we need to make sure that the GIL is held whenever the callback is destroyed
         auto python_callback_pointer = make_gil_safe_shared<nb::callable>(py_callback);
-        auto wrapped_callback = [python_callback_pointer](auto&&... args) {
+        auto wrapped_callback = [python_callback_pointer](const STopicId& publisher_id_, const SDataTypeInformation& datatype_info_, const SReceiveCallbackData& data_) {
           try {
             nb::gil_scoped_acquire acquire;
+            // memoryviews and data of the receive buffer are invalidated when the callback returns
+            const CReceiveBufferViewScope view_scope;
             // Call the Python callback, forwarding the arguments.
-            (*python_callback_pointer)(std::forward<decltype(args)>(args)...);
+            (*python_callback_pointer)(publisher_id_, datatype_info_, CReceiveBufferViewScope::CreateCallbackData(data_));
           }
           catch (const std::exception& e)
           {
@@ -82,6 +259,23 @@ void AddPubsubSubscriber(nanobind::module_& module)
         self.SetReceiveCallback(wrapped_callback);
       },
       nb::arg("callback"))
+    .def("set_receive_callback_batched",
+      [](CSubscriber& self, const nb::callable& py_callback, size_t max_batch_size, size_t max_queue_size) {
+        auto dispatcher = std::make_shared<CBatchedReceiveDispatcher>(make_gil_safe_shared<nb::callable>(py_callback), max_batch_size, max_queue_size);
+        auto wrapped_callback = [dispatcher](const STopicId& publisher_id_, const SDataTypeInformation& datatype_info_, const SReceiveCallbackData& data_) {
+          dispatcher->Push(publisher_id_, datatype_info_, data_);
+        };
+
+        nb::gil_scoped_release release;
+        self.SetReceiveCallback(wrapped_callback);
+      },
+      nb::arg("callback"),
+      nb::arg("max_batch_size") = 0,
+      nb::arg("max_queue_size") = 0,
+      "Set a callback, that receives a list of (publisher_id, data_type_info, data) tuples.\n"
+      "The samples are copied and queued, the callback is called with all queued samples (at most max_batch_size, 0 = no limit) "
+      "per GIL acquisition. If max_queue_size (0 = no limit) samples are queued, the oldest ones are dropped.\n"
+      "The payload buffers are reused, the data buffer is only valid during the callback. Use copy_buffer() to keep it.")
     .def("remove_receive_callback", &CSubscriber::RemoveReceiveCallback,
       "Remove a previously set receive callback.")
     .def("get_publisher_count", &CSubscriber::GetPublisherCount,
@@ -22,11 +22,23 @@
 
 #include <nanobind/stl/string.h>
 
+#include <helper/receive_buffer_view.h>
+
 #include <sstream>
 
 namespace nb = nanobind;
 using namespace eCAL;
 
+namespace
+{
+  const SReceiveCallbackData& CheckReceiveBuffer(const SReceiveCallbackData& data_)
+  {
+    if (!CReceiveBufferViewScope::IsValid(data_))
+      throw nb::value_error("The receive buffer is only valid during the receive callback, use copy_buffer() to keep it");
+    return data_;
+  }
+}
+
 void AddPubsubTypes(nanobind::module_& module)
 {
 
@@ -74,8 +86,18 @@ void AddPubsubTypes(nanobind::module_& module)
         .def(nb::init<>())
         .def_prop_ro("buffer", [](const SReceiveCallbackData& data) -> nb::bytes {
           // Cast the void* to const char* and create a nb::bytes from it.
+          CheckReceiveBuffer(data);
+          return nb::bytes(static_cast<const char*>(data.buffer), data.buffer_size);
+          }, "Payload buffer as Python bytes (copy)")
+        .def_prop_ro("buffer_view", [](const SReceiveCallbackData& data) -> nb::object {
+          CheckReceiveBuffer(data);
+          return CReceiveBufferViewScope::CreateView(data.buffer, data.buffer_size);
+          }, "Read-only memoryview of the payload without a copy, only valid during the receive callback")
+        .def("copy_buffer", [](const SReceiveCallbackData& data) -> nb::bytes {
+          CheckReceiveBuffer(data);
           return nb::bytes(static_cast<const char*>(data.buffer), data.buffer_size);
-          }, "Payload buffer as Python bytes")
+          }, "Copy the payload into Python bytes, e.g. to keep it after the receive callback")
+        .def_ro("buffer_size", &eCAL::SReceiveCallbackData::buffer_size, "Payload buffer size")
         .def_ro("send_timestamp", &eCAL::SReceiveCallbackData::send_timestamp, "Publisher send timestamp (µs)")
         .def_ro("send_clock", &eCAL::SReceiveCallbackData::send_clock, "Publisher send clock counter");
 
@@ -0,0 +1,147 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @file   helper/receive_buffer_view.h
+ * @brief  Read-only memoryviews and callback data of receive buffers, that are invalidated after the receive callback.
+**/
+
+#pragma once
+
+#include <nanobind/nanobind.h>
+
+#include <ecal/pubsub/types.h>
+
+#include <cstddef>
+#include <vector>
+
+/**
+ * @brief Tracks the memoryviews and callback data objects created during one Python receive callback on this thread.
+ *
+ * A receive buffer is only valid during the callback. When the scope ends, all memoryviews
+ * created in it are released and the buffer of all callback data objects is reset, so accessing
+ * them later raises a ValueError instead of reading freed or reused memory. Views that are still
+ * exported (e.g. to a numpy array) cannot be released and must not be used after the callback.
+ *
+ * Must be created and destroyed while holding the GIL.
+ */
+class CReceiveBufferViewScope
+{
+public:
+  CReceiveBufferViewScope() : m_parent(Current())
+  {
+    Current() = this;
+  }
+
+  ~CReceiveBufferViewScope()
+  {
+    for (auto& view : m_views)
+    {
+      try
+      {
+        view.attr("release")();
+      }
+      catch (const nanobind::python_error&)
+      {
+        // still exported, the error is discarded
+      }
+    }
+    m_views.clear();
+
+    for (auto& data : m_callback_data)
+    {
+      nanobind::inst_ptr<eCAL::SReceiveCallbackData>(data)->buffer = nullptr;
+    }
+    m_callback_data.clear();
+
+    Current() = m_parent;
+  }
+
+  CReceiveBufferViewScope(const CReceiveBufferViewScope&) = delete;
+  CReceiveBufferViewScope& operator=(const CReceiveBufferViewScope&) = delete;
+
+  /**
+   * @brief Create a read-only memoryview of a receive buffer.
+   *
+   * Outside of a receive callback the validity of the buffer is unknown, so a view of a copy is returned.
+   */
+  static nanobind::object CreateView(const void* buffer_, size_t size_)
+  {
+    static char empty_buffer = 0;
+    if ((buffer_ == nullptr) || (size_ == 0))
+    {
+      buffer_ = &empty_buffer;
+      size_   = 0;
+    }
+
+    CReceiveBufferViewScope* scope = Current();
+    if (scope == nullptr)
+    {
+      const nanobind::bytes copy(static_cast<const char*>(buffer_), size_);
+      PyObject* copy_view = PyMemoryView_FromObject(copy.ptr());
+      if (copy_view == nullptr) throw nanobind::python_error();
+      return nanobind::steal(copy_view);
+    }
+
+    // PyMemoryView_FromMemory takes a non-const pointer, the view is read-only
+    PyObject* view = PyMemoryView_FromMemory(static_cast<char*>(const_cast<void*>(buffer_)), static_cast<Py_ssize_t>(size_), PyBUF_READ);
+    if (view == nullptr) throw nanobind::python_error();
+    scope->m_views.push_back(nanobind::borrow(view));
+    return nanobind::steal(view);
+  }
+
+  /**
+   * @brief Create the Python object of the receive callback data, which is passed to the Python callback.
+   *
+   * The object holds a copy of the data, its buffer is reset when the scope ends.
+   * Outside of a receive callback the data is copied unchanged.
+   */
+  static nanobind::object CreateCallbackData(const eCAL::SReceiveCallbackData& data_)
+  {
+    nanobind::object data = nanobind::cast(data_, nanobind::rv_policy::copy);
+
+    CReceiveBufferViewScope* scope = Current();
+    if (scope != nullptr)
+    {
+      scope->m_callback_data.push_back(data);
+    }
+    return data;
+  }
+
+  /**
+   * @brief Whether the buffer of the receive callback data can still be accessed.
+   *
+   * The buffer of callback data created in a scope is reset when the scope ends.
+   */
+  static bool IsValid(const eCAL::SReceiveCallbackData& data_)
+  {
+    return (data_.buffer != nullptr) || (data_.buffer_size == 0);
+  }
+
+private:
+  static CReceiveBufferViewScope*& Current()
+  {
+    static thread_local CReceiveBufferViewScope* current = nullptr;
+    return current;
+  }
+
+  CReceiveBufferViewScope*             m_parent;
+  std::vector<nanobind::object>        m_views;
+  std::vector<nanobind::object>        m_callback_data;
+};
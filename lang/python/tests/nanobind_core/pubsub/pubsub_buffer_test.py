@@ -0,0 +1,214 @@
+# ========================= eCAL LICENSE =================================
+#
+# Copyright (C) 2016 - 2025 Continental Corporation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+# 
+#      http://www.apache.org/licenses/LICENSE-2.0
+# 
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+# ========================= eCAL LICENSE =================================
+
+
+import time
+import threading
+
+import pytest
+
+import ecal.nanobind_core as ecal_core
+
+@pytest.fixture(scope="module", autouse=True)
+def init_ecal():
+    ecal_core.initialize("ecal_pytest_pubsub_buffer", ecal_core.init.ALL)
+    yield
+    ecal_core.finalize()
+
+# Aliases for readability
+DataTypeInformation = ecal_core.DataTypeInformation
+Publisher           = ecal_core.Publisher
+Subscriber          = ecal_core.Subscriber
+
+DEFAULT_DTYPE = DataTypeInformation(
+    name="test_type",
+    encoding="raw",
+    descriptor=b""
+)
+
+CONNECT_TIMEOUT_S = 5.0
+RECEIVE_TIMEOUT_S = 2.0
+
+
+def create_connected_pair(topic_name : str):
+    publisher  = Publisher(topic_name, DEFAULT_DTYPE)
+    subscriber = Subscriber(topic_name, DEFAULT_DTYPE)
+
+    # give eCAL a moment to wire up
+    deadline = time.monotonic() + CONNECT_TIMEOUT_S
+    while publisher.get_subscriber_count() == 0 or subscriber.get_publisher_count() == 0:
+        assert time.monotonic() < deadline, "publisher and subscriber did not connect"
+        time.sleep(0.05)
+    return publisher, subscriber
+
+
+def wait_until(predicate, timeout_s : float = RECEIVE_TIMEOUT_S):
+    deadline = time.monotonic() + timeout_s
+    while not predicate():
+        if time.monotonic() > deadline:
+            return False
+        time.sleep(0.01)
+    return True
+
+
+def test_buffer_view_invalid_after_callback():
+    publisher, subscriber = create_connected_pair("pubsub_buffer_view")
+
+    received = threading.Event()
+    kept = {}
+    def on_receive(publisher_id, datatype_info, data):
+        # within the callback, the view and the data can be used
+        view = data.buffer_view
+        assert view.readonly
+        kept["payload"] = bytes(view)
+        kept["copy"]    = data.copy_buffer()
+        kept["view"]    = view
+        kept["data"]    = data
+        received.set()
+
+    subscriber.set_receive_callback(on_receive)
+    assert publisher.send(b"hello view") is True
+    assert received.wait(RECEIVE_TIMEOUT_S)
+    subscriber.remove_receive_callback()
+
+    assert kept["payload"] == b"hello view"
+    assert kept["copy"] == b"hello view"
+
+    # after the callback, the receive buffer must not be accessed anymore
+    with pytest.raises(ValueError):
+        bytes(kept["view"])
+    with pytest.raises(ValueError):
+        kept["data"].buffer
+    with pytest.raises(ValueError):
+        kept["data"].buffer_view
+    with pytest.raises(ValueError):
+        kept["data"].copy_buffer()
+
+    # the copy stays valid
+    assert kept["copy"] == b"hello view"
+    assert kept["data"].buffer_size == len(b"hello view")
+
+
+def test_buffer_view_outside_of_callback():
+    # outside of a receive callback, the view is a view of a copy
+    data = ecal_core.ReceiveCallbackData()
+    assert data.buffer == b""
+    assert bytes(data.buffer_view) == b""
+    assert data.copy_buffer() == b""
+
+
+def test_batched_delivery():
+    publisher, subscriber = create_connected_pair("pubsub_buffer_batched")
+
+    message_count  = 20
+    max_batch_size = 4
+
+    lock = threading.Lock()
+    payloads = []
+    batch_sizes = []
+    kept_data = []
+    def on_receive_batch(samples):
+        with lock:
+            batch_sizes.append(len(samples))
+            for publisher_id, datatype_info, data in samples:
+                assert publisher_id == publisher.get_topic_id()
+                assert datatype_info.name == DEFAULT_DTYPE.name
+                payloads.append(data.copy_buffer())
+                kept_data.append(data)
+
+    subscriber.set_receive_callback_batched(on_receive_batch, max_batch_size=max_batch_size)
+
+    expected = [("message %d" % i).encode() for i in range(message_count)]
+    for payload in expected:
+        assert publisher.send(payload) is True
+        time.sleep(0.01)
+
+    def all_received():
+        with lock:
+            return len(payloads) == message_count
+    assert wait_until(all_received)
+    subscriber.remove_receive_callback()
+
+    # samples are delivered in order and the batch size is limited
+    assert payloads == expected
+    assert all(0 < batch_size <= max_batch_size for batch_size in batch_sizes)
+
+    # the payload buffers are reused, so the data is invalid after the callback
+    for data in kept_data:
+        with pytest.raises(ValueError):
+            data.buffer
+
+
+def receive_single(publisher, subscriber, send):
+    received = threading.Event()
+    payloads = []
+    def on_receive(publisher_id, datatype_info, data):
+        payloads.append(data.copy_buffer())
+        received.set()
+
+    subscriber.set_receive_callback(on_receive)
+    assert send(publisher) is True
+    assert received.wait(RECEIVE_TIMEOUT_S)
+    subscriber.remove_receive_callback()
+    return payloads[0]
+
+
+def test_send_bytearray():
+    publisher, subscriber = create_connected_pair("pubsub_buffer_send_bytearray")
+
+    payload = bytearray(b"hello bytearray")
+    assert receive_single(publisher, subscriber, lambda pub: pub.send(payload)) == b"hello bytearray"
+
+
+def test_send_memoryview():
+    publisher, subscriber = create_connected_pair("pubsub_buffer_send_memoryview")
+
+    payload = memoryview(b"hello memoryview")
+    assert receive_single(publisher, subscriber, lambda pub: pub.send(payload)) == b"hello memoryview"
+
+
+def test_send_numpy_array():
+    numpy = pytest.importorskip("numpy")
+    publisher, subscriber = create_connected_pair("pubsub_buffer_send_numpy")
+
+    payload = numpy.arange(256, dtype=numpy.uint16)
+    received = receive_single(publisher, subscriber, lambda pub: pub.send(payload))
+    assert numpy.array_equal(numpy.frombuffer(received, dtype=numpy.uint16), payload)
+
+
+def test_send_non_contiguous_buffer_fails():
+    numpy = pytest.importorskip("numpy")
+    publisher = Publisher("pubsub_buffer_send_non_contiguous", DEFAULT_DTYPE)
+
+    payload = numpy.arange(16, dtype=numpy.uint8)[::2]
+    with pytest.raises(BufferError):
+        publisher.send(payload)
+
+
+def test_send_with_writer():
+    publisher, subscriber = create_connected_pair("pubsub_buffer_send_with_writer")
+
+    expected = b"written in place"
+    def fill(view):
+        assert not view.readonly
+        assert len(view) == len(expected)
+        view[:] = expected
+
+    received = receive_single(publisher, subscriber, lambda pub: pub.send_with_writer(len(expected), fill))
+    assert received == expected
+
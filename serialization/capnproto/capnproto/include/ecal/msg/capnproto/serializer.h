@@ -26,6 +26,8 @@
 
 #include <map>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <ecal/msg/capnproto/helper.h>
 #include <ecal/msg/exception.h>
 
@@ -74,12 +76,37 @@ namespace eCAL
           return(capnp::computeSerializedSizeInWords(const_cast<capnp::MallocMessageBuilder&>(message_builder_)) * sizeof(capnp::word));
         }
 
+        // Writes the message in the flat array format (segment table + segments) directly into buffer_,
+        // so the segments are copied once and no intermediate flat array is allocated.
         bool Serialize(const capnp::MallocMessageBuilder& message_builder_, void* buffer_, size_t size_) const
         {
-          kj::Array<capnp::word> words = capnp::messageToFlatArray(const_cast<capnp::MallocMessageBuilder&>(message_builder_));
-          kj::ArrayPtr<kj::byte> bytes = words.asBytes();
-          if (size_ < bytes.size()) return(false);
-          memcpy(buffer_, bytes.begin(), bytes.size());
+          const kj::ArrayPtr<const kj::ArrayPtr<const capnp::word>> segments = const_cast<capnp::MallocMessageBuilder&>(message_builder_).getSegmentsForOutput();
+          if (segments.size() == 0) return(false);
+
+          // segment count - 1 and the size of each segment (uint32, little endian), padded to a full word
+          const size_t table_size = (segments.size() / 2 + 1) * sizeof(capnp::word);
+          size_t message_size = table_size;
+          for (const auto& segment : segments)
+          {
+            message_size += segment.size() * sizeof(capnp::word);
+          }
+          if (size_ < message_size) return(false);
+
+          char* const buffer = static_cast<char*>(buffer_);
+          memset(buffer, 0, table_size);
+          WriteUInt32LE(buffer, static_cast<uint32_t>(segments.size() - 1));
+          for (size_t i = 0; i < segments.size(); ++i)
+          {
+            WriteUInt32LE(buffer + (i + 1) * sizeof(uint32_t), static_cast<uint32_t>(segments[i].size()));
+          }
+
+          char* segment_buffer = buffer + table_size;
+          for (const auto& segment : segments)
+          {
+            const size_t segment_size = segment.size() * sizeof(capnp::word);
+            memcpy(segment_buffer, segment.begin(), segment_size);
+            segment_buffer += segment_size;
+          }
           return(true);
         }
 
@@ -106,8 +133,49 @@ namespace eCAL
         }
 
       private:
+        static void WriteUInt32LE(char* buffer_, uint32_t value_)
+        {
+          buffer_[0] = static_cast<char>(value_ & 0xFF);
+          buffer_[1] = static_cast<char>((value_ >> 8) & 0xFF);
+          buffer_[2] = static_cast<char>((value_ >> 16) & 0xFF);
+          buffer_[3] = static_cast<char>((value_ >> 24) & 0xFF);
+        }
+
         capnp::MallocMessageBuilder m_msg_builder;
       };
+
+      /*
+      * Hands out the words of a received flat array, so a capnp::FlatArrayMessageReader
+      * can read it in place. Word aligned buffers are used as they are, unaligned
+      * buffers are copied into a reused aligned buffer first.
+      */
+      class FlatArrayView
+      {
+      public:
+        kj::ArrayPtr<const capnp::word> GetWords(const void* buffer_, size_t size_)
+        {
+          if ((buffer_ == nullptr) || (size_ % sizeof(capnp::word) != 0))
+          {
+            throw DeserializationException("Received data is no capnp message.");
+          }
+
+          const size_t word_count = size_ / sizeof(capnp::word);
+          if (reinterpret_cast<std::uintptr_t>(buffer_) % alignof(capnp::word) == 0)
+          {
+            return kj::arrayPtr(static_cast<const capnp::word*>(buffer_), word_count);
+          }
+
+          if (m_aligned_buffer.size() < word_count)
+          {
+            m_aligned_buffer = kj::heapArray<capnp::word>(word_count);
+          }
+          memcpy(m_aligned_buffer.begin(), buffer_, size_);
+          return kj::arrayPtr(static_cast<const capnp::word*>(m_aligned_buffer.begin()), word_count);
+        }
+
+      private:
+        kj::Array<capnp::word> m_aligned_buffer;
+      };
       
     template <typename DatatypeInformation>
     class DynamicSerializer
@@ -0,0 +1,192 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @file   view_subscriber.h
+ * @brief  eCAL zero-copy subscriber interface for Cap'n Proto message definitions
+**/
+
+#pragma once
+
+#include <ecal/msg/exception.h>
+#include <ecal/msg/capnproto/serializer.h>
+#include <ecal/pubsub/subscriber.h>
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+
+// capnp includes
+#ifdef _MSC_VER
+#pragma warning(push, 0)
+#endif /*_MSC_VER*/
+#include <capnp/serialize.h>
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif /*_MSC_VER*/
+
+namespace eCAL
+{
+  namespace capnproto
+  {
+    /**
+     * @brief  eCAL capnp subscriber class, that reads the messages in place.
+     *
+     * Unlike CSubscriber, that copies every message into a message builder, the
+     * callback gets a capnp::FlatArrayMessageReader built directly over the
+     * received buffer (e.g. the shared memory file). The reader and everything
+     * obtained from it are only valid during the callback.
+     *
+     * The buffer is only copied if it is not aligned to a capnp word.
+     *
+    **/
+    template <typename T>
+    class CViewSubscriber
+    {
+    public:
+      /**
+       * @brief eCAL message receive callback function.
+       *
+       * @param publisher_id_  Unique topic id of the publisher who published the data
+       * @param reader_        Message reader, call reader_.getRoot<T>() to access the message.
+       * @param time_          Message time stamp.
+       * @param clock_         Message writer clock.
+      **/
+      using DataCallbackT = std::function<void(const STopicId& publisher_id_, capnp::FlatArrayMessageReader& reader_, long long time_, long long clock_)>;
+
+      /**
+       * @brief Error callback that is called if the received data is no valid capnp message.
+      **/
+      using DeserializationErrorCallbackT = std::function<void(const std::string& error_message_, const STopicId& publisher_id_, const SDataTypeInformation& data_type_info_, const SReceiveCallbackData& data_)>;
+
+      /**
+       * @brief  Constructor.
+       *
+       * @param topic_name_      Unique topic name.
+       * @param config_          Optional configuration parameters.
+       * @param reader_options_  Optional capnp reader options (e.g. a higher traversal limit for large messages).
+      **/
+      explicit CViewSubscriber(const std::string& topic_name_, const Subscriber::Configuration& config_ = GetSubscriberConfiguration(), const capnp::ReaderOptions& reader_options_ = capnp::ReaderOptions())
+        : m_reader_options(reader_options_)
+        , m_subscriber(topic_name_, internal::Serializer<T, SDataTypeInformation>::GetDataTypeInformation(), config_)
+      {
+      }
+
+      CViewSubscriber(const std::string& topic_name_, const SubEventCallbackT& event_callback_, const Subscriber::Configuration& config_ = GetSubscriberConfiguration(), const capnp::ReaderOptions& reader_options_ = capnp::ReaderOptions())
+        : m_reader_options(reader_options_)
+        , m_subscriber(topic_name_, internal::Serializer<T, SDataTypeInformation>::GetDataTypeInformation(), event_callback_, config_)
+      {
+      }
+
+      CViewSubscriber(const CViewSubscriber&) = delete;
+      CViewSubscriber& operator=(const CViewSubscriber&) = delete;
+      CViewSubscriber(CViewSubscriber&&) = default;
+      CViewSubscriber& operator=(CViewSubscriber&&) = default;
+
+      ~CViewSubscriber() = default;
+
+      /**
+       * @brief Set the receive callback for incoming messages.
+       *
+       * @param data_callback_   The callback function.
+       * @param error_callback_  Error callback function, which is called if the received data is no valid capnp message.
+      **/
+      void SetReceiveCallback(DataCallbackT data_callback_, DeserializationErrorCallbackT error_callback_ = nullptr)
+      {
+        // the receive callback of one subscriber is never called concurrently, so the alignment buffer can be shared
+        auto view            = std::make_shared<internal::FlatArrayView>();
+        auto reader_options  = m_reader_options;
+        auto internal_receive_callback = [view, reader_options, data_callback_, error_callback_](const STopicId& publisher_id_, const SDataTypeInformation& data_type_info_, const SReceiveCallbackData& data_)
+        {
+          if (!data_callback_) return;
+
+          try
+          {
+            capnp::FlatArrayMessageReader reader(view->GetWords(data_.buffer, data_.buffer_size), reader_options);
+            data_callback_(publisher_id_, reader, data_.send_timestamp, data_.send_clock);
+          }
+          catch (const kj::Exception& error)
+          {
+            if (error_callback_) error_callback_(error.getDescription().cStr(), publisher_id_, data_type_info_, data_);
+          }
+          catch (const DeserializationException& error)
+          {
+            if (error_callback_) error_callback_(error.what(), publisher_id_, data_type_info_, data_);
+          }
+        };
+
+        m_subscriber.SetReceiveCallback(std::move(internal_receive_callback));
+      }
+
+      /**
+       * @brief  Remove receive callback for incoming messages.
+      **/
+      void RemoveReceiveCallback()
+      {
+        m_subscriber.RemoveReceiveCallback();
+      }
+
+      /**
+       * @brief Query the number of connected publishers.
+       *
+       * @return  Number of publishers.
+      **/
+      size_t GetPublisherCount() const
+      {
+        return m_subscriber.GetPublisherCount();
+      }
+
+      /**
+       * @brief Retrieve the topic name.
+       *
+       * @return  The topic name.
+      **/
+      const std::string& GetTopicName() const
+      {
+        return m_subscriber.GetTopicName();
+      }
+
+      /**
+       * @brief Retrieve the topic id.
+       *
+       * @return  The topic id.
+      **/
+      const STopicId& GetTopicId() const
+      {
+        return m_subscriber.GetTopicId();
+      }
+
+      /**
+       * @brief Retrieve the topic information.
+       *
+       * @return  The topic information.
+      **/
+      const SDataTypeInformation& GetDataTypeInformation() const
+      {
+        return m_subscriber.GetDataTypeInformation();
+      }
+
+    private:
+      capnp::ReaderOptions m_reader_options;
+      CSubscriber          m_subscriber;
+    };
+  }
+}
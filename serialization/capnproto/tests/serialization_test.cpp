@@ -126,3 +126,118 @@ TEST(SerializerTest, SerializeDeserializeDynamic)
   eCAL::capnproto::internal::DynamicSerializer<DataTypeInformation> dynamic_deserializer;
   capnp::DynamicStruct::Reader reader = dynamic_deserializer.Deserialize(buffer.data(), buffer.size(), info);
 }
+
+TEST(SerializerTest, SerializeMatchesFlatArray)
+{
+  capnp::MallocMessageBuilder message;
+  AddressBook::Builder addressBook = message.initRoot<AddressBook>();
+  buildAddressBook(addressBook);
+
+  eCAL::capnproto::internal::Serializer<AddressBook, DataTypeInformation> serializer;
+
+  // the segments are written directly, the result has to match capnp's own flat array
+  const size_t size = serializer.MessageSize(message);
+  std::vector<capnp::word> buffer(size / sizeof(capnp::word));
+  EXPECT_TRUE(serializer.Serialize(message, buffer.data(), size));
+  EXPECT_FALSE(serializer.Serialize(message, buffer.data(), size - 1));
+
+  kj::Array<capnp::word> flat_array = capnp::messageToFlatArray(message);
+  ASSERT_EQ(flat_array.asBytes().size(), size);
+  EXPECT_EQ(memcmp(flat_array.begin(), buffer.data(), size), 0);
+
+  // read in place
+  capnp::FlatArrayMessageReader reader(kj::arrayPtr(buffer.data(), buffer.size()));
+  auto people = reader.getRoot<AddressBook>().getPeople();
+  ASSERT_EQ(people.size(), 2);
+  EXPECT_EQ(std::string(people[0].getName().cStr()), "Alice");
+  EXPECT_EQ(std::string(people[1].getEmail().cStr()), "bob@example.com");
+}
+
+TEST(SerializerTest, SerializeMultipleSegments)
+{
+  // small fixed size segments force a message with several segments
+  capnp::MallocMessageBuilder message(8, capnp::AllocationStrategy::FIXED_SIZE);
+  AddressBook::Builder addressBook = message.initRoot<AddressBook>();
+  buildAddressBook(addressBook);
+  ASSERT_GT(message.getSegmentsForOutput().size(), 1);
+
+  eCAL::capnproto::internal::Serializer<AddressBook, DataTypeInformation> serializer;
+
+  const size_t size = serializer.MessageSize(message);
+  std::vector<capnp::word> buffer(size / sizeof(capnp::word));
+  EXPECT_TRUE(serializer.Serialize(message, buffer.data(), size));
+
+  kj::Array<capnp::word> flat_array = capnp::messageToFlatArray(message);
+  ASSERT_EQ(flat_array.asBytes().size(), size);
+  EXPECT_EQ(memcmp(flat_array.begin(), buffer.data(), size), 0);
+}
+
+TEST(SerializerTest, FlatArrayViewAligned)
+{
+  capnp::MallocMessageBuilder message;
+  AddressBook::Builder addressBook = message.initRoot<AddressBook>();
+  buildAddressBook(addressBook);
+
+  eCAL::capnproto::internal::Serializer<AddressBook, DataTypeInformation> serializer;
+
+  const size_t size = serializer.MessageSize(message);
+  std::vector<capnp::word> buffer(size / sizeof(capnp::word));
+  ASSERT_TRUE(serializer.Serialize(message, buffer.data(), size));
+
+  // a word aligned receive buffer is read in place, nothing is copied
+  eCAL::capnproto::internal::FlatArrayView view;
+  const kj::ArrayPtr<const capnp::word> words = view.GetWords(buffer.data(), size);
+  EXPECT_EQ(words.begin(), buffer.data());
+  EXPECT_EQ(words.size(), buffer.size());
+
+  capnp::FlatArrayMessageReader reader(words);
+  auto people = reader.getRoot<AddressBook>().getPeople();
+  ASSERT_EQ(people.size(), 2);
+  EXPECT_EQ(std::string(people[0].getName().cStr()), "Alice");
+  EXPECT_EQ(std::string(people[1].getEmail().cStr()), "bob@example.com");
+}
+
+TEST(SerializerTest, FlatArrayViewUnaligned)
+{
+  capnp::MallocMessageBuilder message;
+  AddressBook::Builder addressBook = message.initRoot<AddressBook>();
+  buildAddressBook(addressBook);
+
+  eCAL::capnproto::internal::Serializer<AddressBook, DataTypeInformation> serializer;
+
+  // place the message one byte behind a word boundary
+  const size_t size = serializer.MessageSize(message);
+  std::vector<capnp::word> storage(size / sizeof(capnp::word) + 1);
+  char* unaligned_buffer = reinterpret_cast<char*>(storage.data()) + 1;
+  ASSERT_NE(reinterpret_cast<std::uintptr_t>(unaligned_buffer) % alignof(capnp::word), 0u);
+  ASSERT_TRUE(serializer.Serialize(message, unaligned_buffer, size));
+
+  // an unaligned receive buffer is copied into the aligned buffer of the view
+  eCAL::capnproto::internal::FlatArrayView view;
+  const kj::ArrayPtr<const capnp::word> words = view.GetWords(unaligned_buffer, size);
+  EXPECT_NE(reinterpret_cast<const char*>(words.begin()), unaligned_buffer);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(words.begin()) % alignof(capnp::word), 0u);
+  ASSERT_EQ(words.size(), size / sizeof(capnp::word));
+  EXPECT_EQ(memcmp(words.begin(), unaligned_buffer, size), 0);
+
+  capnp::FlatArrayMessageReader reader(words);
+  auto people = reader.getRoot<AddressBook>().getPeople();
+  ASSERT_EQ(people.size(), 2);
+  EXPECT_EQ(std::string(people[0].getName().cStr()), "Alice");
+  EXPECT_EQ(people[0].getPhones()[0].getType(), Person::PhoneNumber::Type::MOBILE);
+  EXPECT_EQ(std::string(people[1].getEmail().cStr()), "bob@example.com");
+
+  // the aligned buffer is reused for the next message of the same size
+  const kj::ArrayPtr<const capnp::word> words_again = view.GetWords(unaligned_buffer, size);
+  EXPECT_EQ(words_again.begin(), words.begin());
+}
+
+TEST(SerializerTest, FlatArrayViewRejectsInvalidBuffer)
+{
+  eCAL::capnproto::internal::FlatArrayView view;
+  std::vector<capnp::word> buffer(2);
+
+  EXPECT_THROW(view.GetWords(nullptr, 0), eCAL::DeserializationException);
+  // not a multiple of a capnp word
+  EXPECT_THROW(view.GetWords(buffer.data(), sizeof(capnp::word) + 3), eCAL::DeserializationException);
+}
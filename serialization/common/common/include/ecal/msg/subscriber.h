@@ -138,7 +138,8 @@ namespace eCAL
 
         try
         {
-          auto msg = serializer->Deserialize(data_.buffer, data_.buffer_size, data_type_info_);
+          // deserializers may return a reference to a message they reuse
+          const auto& msg = serializer->Deserialize(data_.buffer, data_.buffer_size, data_type_info_);
           if (data_callback_)
           {
             data_callback_(publisher_id_, msg, data_.send_timestamp, data_.send_clock);
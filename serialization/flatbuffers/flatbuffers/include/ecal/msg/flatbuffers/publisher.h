@@ -40,6 +40,15 @@ namespace eCAL
     template <typename T>
     using CObjectPublisher = CMessagePublisher<T, internal::ObjectSerializer<T, ::eCAL::SDataTypeInformation>>;
 
+    /**
+     * @brief eCAL google::flatbuffers publisher class for caller-owned builders.
+     *
+     * Sends a FlatBufferBuilder, that has been finished by the caller, without packing an object.
+     * The finished buffer is copied directly into the transport buffer (e.g. the SHM memfile).
+     *
+    **/
+    using CBuilderPublisher = CMessagePublisher<::flatbuffers::FlatBufferBuilder, internal::BuilderSerializer<::eCAL::SDataTypeInformation>>;
+
     /** @example monster_snd.cpp
     * This is an example how to use eCAL::CPublisher to send goggle::flatbuffers data with eCAL. To receive the data, see @ref monster_rec.cpp .
     */
@@ -25,6 +25,10 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <ecal/msg/exception.h>
 #include <flatbuffers/flatbuffers.h>
 
 namespace eCAL
@@ -88,6 +92,29 @@ namespace eCAL
         ::flatbuffers::FlatBufferBuilder builder;
       };
 
+      /*
+      * Serializer class for flatbuffers.
+      * Sends a builder, that has already been finished by the caller.
+      * The finished buffer is copied once into the eCAL buffer (e.g. the SHM memfile),
+      * no object is packed. The builder stays owned by the caller and can be reused (Clear()) after Send.
+      */
+      template <typename DatatypeInformation>
+      class BuilderSerializer
+        : public BaseSerializer<::flatbuffers::FlatBufferBuilder, DatatypeInformation>
+      {
+      public:
+        size_t MessageSize(const ::flatbuffers::FlatBufferBuilder& builder_) const
+        {
+          return((size_t)builder_.GetSize());
+        }
+
+        bool Serialize(const ::flatbuffers::FlatBufferBuilder& builder_, void* buffer_, size_t size_) const
+        {
+          if (size_ < builder_.GetSize()) return(false);
+          memcpy(buffer_, builder_.GetBufferPointer(), builder_.GetSize());
+          return(true);
+        }
+      };
 
       /*
        * Deerializer class for flatbuffers.
@@ -131,6 +158,45 @@ namespace eCAL
         }
       };
 
+      /*
+       * Deserializer class for flatbuffers.
+       * Like the FlatDeserializer it returns the root table inside of the receive buffer,
+       * but the buffer can be checked by a flatbuffers::Verifier before it is accessed.
+       * E.g. const Monster*
+       */
+      template <typename FlatType, typename DatatypeInformation>
+      class FlatViewDeserializer
+        : public BaseSerializer<FlatType, DatatypeInformation>
+      {
+      public:
+        void SetVerify(bool verify_) { m_verify = verify_; }
+
+        FlatType Deserialize(const void* buffer_, size_t size_, const DatatypeInformation& /*data_type_info_*/) const
+        {
+          using CleanFlatType = std::remove_const_t<std::remove_pointer_t<FlatType>>;
+          const uint8_t* buffer = static_cast<const uint8_t*>(buffer_);
+
+          if ((buffer == nullptr) || (size_ < sizeof(::flatbuffers::uoffset_t)))
+          {
+            throw DeserializationException("Received data is no flatbuffers message.");
+          }
+
+          if (m_verify)
+          {
+            ::flatbuffers::Verifier verifier(buffer, size_);
+            if (!verifier.VerifyBuffer<CleanFlatType>(nullptr))
+            {
+              throw DeserializationException("Verification of the flatbuffers message failed.");
+            }
+          }
+
+          return ::flatbuffers::GetRoot<CleanFlatType>(buffer);
+        }
+
+      private:
+        bool m_verify = false;
+      };
+
     }
   }
 }
\ No newline at end of file
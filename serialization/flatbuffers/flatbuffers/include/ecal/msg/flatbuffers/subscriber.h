@@ -27,6 +27,8 @@
 #include <ecal/msg/subscriber.h>
 #include <ecal/msg/flatbuffers/serializer.h>
 
+#include <string>
+
 namespace eCAL
 {
   namespace flatbuffers
@@ -44,6 +46,41 @@ namespace eCAL
     template <typename T>
     using CFlatSubscriber = CMessageSubscriber<const T*, internal::FlatDeserializer<const T*, ::eCAL::SDataTypeInformation>>;
 
+    /**
+     * @brief  eCAL google::flatbuffers subscriber class, that hands out views into the receive buffer.
+     *
+     * The callback gets the root table (e.g. const Monster*) pointing into the receive buffer,
+     * no object is unpacked. The pointer is only valid during the callback.
+     * If verification is enabled, every message is checked by a flatbuffers::Verifier first,
+     * messages failing the check are passed to the error callback.
+     *
+    **/
+    template <typename T>
+    class CViewSubscriber : public CMessageSubscriber<const T*, internal::FlatViewDeserializer<const T*, ::eCAL::SDataTypeInformation>>
+    {
+      using BaseT = CMessageSubscriber<const T*, internal::FlatViewDeserializer<const T*, ::eCAL::SDataTypeInformation>>;
+
+    public:
+      /**
+       * @brief  Constructor.
+       *
+       * @param topic_name_  Unique topic name.
+       * @param verify_      Verify the received messages before they are handed to the callback.
+       * @param config_      Optional configuration parameters.
+      **/
+      explicit CViewSubscriber(const std::string& topic_name_, bool verify_ = false, const Subscriber::Configuration& config_ = GetSubscriberConfiguration())
+        : BaseT(topic_name_, config_)
+      {
+        this->m_deserializer->SetVerify(verify_);
+      }
+
+      CViewSubscriber(const std::string& topic_name_, const SubEventCallbackT& event_callback_, bool verify_ = false, const Subscriber::Configuration& config_ = GetSubscriberConfiguration())
+        : BaseT(topic_name_, event_callback_, config_)
+      {
+        this->m_deserializer->SetVerify(verify_);
+      }
+    };
+
     /** @example monster_rec.cpp
     * This is an example how to use eCAL::CSubscriber to receive goggle::flatbuffers data with eCAL. To send the data, see @ref monster_snd.cpp .
     */
@@ -0,0 +1,127 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include <gtest/gtest.h>
+
+#include <ecal/ecal.h>
+#include <ecal/msg/flatbuffers/publisher.h>
+#include <ecal/msg/flatbuffers/subscriber.h>
+
+#include <flatbuffers/flatbuffers.h>
+#include <monster/monster_generated.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+class FlatbuffersPubSubTest : public ::testing::Test {
+public:
+  FlatbuffersPubSubTest()
+  {
+    // Initialize eCAL
+    eCAL::Initialize();
+  }
+
+  ~FlatbuffersPubSubTest() override {
+    // Finalize eCAL
+    eCAL::Finalize();
+  }
+};
+
+TEST_F(FlatbuffersPubSubTest, BuilderPublisherViewSubscriber)
+{
+  std::atomic<int>  received_callbacks(0);
+  std::atomic<int>  received_errors(0);
+  std::string       received_name;
+  std::vector<int>  received_inventory;
+  int16_t           received_hp(0);
+
+  eCAL::flatbuffers::CViewSubscriber<Game::Sample::Monster> sub("flatbuffers_view_test", true);
+  sub.SetReceiveCallback(
+    [&](const eCAL::STopicId& /*publisher_id_*/, const Game::Sample::Monster* const& monster_, long long /*time_*/, long long /*clock_*/)
+    {
+      // the view is only valid inside of the callback
+      received_name = monster_->name()->str();
+      received_hp   = monster_->hp();
+      for (const auto item : *monster_->inventory())
+      {
+        received_inventory.push_back(item);
+      }
+      received_callbacks++;
+    },
+    [&](const std::string& /*error_message_*/, const eCAL::STopicId& /*publisher_id_*/, const eCAL::SDataTypeInformation& /*data_type_info_*/, const eCAL::SReceiveCallbackData& /*data_*/)
+    {
+      received_errors++;
+    });
+
+  eCAL::flatbuffers::CBuilderPublisher pub("flatbuffers_view_test");
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(2000));
+
+  ::flatbuffers::FlatBufferBuilder builder;
+  const auto name = builder.CreateString("Orc");
+  const std::vector<uint8_t> inventory_items{ 3, 2, 1 };
+  const auto inventory = builder.CreateVector(inventory_items);
+  builder.Finish(Game::Sample::CreateMonster(builder, nullptr, 150, 42, name, inventory));
+
+  EXPECT_TRUE(pub.Send(builder));
+  std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+
+  // assert that the monster has been received once and passed the verifier
+  ASSERT_EQ(1, received_callbacks);
+  EXPECT_EQ(0, received_errors);
+  EXPECT_EQ("Orc", received_name);
+  EXPECT_EQ(42, received_hp);
+  EXPECT_EQ((std::vector<int>{ 3, 2, 1 }), received_inventory);
+}
+
+TEST_F(FlatbuffersPubSubTest, ViewSubscriberRejectsCorruptedMessage)
+{
+  std::atomic<int> received_callbacks(0);
+  std::atomic<int> received_errors(0);
+
+  eCAL::flatbuffers::CViewSubscriber<Game::Sample::Monster> sub("flatbuffers_view_corrupted_test", true);
+  sub.SetReceiveCallback(
+    [&](const eCAL::STopicId& /*publisher_id_*/, const Game::Sample::Monster* const& /*monster_*/, long long /*time_*/, long long /*clock_*/)
+    {
+      received_callbacks++;
+    },
+    [&](const std::string& /*error_message_*/, const eCAL::STopicId& /*publisher_id_*/, const eCAL::SDataTypeInformation& /*data_type_info_*/, const eCAL::SReceiveCallbackData& /*data_*/)
+    {
+      received_errors++;
+    });
+
+  // raw publisher, that claims to send flatbuffers but sends a root offset far behind the end of the payload
+  eCAL::SDataTypeInformation data_type_info;
+  data_type_info.encoding = "flatb";
+  eCAL::CPublisher pub("flatbuffers_view_corrupted_test", data_type_info);
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(2000));
+
+  const std::vector<uint8_t> corrupted{ 0xF0, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00 };
+  EXPECT_TRUE(pub.Send(corrupted.data(), corrupted.size()));
+  std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+
+  // assert that the message never reached the data callback
+  EXPECT_EQ(0, received_callbacks);
+  EXPECT_EQ(1, received_errors);
+}
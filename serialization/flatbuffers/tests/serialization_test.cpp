@@ -0,0 +1,168 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include <gtest/gtest.h>
+#include <ecal/msg/flatbuffers/serializer.h>
+#include <flatbuffers/flatbuffers.h>
+#include <monster/monster_generated.h>
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <tuple>
+#include <vector>
+
+struct DataTypeInformation
+{
+  std::string name;          //!< name of the datatype
+  std::string encoding;      //!< encoding of the datatype (e.g. protobuf, flatbuffers, capnproto)
+  std::string descriptor;    //!< descriptor information of the datatype (necessary for reflection)
+
+  //!< @cond
+  bool operator==(const DataTypeInformation& other) const
+  {
+    return name == other.name && encoding == other.encoding && descriptor == other.descriptor;
+  }
+
+  bool operator!=(const DataTypeInformation& other) const
+  {
+    return !(*this == other);
+  }
+
+  bool operator<(const DataTypeInformation& rhs) const
+  {
+    return std::tie(name, encoding, descriptor) < std::tie(rhs.name, rhs.encoding, rhs.descriptor);
+  }
+
+  //!< @endcond
+};
+
+using BuilderSerializer    = eCAL::flatbuffers::internal::BuilderSerializer<DataTypeInformation>;
+using FlatViewDeserializer = eCAL::flatbuffers::internal::FlatViewDeserializer<const Game::Sample::Monster*, DataTypeInformation>;
+
+void buildMonster(::flatbuffers::FlatBufferBuilder& builder)
+{
+  const Game::Sample::Vec3 pos(1.0f, 2.0f, 3.0f);
+  const auto name = builder.CreateString("Orc");
+  const std::vector<uint8_t> inventory_items{ 0, 1, 2, 3, 4 };
+  const auto inventory = builder.CreateVector(inventory_items);
+  builder.Finish(Game::Sample::CreateMonster(builder, &pos, 150, 80, name, inventory, Game::Sample::Color_Red));
+}
+
+void checkMonster(const Game::Sample::Monster* monster)
+{
+  ASSERT_NE(monster, nullptr);
+  EXPECT_EQ(monster->hp(), 80);
+  EXPECT_EQ(monster->mana(), 150);
+  EXPECT_EQ(monster->color(), Game::Sample::Color_Red);
+  ASSERT_NE(monster->name(), nullptr);
+  EXPECT_EQ(monster->name()->str(), "Orc");
+  ASSERT_NE(monster->pos(), nullptr);
+  EXPECT_EQ(monster->pos()->z(), 3.0f);
+  ASSERT_NE(monster->inventory(), nullptr);
+  ASSERT_EQ(monster->inventory()->size(), 5u);
+  EXPECT_EQ(monster->inventory()->Get(4), 4);
+}
+
+std::vector<uint8_t> serializeMonster()
+{
+  ::flatbuffers::FlatBufferBuilder builder;
+  buildMonster(builder);
+
+  BuilderSerializer serializer;
+  std::vector<uint8_t> buffer(serializer.MessageSize(builder));
+  EXPECT_TRUE(serializer.Serialize(builder, buffer.data(), buffer.size()));
+  return buffer;
+}
+
+TEST(FlatbuffersSerializerTest, BuilderSerializer)
+{
+  ::flatbuffers::FlatBufferBuilder builder;
+  buildMonster(builder);
+
+  BuilderSerializer serializer;
+  const size_t size = serializer.MessageSize(builder);
+  EXPECT_EQ(size, static_cast<size_t>(builder.GetSize()));
+
+  // too small buffers are refused
+  std::vector<uint8_t> small_buffer(size - 1);
+  EXPECT_FALSE(serializer.Serialize(builder, small_buffer.data(), small_buffer.size()));
+
+  // the finished buffer is copied as is, the builder can be used again afterwards
+  std::vector<uint8_t> buffer(size);
+  ASSERT_TRUE(serializer.Serialize(builder, buffer.data(), buffer.size()));
+  EXPECT_EQ(std::memcmp(buffer.data(), builder.GetBufferPointer(), size), 0);
+  EXPECT_EQ(size, static_cast<size_t>(builder.GetSize()));
+
+  EXPECT_EQ(BuilderSerializer::GetDataTypeInformation().encoding, "flatb");
+}
+
+TEST(FlatbuffersSerializerTest, ViewRoundTrip)
+{
+  const std::vector<uint8_t> buffer = serializeMonster();
+
+  for (const bool verify : { false, true })
+  {
+    FlatViewDeserializer deserializer;
+    deserializer.SetVerify(verify);
+
+    const Game::Sample::Monster* monster = deserializer.Deserialize(buffer.data(), buffer.size(), DataTypeInformation{});
+    checkMonster(monster);
+
+    // the view points into the receive buffer, nothing was copied
+    const uint8_t* name_ptr = reinterpret_cast<const uint8_t*>(monster->name());
+    EXPECT_GT(name_ptr, buffer.data());
+    EXPECT_LT(name_ptr, buffer.data() + buffer.size());
+  }
+}
+
+TEST(FlatbuffersSerializerTest, ViewRejectsTooSmallBuffer)
+{
+  FlatViewDeserializer deserializer;
+  const uint8_t buffer[2] = { 0, 0 };
+
+  EXPECT_THROW(deserializer.Deserialize(nullptr, 0, DataTypeInformation{}), eCAL::DeserializationException);
+  EXPECT_THROW(deserializer.Deserialize(buffer, sizeof(buffer), DataTypeInformation{}), eCAL::DeserializationException);
+}
+
+TEST(FlatbuffersSerializerTest, VerifierRejectsCorruptedBuffer)
+{
+  FlatViewDeserializer deserializer;
+  deserializer.SetVerify(true);
+
+  // root offset pointing far behind the end of the buffer
+  {
+    std::vector<uint8_t> buffer = serializeMonster();
+    const ::flatbuffers::uoffset_t root_offset = 0x7FFFFFF0;
+    std::memcpy(buffer.data(), &root_offset, sizeof(root_offset));
+    EXPECT_THROW(deserializer.Deserialize(buffer.data(), buffer.size(), DataTypeInformation{}), eCAL::DeserializationException);
+  }
+
+  // truncated message, the tables and vectors reach over the end of the buffer
+  {
+    const std::vector<uint8_t> buffer = serializeMonster();
+    EXPECT_THROW(deserializer.Deserialize(buffer.data(), buffer.size() / 2, DataTypeInformation{}), eCAL::DeserializationException);
+  }
+
+  // the unmodified message still passes
+  {
+    const std::vector<uint8_t> buffer = serializeMonster();
+    EXPECT_NO_THROW(deserializer.Deserialize(buffer.data(), buffer.size(), DataTypeInformation{}));
+  }
+}
@@ -27,10 +27,14 @@
 #include <ecal/msg/exception.h>
 #include <ecal/msg/protobuf/ecal_proto_dyn.h>
 
-#include <map>
+#include <cstdint>
+#include <functional>
+#include <list>
 #include <string>
 #include <memory>
 #include <sstream>
+#include <unordered_map>
+#include <utility>
 
 #ifdef _MSC_VER
 #pragma warning(push, 0) // disable proto warnings
@@ -40,6 +44,7 @@
 #pragma GCC diagnostic ignored "-Wunused-parameter"
 #endif
 #include <google/protobuf/stubs/common.h>
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
 #include <google/protobuf/util/json_util.h>
 #include <google/protobuf/util/type_resolver_util.h>
 #include <google/protobuf/util/type_resolver.h>
@@ -81,6 +86,90 @@ namespace eCAL
 
     namespace internal
     {
+      /*
+       * 64 bit content hash of a datatype information, used as key of the DatatypeInformationCache.
+       */
+      template <typename DatatypeInformation>
+      struct DatatypeInformationHash
+      {
+        uint64_t operator()(const DatatypeInformation& datatype_info_) const
+        {
+          uint64_t hash = std::hash<std::string>()(datatype_info_.descriptor);
+          hash ^= std::hash<std::string>()(datatype_info_.name)     + 0x9e3779b97f4a7c15ULL + (hash << 6) + (hash >> 2);
+          hash ^= std::hash<std::string>()(datatype_info_.encoding) + 0x9e3779b97f4a7c15ULL + (hash << 6) + (hash >> 2);
+          return hash;
+        }
+      };
+
+      /*
+       * Cache for values created from a datatype information (e.g. a message prototype).
+       *
+       * A subscriber passes the datatype information of the sending publisher with every
+       * message, and it may be replaced in place whenever the publisher registers. So only
+       * the content identifies a type, neither the address of the datatype information nor
+       * the one of its descriptor buffer.
+       *
+       * The entry used last is checked first. The short name, encoding and the descriptor
+       * size are compared before the descriptor itself, so switching between types is
+       * detected without reading the descriptor. A matching type costs one memory compare
+       * of the descriptor, it is never hashed on that path.
+       * Other types are looked up by their 64 bit content hash, which is only computed when
+       * the type changes. Entries with colliding hashes are told apart by a full compare.
+       *
+       * Not thread-safe
+       */
+      template <typename DatatypeInformation, typename ValueT, typename HashT = DatatypeInformationHash<DatatypeInformation>>
+      class DatatypeInformationCache
+      {
+      public:
+        ValueT* Find(const DatatypeInformation& datatype_info_)
+        {
+          if ((m_last_entry != nullptr) && IsSameDatatype(m_last_entry->first, datatype_info_)) return &m_last_entry->second;
+
+          auto bucket = m_entries.find(HashT()(datatype_info_));
+          if (bucket == m_entries.end()) return nullptr;
+
+          for (auto& entry : bucket->second)
+          {
+            if (IsSameDatatype(entry.first, datatype_info_))
+            {
+              m_last_entry = &entry;
+              return &entry.second;
+            }
+          }
+          return nullptr;
+        }
+
+        ValueT& Insert(const DatatypeInformation& datatype_info_, ValueT value_)
+        {
+          auto& bucket = m_entries[HashT()(datatype_info_)];
+          bucket.emplace_back(datatype_info_, std::move(value_));
+          m_last_entry = &bucket.back();
+          return m_last_entry->second;
+        }
+
+        size_t Size() const
+        {
+          size_t size = 0;
+          for (const auto& bucket : m_entries) size += bucket.second.size();
+          return size;
+        }
+
+      private:
+        static bool IsSameDatatype(const DatatypeInformation& lhs_, const DatatypeInformation& rhs_)
+        {
+          return (lhs_.descriptor.size() == rhs_.descriptor.size())
+            && (lhs_.name                == rhs_.name)
+            && (lhs_.encoding            == rhs_.encoding)
+            && (lhs_.descriptor          == rhs_.descriptor);
+        }
+
+        // list entries keep their address, so the last used entry can be referenced
+        using EntryT = std::pair<DatatypeInformation, ValueT>;
+        std::unordered_map<uint64_t, std::list<EntryT>> m_entries;
+        EntryT*                                          m_last_entry = nullptr;
+      };
+
       template <typename DatatypeInformation>
       class ProtobufDynamicJSONDeserializer
       {
@@ -112,10 +201,13 @@ namespace eCAL
           options.always_print_primitive_fields = true;
 #endif
 
-          std::string binary_input;
-          binary_input.assign(static_cast<const char*>(buffer_), static_cast<size_t>(size_));
+          const SResolver& resolver = GetTypeResolver(datatype_info_);
+
+          // read the payload in place instead of copying it into a string first
+          google::protobuf::io::ArrayInputStream binary_input(buffer_, static_cast<int>(size_));
           std::string json_output;
-          auto status = google::protobuf::util::BinaryToJsonString(GetTypeResolver(datatype_info_).get(), GetQualifiedTopicType(datatype_info_), binary_input, &json_output, options);
+          google::protobuf::io::StringOutputStream json_stream(&json_output);
+          auto status = google::protobuf::util::BinaryToJsonStream(resolver.type_resolver.get(), resolver.type_url, &binary_input, &json_stream, options);
           if (status.ok())
           {
             return json_output;
@@ -127,14 +219,18 @@ namespace eCAL
         }
 
       private:
-        std::shared_ptr<google::protobuf::util::TypeResolver> GetTypeResolver(const DatatypeInformation& datatype_info_)
+        struct SResolver
         {
-          auto schema = m_type_resolver_map.find(datatype_info_);
-          if (schema == m_type_resolver_map.end())
-          {
-            m_type_resolver_map[datatype_info_] = CreateTypeResolver(datatype_info_);
-          }
-          return m_type_resolver_map[datatype_info_];
+          std::shared_ptr<google::protobuf::util::TypeResolver> type_resolver;
+          std::string                                           type_url;
+        };
+
+        const SResolver& GetTypeResolver(const DatatypeInformation& datatype_info_)
+        {
+          SResolver* resolver = m_type_resolver_cache.Find(datatype_info_);
+          if (resolver != nullptr) return *resolver;
+
+          return m_type_resolver_cache.Insert(datatype_info_, SResolver{ CreateTypeResolver(datatype_info_), GetQualifiedTopicType(datatype_info_) });
         }
 
         std::shared_ptr<google::protobuf::util::TypeResolver> CreateTypeResolver(const DatatypeInformation& datatype_info_)
@@ -180,8 +276,8 @@ namespace eCAL
           return  type_name.substr(type_name.find_last_of('.') + 1, type_name.size());
         }
 
-        eCAL::protobuf::CProtoDynDecoder                                                      m_dynamic_decoder;
-        std::map<DatatypeInformation, std::shared_ptr<google::protobuf::util::TypeResolver>>  m_type_resolver_map;
+        eCAL::protobuf::CProtoDynDecoder                             m_dynamic_decoder;
+        DatatypeInformationCache<DatatypeInformation, SResolver>     m_type_resolver_cache;
       };
 
       template <typename DatatypeInformation>
@@ -208,10 +304,20 @@ namespace eCAL
 
         std::shared_ptr<google::protobuf::Message> Deserialize(const void* buffer_, size_t size_, const DatatypeInformation& datatype_info_)
         {
-          auto message_prototype = GetMessagePointer(datatype_info_);
-          // for some reason cannot use std::make_shared, however should be ok in this context.
-          std::shared_ptr<google::protobuf::Message> message_with_content(message_prototype->New());
-          message_with_content->CopyFrom(*message_prototype);
+          SMessage& message = GetMessage(datatype_info_);
+
+          // the last decoded message is reused, unless the receiver still holds it
+          std::shared_ptr<google::protobuf::Message> message_with_content;
+          if (message.instance && (message.instance.use_count() == 1))
+          {
+            message_with_content = message.instance;
+          }
+          else
+          {
+            // for some reason cannot use std::make_shared, however should be ok in this context.
+            message_with_content.reset(message.prototype->New());
+            message.instance = message_with_content;
+          }
 
           try
           {
@@ -225,14 +331,18 @@ namespace eCAL
         }
 
       private:
-        std::shared_ptr<google::protobuf::Message> GetMessagePointer(const DatatypeInformation& datatype_info_)
+        struct SMessage
         {
-          auto schema = m_message_map.find(datatype_info_);
-          if (schema == m_message_map.end())
-          {
-            m_message_map[datatype_info_] = CreateMessagePointer(datatype_info_);
-          }
-          return m_message_map[datatype_info_];
+          std::shared_ptr<google::protobuf::Message> prototype;
+          std::shared_ptr<google::protobuf::Message> instance;
+        };
+
+        SMessage& GetMessage(const DatatypeInformation& datatype_info_)
+        {
+          SMessage* message = m_message_cache.Find(datatype_info_);
+          if (message != nullptr) return *message;
+
+          return m_message_cache.Insert(datatype_info_, SMessage{ CreateMessagePointer(datatype_info_), nullptr });
         }
 
         std::shared_ptr<google::protobuf::Message> CreateMessagePointer(const DatatypeInformation& topic_info_)
@@ -266,8 +376,8 @@ namespace eCAL
           return proto_msg_ptr;
         }
 
-        eCAL::protobuf::CProtoDynDecoder                                           m_dynamic_decoder;
-        std::map<DatatypeInformation, std::shared_ptr<google::protobuf::Message>> m_message_map;
+        eCAL::protobuf::CProtoDynDecoder                          m_dynamic_decoder;
+        DatatypeInformationCache<DatatypeInformation, SMessage>   m_message_cache;
       };
 
 
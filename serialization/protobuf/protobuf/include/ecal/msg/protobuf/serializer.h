@@ -25,9 +25,20 @@
 #pragma once
 
 #include <cstddef>
+#include <memory>
+#include <vector>
 #include <ecal/msg/exception.h>
 #include <ecal/msg/protobuf/ecal_proto_hlp.h>
 
+// protobuf includes
+#ifdef _MSC_VER
+#pragma warning(push, 0) // disable proto warnings
+#endif
+#include <google/protobuf/arena.h>
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
 namespace eCAL
 {
   namespace protobuf
@@ -85,6 +96,63 @@ namespace eCAL
           throw DeserializationException("Could not parse protobuf message");
         }
       };
+
+      /*
+       * Deserializer, that does not create a new message for every received sample.
+       *
+       * Without an arena, one message is cleared and reparsed for every sample, so repeated
+       * fields keep their capacity. With an arena, the messages are created on an arena that
+       * is reset for every sample, its initial block is allocated once and reused.
+       *
+       * The returned message is only valid until the next call of Deserialize.
+       */
+      template <typename T, typename DatatypeInformation>
+      class ReusingDeserializer
+        : public Serializer<T, DatatypeInformation>
+      {
+      public:
+        // arena_initial_block_size_: size of the reused arena block, 0 = reuse a single message
+        void SetArenaInitialBlockSize(size_t arena_initial_block_size_)
+        {
+          m_arena.reset();
+          m_arena_block.clear();
+          m_arena_block.shrink_to_fit();
+          if (arena_initial_block_size_ == 0) return;
+
+          m_arena_block.resize(arena_initial_block_size_);
+          google::protobuf::ArenaOptions options;
+          options.initial_block      = m_arena_block.data();
+          options.initial_block_size = m_arena_block.size();
+          m_arena = std::make_unique<google::protobuf::Arena>(options);
+        }
+
+        const T& Deserialize(const void* buffer_, size_t size_, const DatatypeInformation& /*data_type_info_*/)
+        {
+          T* msg = &m_message;
+          if (m_arena)
+          {
+            // destroys the message of the last sample, the initial block is kept
+            m_arena->Reset();
+#if GOOGLE_PROTOBUF_VERSION >= 4022000
+            msg = google::protobuf::Arena::Create<T>(m_arena.get());
+#else
+            msg = google::protobuf::Arena::CreateMessage<T>(m_arena.get());
+#endif
+          }
+
+          // ParseFromArray clears the message first
+          if (msg->ParseFromArray(buffer_, static_cast<int>(size_)))
+          {
+            return *msg;
+          }
+          throw DeserializationException("Could not parse protobuf message");
+        }
+
+      private:
+        T                                        m_message;
+        std::vector<char>                        m_arena_block;
+        std::unique_ptr<google::protobuf::Arena> m_arena;
+      };
     }
   }
 }
\ No newline at end of file
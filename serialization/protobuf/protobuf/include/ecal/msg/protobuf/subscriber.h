@@ -27,6 +27,9 @@
 #include <ecal/msg/subscriber.h>
 #include <ecal/msg/protobuf/serializer.h>
 
+#include <cstddef>
+#include <string>
+
 namespace eCAL
 {
   namespace protobuf
@@ -41,6 +44,50 @@ namespace eCAL
     template <typename T>
     using CSubscriber = CMessageSubscriber<T, internal::Serializer<T, ::eCAL::SDataTypeInformation>>;
 
+    /**
+     * @brief  Message allocation of a CReusingSubscriber.
+    **/
+    enum class eMessageReuse
+    {
+      reuse_message,  //!< one message per subscriber, that is cleared and reparsed for every sample
+      arena,          //!< the message is created on a per subscriber arena, that is reset for every sample
+    };
+
+    /**
+     * @brief  eCAL google::protobuf subscriber class, that does not create a new message for every sample.
+     *
+     * Same interface and callbacks as CSubscriber, but the message handed to the callback is reused,
+     * so large repeated fields are not reallocated for every sample.
+     * The message is only valid during the callback, copy it to keep it.
+     *
+    **/
+    template <typename T>
+    class CReusingSubscriber : public CMessageSubscriber<T, internal::ReusingDeserializer<T, ::eCAL::SDataTypeInformation>>
+    {
+      using BaseT = CMessageSubscriber<T, internal::ReusingDeserializer<T, ::eCAL::SDataTypeInformation>>;
+
+    public:
+      /**
+       * @brief  Constructor.
+       *
+       * @param topic_name_                Unique topic name.
+       * @param reuse_                     Message allocation mode.
+       * @param arena_initial_block_size_  Size of the arena block, that is allocated once and reused (arena mode only).
+       * @param config_                    Optional configuration parameters.
+      **/
+      explicit CReusingSubscriber(const std::string& topic_name_, eMessageReuse reuse_ = eMessageReuse::reuse_message, size_t arena_initial_block_size_ = 64 * 1024, const Subscriber::Configuration& config_ = GetSubscriberConfiguration())
+        : BaseT(topic_name_, config_)
+      {
+        this->m_deserializer->SetArenaInitialBlockSize(reuse_ == eMessageReuse::arena ? arena_initial_block_size_ : 0);
+      }
+
+      CReusingSubscriber(const std::string& topic_name_, const SubEventCallbackT& event_callback_, eMessageReuse reuse_ = eMessageReuse::reuse_message, size_t arena_initial_block_size_ = 64 * 1024, const Subscriber::Configuration& config_ = GetSubscriberConfiguration())
+        : BaseT(topic_name_, event_callback_, config_)
+      {
+        this->m_deserializer->SetArenaInitialBlockSize(reuse_ == eMessageReuse::arena ? arena_initial_block_size_ : 0);
+      }
+    };
+
     /** @example person_rec.cpp
     * This is an example how to use eCAL::CSubscriber to receive google::protobuf data with eCAL. To send the data, see @ref person_snd.cpp .
     */
@@ -0,0 +1,194 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2025 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include <ecal/msg/protobuf/dynamic_serializer.h>
+#include <ecal/msg/protobuf/ecal_proto_hlp.h>
+#include <ecal/types.h>
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+
+#include "person.pb.h"
+
+namespace
+{
+  using CacheT = eCAL::protobuf::internal::DatatypeInformationCache<eCAL::SDataTypeInformation, int>;
+
+  // puts all datatypes into the same bucket
+  struct CollidingHash
+  {
+    uint64_t operator()(const eCAL::SDataTypeInformation& /*datatype_info_*/) const { return 42; }
+  };
+  using CollidingCacheT = eCAL::protobuf::internal::DatatypeInformationCache<eCAL::SDataTypeInformation, int, CollidingHash>;
+
+  eCAL::SDataTypeInformation CreateDatatypeInformation(const std::string& name_, const std::string& descriptor_)
+  {
+    eCAL::SDataTypeInformation datatype_info;
+    datatype_info.name       = name_;
+    datatype_info.encoding   = "proto";
+    datatype_info.descriptor = descriptor_;
+    return datatype_info;
+  }
+
+  eCAL::SDataTypeInformation CreatePersonDatatypeInformation()
+  {
+    const pb::People::Person person;
+    return CreateDatatypeInformation(person.GetTypeName(), eCAL::protobuf::GetProtoMessageDescription(person));
+  }
+
+  std::string SerializePerson(int id_, const std::string& name_)
+  {
+    pb::People::Person person;
+    person.set_id(id_);
+    person.set_name(name_);
+    return person.SerializeAsString();
+  }
+}
+
+TEST(contrib, DatatypeInformationCache_FindInserted)
+{
+  CacheT cache;
+  const auto type_a = CreateDatatypeInformation("a", std::string(1024, 'a'));
+  const auto type_b = CreateDatatypeInformation("b", std::string(1024, 'b'));
+
+  EXPECT_EQ(cache.Find(type_a), nullptr);
+  cache.Insert(type_a, 1);
+  cache.Insert(type_b, 2);
+  EXPECT_EQ(cache.Size(), 2);
+
+  ASSERT_NE(cache.Find(type_a), nullptr);
+  EXPECT_EQ(*cache.Find(type_a), 1);
+  ASSERT_NE(cache.Find(type_b), nullptr);
+  EXPECT_EQ(*cache.Find(type_b), 2);
+
+  // a different encoding is a different type
+  auto type_a_other_encoding = type_a;
+  type_a_other_encoding.encoding = "other";
+  EXPECT_EQ(cache.Find(type_a_other_encoding), nullptr);
+}
+
+TEST(contrib, DatatypeInformationCache_Collisions)
+{
+  CollidingCacheT cache;
+
+  const auto type_1 = CreateDatatypeInformation("collision", std::string(1024, '1'));
+  const auto type_2 = CreateDatatypeInformation("collision", std::string(1024, '2'));
+  const auto type_3 = CreateDatatypeInformation("collision", std::string(1024, '3'));
+
+  cache.Insert(type_1, 1);
+  cache.Insert(type_2, 2);
+  EXPECT_EQ(cache.Size(), 2);
+
+  for (int i = 0; i < 3; ++i)
+  {
+    ASSERT_NE(cache.Find(type_1), nullptr);
+    EXPECT_EQ(*cache.Find(type_1), 1);
+    ASSERT_NE(cache.Find(type_2), nullptr);
+    EXPECT_EQ(*cache.Find(type_2), 2);
+    EXPECT_EQ(cache.Find(type_3), nullptr);
+  }
+
+  // the descriptors only differ in the last byte
+  auto type_1_modified = type_1;
+  type_1_modified.descriptor.back() = 'x';
+  EXPECT_EQ(cache.Find(type_1_modified), nullptr);
+}
+
+TEST(contrib, DatatypeInformationCache_LastEntry)
+{
+  CacheT cache;
+  const auto type_a = CreateDatatypeInformation("a", std::string(1024, 'a'));
+  const auto type_b = CreateDatatypeInformation("b", std::string(2048, 'b'));
+  cache.Insert(type_a, 1);
+  cache.Insert(type_b, 2);
+
+  // the same object is passed for every message
+  auto datatype_info = type_a;
+  for (int i = 0; i < 3; ++i)
+  {
+    ASSERT_NE(cache.Find(datatype_info), nullptr);
+    EXPECT_EQ(*cache.Find(datatype_info), 1);
+  }
+
+  // a copy of the last used datatype information
+  const auto datatype_info_copy = datatype_info;
+  ASSERT_NE(cache.Find(datatype_info_copy), nullptr);
+  EXPECT_EQ(*cache.Find(datatype_info_copy), 1);
+
+  // the object passed last is updated in place
+  datatype_info = type_b;
+  ASSERT_NE(cache.Find(datatype_info), nullptr);
+  EXPECT_EQ(*cache.Find(datatype_info), 2);
+
+  // ... with a descriptor of the same size, e.g. when a subscriber gets a new registration
+  datatype_info = CreateDatatypeInformation("b", std::string(2048, 'c'));
+  EXPECT_EQ(cache.Find(datatype_info), nullptr);
+  cache.Insert(datatype_info, 3);
+  ASSERT_NE(cache.Find(datatype_info), nullptr);
+  EXPECT_EQ(*cache.Find(datatype_info), 3);
+
+  // switching back to a previous type
+  ASSERT_NE(cache.Find(type_b), nullptr);
+  EXPECT_EQ(*cache.Find(type_b), 2);
+  ASSERT_NE(cache.Find(datatype_info), nullptr);
+  EXPECT_EQ(*cache.Find(datatype_info), 3);
+
+  // the object passed last is updated in place, reusing the descriptor buffer, so only the content differs
+  const char* descriptor_buffer = datatype_info.descriptor.data();
+  datatype_info.descriptor.assign(2048, 'b');
+  ASSERT_EQ(datatype_info.descriptor.data(), descriptor_buffer);
+  ASSERT_NE(cache.Find(datatype_info), nullptr);
+  EXPECT_EQ(*cache.Find(datatype_info), 2);
+  datatype_info.descriptor.assign(2048, 'd');
+  ASSERT_EQ(datatype_info.descriptor.data(), descriptor_buffer);
+  EXPECT_EQ(cache.Find(datatype_info), nullptr);
+}
+
+TEST(contrib, DynamicDeserializer_MessageReuse)
+{
+  eCAL::protobuf::internal::ProtobufDynamicDeserializer<eCAL::SDataTypeInformation> deserializer;
+  const auto datatype_info = CreatePersonDatatypeInformation();
+
+  const std::string payload_1 = SerializePerson(1, "Max");
+  const std::string payload_2 = SerializePerson(2, "Anna");
+  const std::string payload_3 = SerializePerson(3, "Lisa");
+
+  std::shared_ptr<google::protobuf::Message> message_1 = deserializer.Deserialize(payload_1.data(), payload_1.size(), datatype_info);
+  ASSERT_NE(message_1, nullptr);
+  const google::protobuf::Message* message_1_address = message_1.get();
+
+  // the caller still holds the previous message, so a new one is created
+  std::shared_ptr<google::protobuf::Message> message_2 = deserializer.Deserialize(payload_2.data(), payload_2.size(), datatype_info);
+  ASSERT_NE(message_2, nullptr);
+  EXPECT_NE(message_2.get(), message_1.get());
+  EXPECT_EQ(message_1->SerializeAsString(), payload_1);
+  EXPECT_EQ(message_2->SerializeAsString(), payload_2);
+
+  // the last message is released by the caller, so it is reused
+  const google::protobuf::Message* message_2_address = message_2.get();
+  message_1.reset();
+  message_2.reset();
+  std::shared_ptr<google::protobuf::Message> message_3 = deserializer.Deserialize(payload_3.data(), payload_3.size(), datatype_info);
+  ASSERT_NE(message_3, nullptr);
+  EXPECT_EQ(message_3.get(), message_2_address);
+  EXPECT_NE(message_3.get(), message_1_address);
+  EXPECT_EQ(message_3->SerializeAsString(), payload_3);
+}
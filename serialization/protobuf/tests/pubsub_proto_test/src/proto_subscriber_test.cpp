@@ -137,3 +137,31 @@ TEST_F(core_cpp_pubsub_proto_sub, ProtoSubscriberTest_MoveConstruction)
 
   ASSERT_EQ(numbers_of_sends, received_callbacks.load());
 }
+
+TEST_F(core_cpp_pubsub_proto_sub, ProtoSubscriberTest_ReusingSendReceive)
+{
+  for (const auto reuse : { eCAL::protobuf::eMessageReuse::reuse_message, eCAL::protobuf::eMessageReuse::arena })
+  {
+    received_callbacks = 0;
+
+    // Assert that both reuse modes hand the received content to the callback
+    eCAL::protobuf::CReusingSubscriber<pb::People::Person> person_rec("ProtoSubscriberTest", reuse);
+    std::atomic<bool> content_ok(true);
+    person_rec.SetReceiveCallback([this, &content_ok](const eCAL::STopicId&, const pb::People::Person& person_, long long, long long)
+      {
+        if ((person_.id() != 1) || (person_.name() != "Max")) content_ok = false;
+        OnPerson();
+      });
+
+    eCAL::protobuf::CPublisher<pb::People::Person> person_pub("ProtoSubscriberTest");
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(2000));
+
+    ASSERT_TRUE(SendPerson(person_pub));
+    ASSERT_TRUE(SendPerson(person_pub));
+    std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+
+    ASSERT_EQ(2, received_callbacks);
+    ASSERT_TRUE(content_ok);
+  }
+}
@@ -20,6 +20,7 @@
 #include <algorithm>
 #include <chrono>
 #include <limits>
+#include <random>
 #include <set>
 #include <thread>
 #include <sstream>
@@ -27,6 +28,7 @@
 #include <gtest/gtest.h>
 
 #include <ecalhdf5/eh5_meas.h>
+#include <ecal_utils/filesystem.h>
 #include <src/hdf5_helper.h> // This header file is usually not available as public include!
 #include <src/escape.h> // This header file is usually not available as public include!
 
@@ -1009,6 +1011,262 @@ TEST(HDF5, MergedMeasurements)
 
 }
 
+/*
+* This test checks that the flat EntryInfoVect API merges the entries of
+* multiple files in receive timestamp order and supports range queries
+*/
+TEST(HDF5, EntriesInfoVectMergedMeasurements)
+{
+  Channel::id_t id = 0x0001;
+  std::string topic_name = "topic";
+  eCAL::eh5::SChannel channel{ topic_name, id };
+
+  // Interleaved receive timestamps, so the entries of both files have to be merged
+  std::vector<TestingMeasEntry> entries_meas_1 = {
+    TestingMeasEntry{ {topic_name, id}, "meas1: test data", 1001, 1002, 0, 0 },
+    TestingMeasEntry{ {topic_name, id}, "meas1: test data", 3001, 3002, 0, 2 },
+    TestingMeasEntry{ {topic_name, id}, "meas1: test data", 5001, 5002, 0, 4 },
+  };
+
+  std::vector<TestingMeasEntry> entries_meas_2 = {
+    TestingMeasEntry{ {topic_name, id}, "meas2: test data", 2001, 2002, 0, 1 },
+    TestingMeasEntry{ {topic_name, id}, "meas2: test data", 4001, 4002, 0, 3 },
+    TestingMeasEntry{ {topic_name, id}, "meas2: test data", 6001, 6002, 0, 5 },
+  };
+
+  std::string base_dir = output_dir + "/entries_info_vect_measurement";
+
+  {
+    MeasAPI hdf5_writer;
+    CreateMeasurement<MeasAPI, MeasAPIAccess>(hdf5_writer, base_dir + "/meas1", "meas1");
+    for (const auto& entry : entries_meas_1)
+    {
+      EXPECT_TRUE(WriteToHDF(hdf5_writer, entry));
+    }
+    EXPECT_TRUE(hdf5_writer.Close());
+  }
+
+  {
+    MeasAPI hdf5_writer;
+    CreateMeasurement<MeasAPI, MeasAPIAccess>(hdf5_writer, base_dir + "/meas2", "meas2");
+    for (const auto& entry : entries_meas_2)
+    {
+      EXPECT_TRUE(WriteToHDF(hdf5_writer, entry));
+    }
+    EXPECT_TRUE(hdf5_writer.Close());
+  }
+
+  {
+    MeasAPI hdf5_reader;
+    EXPECT_TRUE(hdf5_reader.Open(base_dir));
+
+    eCAL::eh5::EntryInfoVect entries;
+    EXPECT_TRUE(hdf5_reader.GetEntriesInfo(channel, entries));
+    ASSERT_EQ(entries.size(), entries_meas_1.size() + entries_meas_2.size());
+    EXPECT_TRUE(std::is_sorted(entries.begin(), entries.end()));
+
+    // The vector must contain the same entries as the set
+    eCAL::eh5::EntryInfoSet entries_set;
+    EXPECT_TRUE(hdf5_reader.GetEntriesInfo(channel, entries_set));
+    EXPECT_TRUE(std::equal(entries.begin(), entries.end(), entries_set.begin(), entries_set.end()));
+
+    // Every entry must point to the correct data
+    for (size_t i = 0; i < entries.size(); ++i)
+    {
+      EXPECT_EQ(entries[i].SndClock, static_cast<long long>(i));
+
+      size_t data_size = 0;
+      EXPECT_TRUE(hdf5_reader.GetEntryDataSize(entries[i].ID, data_size));
+      std::string data_read(data_size, ' ');
+      EXPECT_TRUE(hdf5_reader.GetEntryData(entries[i].ID, const_cast<char*>(data_read.data())));
+      EXPECT_EQ(data_read, (i % 2 == 0) ? "meas1: test data" : "meas2: test data");
+    }
+
+    // Range queries include both borders
+    eCAL::eh5::EntryInfoVect range_entries;
+    EXPECT_TRUE(hdf5_reader.GetEntriesInfoRange(channel, 2002, 4002, range_entries));
+    ASSERT_EQ(range_entries.size(), 3u);
+    EXPECT_EQ(range_entries.front().RcvTimestamp, 2002);
+    EXPECT_EQ(range_entries.back().RcvTimestamp,  4002);
+  }
+
+  {
+    LegacyAPI hdf5_reader;
+    EXPECT_TRUE(hdf5_reader.Open(base_dir));
+
+    eCAL::eh5::EntryInfoVect entries;
+    EXPECT_TRUE(hdf5_reader.GetEntriesInfo(topic_name, entries));
+    EXPECT_EQ(entries.size(), entries_meas_1.size() + entries_meas_2.size());
+    EXPECT_TRUE(std::is_sorted(entries.begin(), entries.end()));
+  }
+}
+
+TEST(HDF5, WriteReadCompressedPayloads)
+{
+  TestingMeasEntry compressed_entry{ { "compressed topic", 1 }, std::string(64 * 1024, 'c'), 1001LL, 2001LL, 0, 11LL };
+  TestingMeasEntry small_entry     { { "compressed topic", 1 }, "too small to be compressed",   1002LL, 2002LL, 0, 12LL };
+  TestingMeasEntry raw_entry       { { "raw topic",        2 }, std::string(64 * 1024, 'r'), 1003LL, 2003LL, 0, 13LL };
+
+  eCAL::eh5::SCompressionSettings deflate;
+  deflate.type  = eCAL::eh5::eCompressionType::DEFLATE;
+  deflate.level = 6;
+
+  std::vector<TestingMeasEntry> meas_entries{ compressed_entry, small_entry, raw_entry };
+
+  std::string base_name = "compressed_meas";
+  std::string meas_root_dir = output_dir + "/" + base_name;
+
+  // Write HDF5 file with the current API
+  {
+    MeasAPI hdf5_writer;
+    CreateMeasurement<MeasAPI, MeasAPIAccess>(hdf5_writer, meas_root_dir, base_name);
+    hdf5_writer.SetCompression(deflate);
+    hdf5_writer.SetChannelCompression(raw_entry.channel.name, eCAL::eh5::SCompressionSettings{});
+
+    for (const auto& entry : meas_entries)
+    {
+      EXPECT_TRUE(WriteToHDF(hdf5_writer, entry));
+    }
+
+    EXPECT_TRUE(hdf5_writer.Close());
+  }
+
+  // Write HDF5 file with the legacy API
+  std::string legacy_base_name = "compressed_meas_legacy";
+  std::string legacy_meas_root_dir = output_dir + "/" + legacy_base_name;
+  {
+    LegacyAPI hdf5_writer;
+    CreateMeasurement<LegacyAPI, LegacyAPIAccess>(hdf5_writer, legacy_meas_root_dir, legacy_base_name);
+    hdf5_writer.SetChannelCompression(compressed_entry.channel.name, deflate);
+
+    for (const auto& entry : meas_entries)
+    {
+      EXPECT_TRUE(WriteToHDF(hdf5_writer, entry));
+    }
+
+    EXPECT_TRUE(hdf5_writer.Close());
+  }
+
+  // Compressed payloads must be read back transparently
+  {
+    MeasAPI hdf5_reader;
+    EXPECT_TRUE(hdf5_reader.Open(meas_root_dir));
+
+    for (const auto& entry : meas_entries)
+    {
+      ValidateDataInMeasurement(hdf5_reader, entry);
+    }
+  }
+
+  {
+    LegacyAPI hdf5_reader;
+    EXPECT_TRUE(hdf5_reader.Open(legacy_meas_root_dir));
+
+    for (const auto& entry : meas_entries)
+    {
+      ValidateDataInMeasurement(hdf5_reader, entry);
+    }
+  }
+}
+
+TEST(HDF5, CompressedPayloadsRespectMaxFileSize)
+{
+  // Random payloads don't compress, so every queued payload ends up in the file with its full size
+  std::mt19937 generator(42);
+  std::uniform_int_distribution<int> distribution(0, 255);
+
+  std::string base_name = "compressed_split_meas";
+  std::string meas_root_dir = output_dir + "/" + base_name;
+
+  const size_t max_file_size_mib = 1;
+  const size_t payload_size      = 128 * 1024;
+  const int    payload_count     = 40;
+
+  {
+    MeasAPI hdf5_writer;
+    CreateMeasurement<MeasAPI, MeasAPIAccess>(hdf5_writer, meas_root_dir, base_name);
+    hdf5_writer.SetMaxSizePerFile(max_file_size_mib);
+
+    eCAL::eh5::SCompressionSettings deflate;
+    deflate.type = eCAL::eh5::eCompressionType::DEFLATE;
+    hdf5_writer.SetCompression(deflate);
+
+    for (int i = 0; i < payload_count; i++)
+    {
+      std::string payload(payload_size, '\0');
+      for (auto& c : payload)
+        c = static_cast<char>(distribution(generator));
+
+      TestingMeasEntry entry{ { "random topic", 1 }, payload, 1000LL + i, 2000LL + i, 0, i };
+      EXPECT_TRUE(WriteToHDF(hdf5_writer, entry));
+    }
+
+    EXPECT_TRUE(hdf5_writer.Close());
+  }
+
+  // Payloads that were still being compressed must count for the file size, so the files are split in time
+  int file_count = 0;
+  for (const auto& file : EcalUtils::Filesystem::DirContent(meas_root_dir))
+  {
+    if (file.first.find(".hdf5") == std::string::npos) continue;
+    file_count++;
+
+    // Allow some space for the HDF5 meta data and the entry tables
+    EXPECT_LE(file.second.FileSize(), static_cast<int64_t>(max_file_size_mib * 1024 * 1024 + 64 * 1024)) << file.first;
+  }
+  EXPECT_GE(file_count, static_cast<int>((payload_count * payload_size) / (max_file_size_mib * 1024 * 1024)));
+}
+
+TEST(HDF5, ReadEntryDataView)
+{
+  TestingMeasEntry entry_1{ { "view topic", 1 }, std::string(64 * 1024, 'v'), 1001LL, 2001LL, 0, 11LL };
+  TestingMeasEntry entry_2{ { "view topic", 1 }, "short payload",              1002LL, 2002LL, 0, 12LL };
+
+  std::vector<TestingMeasEntry> meas_entries{ entry_1, entry_2 };
+
+  std::string base_name = "view_meas";
+  std::string meas_root_dir = output_dir + "/" + base_name;
+
+  {
+    MeasAPI hdf5_writer;
+    CreateMeasurement<MeasAPI, MeasAPIAccess>(hdf5_writer, meas_root_dir, base_name);
+
+    for (const auto& entry : meas_entries)
+    {
+      EXPECT_TRUE(WriteToHDF(hdf5_writer, entry));
+    }
+
+    EXPECT_TRUE(hdf5_writer.Close());
+  }
+
+  std::vector<eCAL::eh5::SEntryDataView> views;
+  {
+    MeasAPI hdf5_reader;
+    EXPECT_TRUE(hdf5_reader.Open(meas_root_dir));
+
+    eCAL::eh5::EntryInfoSet entries;
+    EXPECT_TRUE(hdf5_reader.GetEntriesInfo(entry_1.channel, entries));
+    EXPECT_EQ(entries.size(), meas_entries.size());
+
+    for (const auto& entry_info : entries)
+    {
+      // Uncompressed payloads are served directly from the mapped file
+      eCAL::eh5::SEntryDataView view;
+      EXPECT_TRUE(hdf5_reader.GetEntryDataView(entry_info.ID, view));
+      views.push_back(view);
+    }
+
+    EXPECT_TRUE(hdf5_reader.Close());
+  }
+
+  // The views must stay valid after the measurement has been closed
+  ASSERT_EQ(views.size(), meas_entries.size());
+  for (size_t i = 0; i < views.size(); ++i)
+  {
+    EXPECT_EQ(std::string(static_cast<const char*>(views[i].data), views[i].size), meas_entries[i].data);
+  }
+}
+
 // We don't write empty measurements.
 // If we change the implementation, we can reactivate this test
 TEST(HDF5, DISABLED_WriteReadEmptyMeasurement)